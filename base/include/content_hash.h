@@ -0,0 +1,84 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_INCLUDE_CONTENT_HASH_H_
+#define BASE_INCLUDE_CONTENT_HASH_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace lynx {
+namespace base {
+
+struct ContentDigest {
+  uint64_t low{0};
+  uint64_t high{0};
+
+  // 32 lowercase hex digits, which is also the length of a MD5 hexdigest.
+  std::string ToHexString() const;
+
+  bool operator==(const ContentDigest& other) const {
+    return low == other.low && high == other.high;
+  }
+  bool operator!=(const ContentDigest& other) const {
+    return !(*this == other);
+  }
+};
+
+/**
+ * @class ContentHasher
+ *
+ * A streaming 128-bit non-cryptographic hash for content addressed caches,
+ * e.g. the JS bytecode cache and the template bundle cache. It is several
+ * times faster than MD5: the input is consumed in stripes of 64 bytes by 8
+ * independent 64-bit lanes, each doing one 32x32->64 bit multiplication, a
+ * loop that compilers vectorize for SSE2, AVX2 and NEON. The accumulators
+ * are scrambled once per 1KB block and folded into two 64-bit halves at the
+ * end.
+ *
+ * The digest is stable across platforms and versions, as it names files on
+ * disk. Do not use it where an adversary controls the input.
+ *
+ * Usage:
+ *   ContentHasher hasher;
+ *   hasher.Update(chunk1, size1);
+ *   hasher.Update(chunk2, size2);
+ *   std::string key = hasher.Finalize().ToHexString();
+ */
+class ContentHasher {
+ public:
+  static constexpr size_t kStripeSize = 64;
+  static constexpr size_t kLaneCount = 8;
+  static constexpr size_t kStripesPerBlock = 16;
+
+  ContentHasher();
+
+  void Update(const void* data, size_t size);
+  void Update(const std::string& data) { Update(data.data(), data.size()); }
+
+  // Returns the digest of the data so far. It does not change the state, so
+  // more data can be added after it.
+  ContentDigest Finalize() const;
+
+  static ContentDigest Hash(const void* data, size_t size);
+  static std::string HashToHexString(const void* data, size_t size) {
+    return Hash(data, size).ToHexString();
+  }
+
+ private:
+  void ConsumeStripes(const uint8_t* data, size_t count);
+
+  uint64_t acc_[kLaneCount];
+  uint8_t buffer_[kStripeSize];
+  size_t buffered_size_{0};
+  // Index of the next stripe in the current block.
+  size_t stripe_index_{0};
+  uint64_t total_size_{0};
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // BASE_INCLUDE_CONTENT_HASH_H_
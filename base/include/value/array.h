@@ -28,6 +28,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return nullptr;
     }
+    MarkMutated();
     return &vec_.emplace_back();
   }
 
@@ -35,6 +36,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     vec_.push_back(value);
     return true;
   }
@@ -43,6 +45,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     vec_.push_back(std::move(value));
     return true;
   }
@@ -52,6 +55,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     vec_.emplace_back(std::forward<Args>(args)...);
     return true;
   }
@@ -60,6 +64,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     if (vec_.size() > 0) vec_.pop_back();
     return true;
   }
@@ -68,6 +73,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
 
     if (idx >= 0 && idx < vec_.size()) {
       vec_.erase(vec_.begin() + idx);
@@ -79,6 +85,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
 
     auto begin = (start < vec_.size()) ? (vec_.begin() + start) : vec_.end();
     auto end =
@@ -92,6 +99,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
 
     if (idx >= 0) {
       vec_.insert(vec_.begin() + idx, value);
@@ -101,6 +109,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
 
   Value get_shift() {
     if (vec_.size() > 0) {
+      MarkMutated();
       Value ret = std::move(vec_[0]);
       vec_.erase(vec_.begin(), vec_.begin() + 1);
       return ret;
@@ -118,7 +127,10 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     return vec_[index];
   }
 
-  void resize(long size) { vec_.resize(size); }
+  void resize(long size) {
+    MarkMutated();
+    vec_.resize(size);
+  }
 
   void reserve(long size) { vec_.reserve(size); }
 
@@ -126,6 +138,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     if (static_cast<size_t>(index) >= vec_.size()) {
       resize(index + 1);
     }
@@ -137,6 +150,7 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
     if (static_cast<size_t>(index) >= vec_.size()) {
       resize(index + 1);
     }
@@ -150,6 +164,9 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
 
   size_t size() const { return vec_.size(); }
 
+  /// Incremented by every write through the methods of the array.
+  uint64_t generation() const { return generation_; }
+
   ~CArray() override = default;
 
   friend bool operator==(const CArray& left, const CArray& right) {
@@ -198,10 +215,14 @@ class BASE_EXPORT_FOR_DEVTOOL CArray : public RefCountedBase {
   void Reset() {
     vec_.clear();
     __padding__ = 0;
+    MarkMutated();
   }
 
  private:
+  BASE_INLINE void MarkMutated() { ++generation_; }
+
   base::InlineVector<Value, 6> vec_;
+  uint64_t generation_{0};
 
   friend class LEPUSValueHelper;
 
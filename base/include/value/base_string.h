@@ -235,8 +235,10 @@ class String {
   bool operator==(const String& other) const {
     auto* this_impl = UntagImpl(ref_impl_);
     auto* other_impl = UntagImpl(other.ref_impl_);
-    return this_impl->hash_ == other_impl->hash_ &&
-           this_impl->str() == other_impl->str();
+    // Interned strings share their impl, compare pointers first.
+    return this_impl == other_impl ||
+           (this_impl->hash_ == other_impl->hash_ &&
+            this_impl->str() == other_impl->str());
   }
   bool operator==(const char* other) const { return str() == other; }
   bool operator==(const std::string& other) const { return str() == other; }
@@ -244,8 +246,9 @@ class String {
   bool operator!=(const String& other) const {
     auto* this_impl = UntagImpl(ref_impl_);
     auto* other_impl = UntagImpl(other.ref_impl_);
-    return this_impl->hash_ != other_impl->hash_ ||
-           this_impl->str() != other_impl->str();
+    return this_impl != other_impl &&
+           (this_impl->hash_ != other_impl->hash_ ||
+            this_impl->str() != other_impl->str());
   }
   bool operator!=(const char* other) const { return str() != other; }
   bool operator!=(const std::string& other) const { return str() != other; }
@@ -173,6 +173,7 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public RefCountedBase {
     if (IsConstLog()) {
       return false;
     }
+    MarkMutated();
 
     auto& hash_map_no_op = reinterpret_cast<ValueNoOpCtorHashMap&>(hash_map_);
     auto [iterator, inserted] = hash_map_no_op.try_emplace(key);
@@ -222,7 +223,12 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public RefCountedBase {
 
   auto find(const base::String& key) const { return hash_map_.find(key); }
 
-  auto find(const base::String& key) { return hash_map_.find(key); }
+  /// Values may be written through the returned iterator, so it counts as a
+  /// write. Use the const overload for lookups.
+  auto find(const base::String& key) {
+    MarkMutated();
+    return hash_map_.find(key);
+  }
 
   size_t size() const { return hash_map_.size(); }
 
@@ -232,13 +238,20 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public RefCountedBase {
   /// based.
   auto cbegin() const { return hash_map_.cbegin(); }
   auto cend() const { return hash_map_.cend(); }
-  auto begin() { return hash_map_.begin(); }
+  auto begin() {
+    MarkMutated();
+    return hash_map_.begin();
+  }
   auto end() { return hash_map_.end(); }
   auto begin() const { return hash_map_.begin(); }
   auto end() const { return hash_map_.end(); }
 
   void Dump();
 
+  /// Incremented by every write through SetValue(), GetValueOrInsert(),
+  /// Erase() and the non-const iterators returned by find() and begin().
+  uint64_t generation() const { return generation_; }
+
   friend bool operator==(const Dictionary& left, const Dictionary& right);
 
   friend bool operator!=(const Dictionary& left, const Dictionary& right) {
@@ -265,10 +278,14 @@ class BASE_EXPORT_FOR_DEVTOOL Dictionary : public RefCountedBase {
   void Reset() {
     hash_map_.clear();
     __padding__ = 0;
+    MarkMutated();
   }
 
  private:
+  BASE_INLINE void MarkMutated() { ++generation_; }
+
   HashMap hash_map_;
+  uint64_t generation_{0};
 
   BASE_INLINE bool IsConstLog() const {
     if (IsConst()) {
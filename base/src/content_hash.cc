@@ -0,0 +1,203 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/content_hash.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace lynx {
+namespace base {
+
+namespace {
+
+constexpr uint64_t kPrime32_1 = 0x9e3779b1u;
+constexpr uint64_t kPrime32_2 = 0x85ebca77u;
+constexpr uint64_t kPrime32_3 = 0xc2b2ae3du;
+constexpr uint64_t kPrime64_1 = 0x9e3779b185ebca87ull;
+constexpr uint64_t kPrime64_2 = 0xc2b2ae3d27d4eb4full;
+constexpr uint64_t kPrime64_3 = 0x165667b19e3779f9ull;
+constexpr uint64_t kPrime64_4 = 0x85ebca77c2b2ae63ull;
+constexpr uint64_t kPrime64_5 = 0x27d4eb2f165667c5ull;
+
+// The n-th stripe of a block is mixed with kStripeKeys[n, n + 8), so that
+// equal stripes at different positions contribute differently.
+constexpr uint64_t kStripeKeys[ContentHasher::kStripesPerBlock +
+                               ContentHasher::kLaneCount] = {
+    0x6e789e6aa1b965f4ull, 0x06c45d188009454full, 0xf88bb8a8724c81ecull,
+    0x1b39896a51a8749bull, 0x53cb9f0c747ea2eaull, 0x2c829abe1f4532e1ull,
+    0xc584133ac916ab3cull, 0x3ee5789041c98ac3ull, 0xf3b8488c368cb0a6ull,
+    0x657eecdd3cb13d09ull, 0xc2d326e0055bdef6ull, 0x8621a03fe0bbdb7bull,
+    0x8e1f7555983aa92full, 0xb54e0f1600cc4d19ull, 0x84bb3f97971d80abull,
+    0x7d29825c75521255ull, 0xc3cf17102b7f7f86ull, 0x3466e9a083914f64ull,
+    0xd81a8d2b5a4485acull, 0xdb01602b100b9ed7ull, 0xa9038a921825f10dull,
+    0xedf5f1d90dca2f6aull, 0x54496ad67bd2634cull, 0xdd7c01d4f5407269ull,
+};
+
+constexpr uint64_t kScrambleKeys[ContentHasher::kLaneCount] = {
+    0x935e82f1db4c4f7bull, 0x69b82ebc92233300ull, 0x40d29eb57de1d510ull,
+    0xa2f09dabb45c6316ull, 0xee521d7a0f4d3872ull, 0xf16952ee72f3454full,
+    0x377d35dea8e40225ull, 0x0c7de8064963bab0ull,
+};
+
+constexpr uint64_t kMergeKeys[2 * ContentHasher::kLaneCount] = {
+    0x05582d37111ac529ull, 0xd254741f599dc6f7ull, 0x69630f7593d108c3ull,
+    0x417ef96181daa383ull, 0x3c3c41a3b43343a1ull, 0x6e19905dcbe531dfull,
+    0x4fa9fa7324851729ull, 0x84eb4454a792922aull, 0x134f7096918175ceull,
+    0x07dc930b302278a8ull, 0x12c015a97019e937ull, 0xcc06c31652ebf438ull,
+    0xecee65630a691e37ull, 0x3e84ecb1763e79adull, 0x690ed476743aae49ull,
+    0x774615d7b1a1f2e1ull,
+};
+
+inline uint64_t ReadLE64(const uint8_t* ptr) {
+  uint64_t value;
+  memcpy(&value, ptr, sizeof(value));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  value = __builtin_bswap64(value);
+#endif
+  return value;
+}
+
+inline uint64_t Mul128Fold64(uint64_t lhs, uint64_t rhs) {
+#if defined(__SIZEOF_INT128__)
+  const unsigned __int128 product =
+      static_cast<unsigned __int128>(lhs) * static_cast<unsigned __int128>(rhs);
+  return static_cast<uint64_t>(product) ^
+         static_cast<uint64_t>(product >> 64);
+#else
+  const uint64_t lo_lo = (lhs & 0xffffffff) * (rhs & 0xffffffff);
+  const uint64_t hi_lo = (lhs >> 32) * (rhs & 0xffffffff);
+  const uint64_t lo_hi = (lhs & 0xffffffff) * (rhs >> 32);
+  const uint64_t hi_hi = (lhs >> 32) * (rhs >> 32);
+  const uint64_t cross = (lo_lo >> 32) + (hi_lo & 0xffffffff) + lo_hi;
+  const uint64_t upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+  const uint64_t lower = (cross << 32) | (lo_lo & 0xffffffff);
+  return lower ^ upper;
+#endif
+}
+
+inline uint64_t Avalanche(uint64_t hash) {
+  hash ^= hash >> 37;
+  hash *= 0x165667919e3779f9ull;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+// Keep the lane loops simple, they are what the compiler vectorizes.
+inline void AccumulateStripe(uint64_t* __restrict acc,
+                             const uint8_t* __restrict stripe,
+                             const uint64_t* __restrict keys) {
+  for (size_t i = 0; i < ContentHasher::kLaneCount; ++i) {
+    const uint64_t data = ReadLE64(stripe + i * sizeof(uint64_t));
+    const uint64_t keyed = data ^ keys[i];
+    acc[i ^ 1] += data;
+    acc[i] += (keyed & 0xffffffff) * (keyed >> 32);
+  }
+}
+
+inline void ScrambleAccumulators(uint64_t* acc) {
+  for (size_t i = 0; i < ContentHasher::kLaneCount; ++i) {
+    uint64_t value = acc[i];
+    value ^= value >> 47;
+    value ^= kScrambleKeys[i];
+    value *= kPrime32_1;
+    acc[i] = value;
+  }
+}
+
+uint64_t MergeAccumulators(const uint64_t* acc, const uint64_t* keys,
+                           uint64_t start) {
+  uint64_t result = start;
+  for (size_t i = 0; i < ContentHasher::kLaneCount; i += 2) {
+    result += Mul128Fold64(acc[i] ^ keys[i], acc[i + 1] ^ keys[i + 1]);
+  }
+  return Avalanche(result);
+}
+
+}  // namespace
+
+std::string ContentDigest::ToHexString() const {
+  static constexpr char kHexDigits[] = "0123456789abcdef";
+  std::string result(32, '0');
+  for (size_t i = 0; i < 16; ++i) {
+    result[15 - i] = kHexDigits[(high >> (i * 4)) & 0xf];
+    result[31 - i] = kHexDigits[(low >> (i * 4)) & 0xf];
+  }
+  return result;
+}
+
+ContentHasher::ContentHasher()
+    : acc_{kPrime32_3, kPrime64_1, kPrime64_2, kPrime64_3,
+           kPrime64_4, kPrime32_2, kPrime64_5, kPrime32_1} {}
+
+void ContentHasher::Update(const void* data, size_t size) {
+  const auto* ptr = static_cast<const uint8_t*>(data);
+  total_size_ += size;
+
+  if (buffered_size_ > 0) {
+    const size_t count = std::min(size, kStripeSize - buffered_size_);
+    memcpy(buffer_ + buffered_size_, ptr, count);
+    buffered_size_ += count;
+    ptr += count;
+    size -= count;
+    if (buffered_size_ < kStripeSize) {
+      return;
+    }
+    ConsumeStripes(buffer_, 1);
+    buffered_size_ = 0;
+  }
+
+  const size_t stripe_count = size / kStripeSize;
+  ConsumeStripes(ptr, stripe_count);
+  ptr += stripe_count * kStripeSize;
+  size -= stripe_count * kStripeSize;
+
+  if (size > 0) {
+    memcpy(buffer_, ptr, size);
+    buffered_size_ = size;
+  }
+}
+
+ContentDigest ContentHasher::Finalize() const {
+  uint64_t acc[kLaneCount];
+  memcpy(acc, acc_, sizeof(acc));
+  if (buffered_size_ > 0) {
+    // The tail is padded with zeros, the total size tells it apart from an
+    // input which really ends with zeros.
+    uint8_t last_stripe[kStripeSize] = {};
+    memcpy(last_stripe, buffer_, buffered_size_);
+    AccumulateStripe(acc, last_stripe, kStripeKeys + stripe_index_);
+  }
+  ContentDigest digest;
+  digest.low = MergeAccumulators(acc, kMergeKeys, total_size_ * kPrime64_1);
+  digest.high = MergeAccumulators(acc, kMergeKeys + kLaneCount,
+                                  ~(total_size_ * kPrime64_2));
+  return digest;
+}
+
+ContentDigest ContentHasher::Hash(const void* data, size_t size) {
+  ContentHasher hasher;
+  hasher.Update(data, size);
+  return hasher.Finalize();
+}
+
+void ContentHasher::ConsumeStripes(const uint8_t* data, size_t count) {
+  while (count > 0) {
+    const size_t stripes =
+        std::min(count, kStripesPerBlock - stripe_index_);
+    for (size_t i = 0; i < stripes; ++i) {
+      AccumulateStripe(acc_, data, kStripeKeys + stripe_index_ + i);
+      data += kStripeSize;
+    }
+    stripe_index_ += stripes;
+    count -= stripes;
+    if (stripe_index_ == kStripesPerBlock) {
+      ScrambleAccumulators(acc_);
+      stripe_index_ = 0;
+    }
+  }
+}
+
+}  // namespace base
+}  // namespace lynx
@@ -0,0 +1,91 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/include/content_hash.h"
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+
+namespace {
+
+std::string HexDigest(const std::string& input) {
+  return ContentHasher::HashToHexString(input.data(), input.size());
+}
+
+std::string MakeInput(size_t size) {
+  std::string input(size, '\0');
+  uint32_t seed = 12345;
+  for (auto& c : input) {
+    seed = seed * 1103515245 + 12345;
+    c = static_cast<char>(seed >> 16);
+  }
+  return input;
+}
+
+}  // namespace
+
+TEST(ContentHasher, StableDigest) {
+  // The digest names cache files on disk, it must never change.
+  EXPECT_EQ(ContentHasher::HashToHexString("", 0),
+            ContentHasher::Hash(nullptr, 0).ToHexString());
+  EXPECT_EQ(ContentHasher::HashToHexString("", 0).size(), 32u);
+  const std::string input = "lynx";
+  EXPECT_EQ(HexDigest(input), "559c570e7f59d0c666bd1df245e9aea4");
+  auto large = MakeInput(5000);
+  EXPECT_EQ(HexDigest(large), "aea888e1c182f4a37a0f3c3cfc999914");
+}
+
+TEST(ContentHasher, IncrementalUpdateMatchesOneShot) {
+  auto input = MakeInput(3000);
+  auto expected = ContentHasher::Hash(input.data(), input.size());
+  for (size_t chunk : {1, 7, 63, 64, 65, 1000, 1024, 2999}) {
+    ContentHasher hasher;
+    for (size_t pos = 0; pos < input.size(); pos += chunk) {
+      hasher.Update(input.data() + pos, std::min(chunk, input.size() - pos));
+    }
+    EXPECT_EQ(hasher.Finalize(), expected) << "chunk " << chunk;
+  }
+
+  // Finalize does not change the state.
+  ContentHasher hasher;
+  hasher.Update(input.data(), 100);
+  EXPECT_EQ(hasher.Finalize(), ContentHasher::Hash(input.data(), 100));
+  hasher.Update(input.data() + 100, input.size() - 100);
+  EXPECT_EQ(hasher.Finalize(), expected);
+}
+
+TEST(ContentHasher, DistinguishesInputs) {
+  // Trailing zeros, which pad the last stripe.
+  std::unordered_set<std::string> digests;
+  for (size_t size = 0; size <= 130; ++size) {
+    EXPECT_TRUE(digests.insert(HexDigest(std::string(size, '\0'))).second)
+        << size;
+  }
+
+  // Every single bit flip of a multi-block input.
+  auto input = MakeInput(2100);
+  digests.clear();
+  digests.insert(HexDigest(input));
+  for (size_t pos = 0; pos < input.size(); pos += 97) {
+    for (int bit = 0; bit < 8; ++bit) {
+      input[pos] ^= static_cast<char>(1 << bit);
+      EXPECT_TRUE(digests.insert(HexDigest(input)).second);
+      input[pos] ^= static_cast<char>(1 << bit);
+    }
+  }
+
+  // Swapped stripes, the sums of the lanes alone would be equal.
+  const std::string x(64, 'x');
+  const std::string y(64, 'y');
+  EXPECT_NE(HexDigest(x + y), HexDigest(y + x));
+}
+
+}  // namespace base
+}  // namespace lynx
@@ -19,6 +19,7 @@ bool Dictionary::Erase(const base::String& key) {
   if (IsConstLog()) {
     return false;
   }
+  MarkMutated();
   hash_map_.erase(key);
   return true;
 }
@@ -27,6 +28,7 @@ int32_t Dictionary::EraseKey(const base::String& key) {
   if (IsConstLog()) {
     return -1;
   }
+  MarkMutated();
   return static_cast<int32_t>(hash_map_.erase(key));
 }
 
@@ -65,6 +67,7 @@ Dictionary::ValueWrapper Dictionary::GetValueOrInsert(const base::String& key) {
   if (IsConstLog()) {
     return ValueWrapper(nullptr);
   } else {
+    MarkMutated();
     return ValueWrapper(&hash_map_[key]);
   }
 }
@@ -73,6 +76,7 @@ Dictionary::ValueWrapper Dictionary::GetValueOrInsert(base::String&& key) {
   if (IsConstLog()) {
     return ValueWrapper(nullptr);
   } else {
+    MarkMutated();
     return ValueWrapper(&hash_map_[std::move(key)]);
   }
 }
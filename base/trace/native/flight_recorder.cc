@@ -0,0 +1,274 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/trace/native/flight_recorder.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <fstream>
+#include <utility>
+
+namespace lynx {
+namespace trace {
+
+namespace {
+
+// Marks the buffer of an exiting thread as reusable.
+class RetireBufferOnThreadExit {
+ public:
+  void Watch(FlightRecorderRingBuffer* buffer) { buffer_ = buffer; }
+  ~RetireBufferOnThreadExit();
+
+ private:
+  FlightRecorderRingBuffer* buffer_ = nullptr;
+};
+
+void AppendEscapedString(std::string& out, const std::string& value) {
+  for (char c : value) {
+    switch (c) {
+      case '"':
+        out.append("\\\"");
+        break;
+      case '\\':
+        out.append("\\\\");
+        break;
+      case '\n':
+        out.append("\\n");
+        break;
+      case '\t':
+        out.append("\\t");
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20) {
+          char escaped[8];
+          snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+          out.append(escaped);
+        } else {
+          out.push_back(c);
+        }
+        break;
+    }
+  }
+}
+
+const char* PhaseToString(FlightRecorderEvent::Phase phase) {
+  switch (phase) {
+    case FlightRecorderEvent::kBegin:
+      return "B";
+    case FlightRecorderEvent::kEnd:
+      return "E";
+    case FlightRecorderEvent::kInstant:
+      return "i";
+    case FlightRecorderEvent::kCounter:
+      return "C";
+  }
+  return "i";
+}
+
+}  // namespace
+
+FlightRecorderRingBuffer::FlightRecorderRingBuffer(uint32_t capacity)
+    : mask_(capacity - 1), events_(new FlightRecorderEvent[capacity]()) {}
+
+std::vector<FlightRecorderEvent> FlightRecorderRingBuffer::Snapshot() const {
+  std::vector<FlightRecorderEvent> result;
+  const uint64_t end = write_index_.load(std::memory_order_acquire);
+  const uint64_t size = std::min<uint64_t>(end, capacity());
+  const uint64_t begin = end - size;
+  result.reserve(size);
+  for (uint64_t i = begin; i < end; ++i) {
+    result.push_back(events_[i & mask_]);
+  }
+  // The slots the writer claimed again while copying, including the one it may
+  // still be filling, were overwritten and are dropped. A buffer that is
+  // exactly full and not written meanwhile keeps all its events.
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const uint64_t claimed = claimed_index_.load(std::memory_order_relaxed);
+  const uint64_t valid_begin = claimed > capacity() ? claimed - capacity() : 0;
+  if (valid_begin > begin) {
+    const uint64_t dropped = std::min<uint64_t>(valid_begin - begin, size);
+    result.erase(result.begin(), result.begin() + dropped);
+  }
+  return result;
+}
+
+RetireBufferOnThreadExit::~RetireBufferOnThreadExit() {
+  if (buffer_ != nullptr) {
+    buffer_->Retire();
+  }
+}
+
+FlightRecorder& FlightRecorder::Instance() {
+  // Intentionally leaked, threads may still record while statics are
+  // destroyed.
+  static FlightRecorder* instance = new FlightRecorder();
+  return *instance;
+}
+
+FlightRecorder::FlightRecorder() : enabled_(false) {
+  // Id 0 is reserved for unknown names.
+  names_.emplace_back("unknown");
+}
+
+uint32_t FlightRecorder::InternName(const std::string& name) {
+  std::lock_guard<std::mutex> lock(names_mutex_);
+  auto it = name_ids_.find(name);
+  if (it != name_ids_.end()) {
+    return it->second;
+  }
+  uint32_t id = static_cast<uint32_t>(names_.size());
+  names_.emplace_back(name);
+  name_ids_.emplace(name, id);
+  return id;
+}
+
+std::string FlightRecorder::NameForId(uint32_t name_id) {
+  std::lock_guard<std::mutex> lock(names_mutex_);
+  if (name_id >= names_.size()) {
+    return names_[0];
+  }
+  return names_[name_id];
+}
+
+FlightRecorderRingBuffer* FlightRecorder::AcquireBufferForCurrentThread() {
+  static thread_local RetireBufferOnThreadExit retire_on_exit;
+  FlightRecorderRingBuffer* buffer = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    for (auto& candidate : buffers_) {
+      if (candidate->retired_.load(std::memory_order_acquire)) {
+        buffer = candidate.get();
+        buffer->retired_.store(false, std::memory_order_relaxed);
+        buffer->write_index_.store(0, std::memory_order_release);
+        buffer->claimed_index_.store(0, std::memory_order_release);
+        buffer->thread_name_.clear();
+        break;
+      }
+    }
+    if (buffer == nullptr) {
+      buffers_.emplace_back(
+          std::make_unique<FlightRecorderRingBuffer>(kDefaultEventsPerThread));
+      buffer = buffers_.back().get();
+    }
+    buffer->set_thread_id(next_thread_id_++);
+  }
+  retire_on_exit.Watch(buffer);
+  return buffer;
+}
+
+void FlightRecorder::SetCurrentThreadName(const std::string& name) {
+  FlightRecorderRingBuffer* buffer = CurrentThreadBuffer();
+  std::lock_guard<std::mutex> lock(buffers_mutex_);
+  buffer->set_thread_name(name);
+}
+
+std::string FlightRecorder::DumpToString() {
+  struct ThreadEvents {
+    uint32_t thread_id;
+    std::string thread_name;
+    std::vector<FlightRecorderEvent> events;
+  };
+  std::vector<ThreadEvents> threads;
+  // Names are only appended, a copy resolves every event without locking.
+  std::vector<std::string> names;
+  {
+    std::lock_guard<std::mutex> lock(names_mutex_);
+    names = names_;
+  }
+  {
+    std::lock_guard<std::mutex> lock(buffers_mutex_);
+    threads.reserve(buffers_.size());
+    for (auto& buffer : buffers_) {
+      threads.push_back(
+          {buffer->thread_id(), buffer->thread_name(), buffer->Snapshot()});
+    }
+  }
+
+  std::string out;
+  out.append("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[");
+  bool first = true;
+  char number[96];
+  for (const auto& thread : threads) {
+    if (!thread.thread_name.empty()) {
+      out.append(first ? "" : ",");
+      first = false;
+      snprintf(number, sizeof(number),
+               "{\"ph\":\"M\",\"pid\":1,\"tid\":%u,\"name\":\"thread_name\","
+               "\"args\":{\"name\":\"",
+               thread.thread_id);
+      out.append(number);
+      AppendEscapedString(out, thread.thread_name);
+      out.append("\"}}");
+    }
+    for (const auto& event : thread.events) {
+      out.append(first ? "" : ",");
+      first = false;
+      out.append("{\"ph\":\"");
+      out.append(PhaseToString(event.phase));
+      out.append("\",\"name\":\"");
+      AppendEscapedString(
+          out, names[event.name_id < names.size() ? event.name_id : 0]);
+      // Trace event timestamps are expressed in microseconds.
+      snprintf(number, sizeof(number),
+               "\",\"pid\":1,\"tid\":%u,\"ts\":%" PRIu64 ".%03" PRIu64,
+               thread.thread_id, event.timestamp_ns / 1000,
+               event.timestamp_ns % 1000);
+      out.append(number);
+      if (event.phase == FlightRecorderEvent::kInstant) {
+        snprintf(number, sizeof(number),
+                 ",\"s\":\"t\",\"args\":{\"arg\":%" PRId64 "}", event.arg);
+        out.append(number);
+      } else if (event.phase == FlightRecorderEvent::kCounter) {
+        snprintf(number, sizeof(number), ",\"args\":{\"value\":%" PRId64 "}",
+                 event.arg);
+        out.append(number);
+      }
+      out.append("}");
+    }
+  }
+  out.append("]}");
+  return out;
+}
+
+bool FlightRecorder::DumpToFile(const std::string& file_path) {
+  std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+  file << DumpToString();
+  return file.good();
+}
+
+void FlightRecorder::SetLongTaskDumpDir(const std::string& dir) {
+  std::lock_guard<std::mutex> lock(dump_mutex_);
+  long_task_dump_dir_ = dir;
+}
+
+std::string FlightRecorder::NotifyLongTask(const std::string& task_name) {
+  if (!IsEnabled()) {
+    return "";
+  }
+  std::string file_path;
+  {
+    std::lock_guard<std::mutex> lock(dump_mutex_);
+    if (long_task_dump_dir_.empty()) {
+      return "";
+    }
+    const uint64_t now = NowNanoseconds();
+    if (last_long_task_dump_ns_ != 0 &&
+        now - last_long_task_dump_ns_ < kLongTaskDumpIntervalMs * 1000000) {
+      return "";
+    }
+    last_long_task_dump_ns_ = now;
+    file_path = long_task_dump_dir_ + "/lynx-flight-recorder-" +
+                std::to_string(now) + ".json";
+  }
+  TRACE_FLIGHT_EVENT_INSTANT("FlightRecorder::LongTask", 0);
+  Record(FlightRecorderEvent::kInstant, InternName(task_name));
+  return DumpToFile(file_path) ? file_path : "";
+}
+
+}  // namespace trace
+}  // namespace lynx
@@ -0,0 +1,232 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef BASE_TRACE_NATIVE_FLIGHT_RECORDER_H_
+#define BASE_TRACE_NATIVE_FLIGHT_RECORDER_H_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "base/include/compiler_specific.h"
+#include "base/trace/native/trace_export.h"
+
+namespace lynx {
+namespace trace {
+
+// Fixed-size binary record written by the flight recorder. Event names are
+// interned once and stored as ids so that a record never owns memory.
+struct FlightRecorderEvent {
+  enum Phase : uint8_t { kBegin = 0, kEnd, kInstant, kCounter };
+
+  uint64_t timestamp_ns;
+  int64_t arg;
+  uint32_t name_id;
+  Phase phase;
+  uint8_t padding[3];
+};
+
+static_assert(sizeof(FlightRecorderEvent) == 24,
+              "FlightRecorderEvent must stay compact.");
+
+// Single-producer ring buffer owned by one thread. The owner thread writes
+// without any lock: it claims the next index before filling the slot and
+// publishes it with a release store once the slot is complete. Readers take a
+// snapshot and discard the slots that the writer claimed again while they
+// were copying.
+class TRACE_EXPORT FlightRecorderRingBuffer {
+ public:
+  explicit FlightRecorderRingBuffer(uint32_t capacity);
+
+  FlightRecorderRingBuffer(const FlightRecorderRingBuffer&) = delete;
+  FlightRecorderRingBuffer& operator=(const FlightRecorderRingBuffer&) = delete;
+
+  ALWAYS_INLINE void Write(FlightRecorderEvent::Phase phase, uint32_t name_id,
+                           int64_t arg, uint64_t timestamp_ns) {
+    const uint64_t index = write_index_.load(std::memory_order_relaxed);
+    claimed_index_.store(index + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    FlightRecorderEvent& slot = events_[index & mask_];
+    slot.timestamp_ns = timestamp_ns;
+    slot.arg = arg;
+    slot.name_id = name_id;
+    slot.phase = phase;
+    write_index_.store(index + 1, std::memory_order_release);
+  }
+
+  // Copies the events that are still valid in the buffer in chronological
+  // order. Safe to call from any thread.
+  std::vector<FlightRecorderEvent> Snapshot() const;
+
+  uint32_t capacity() const { return mask_ + 1; }
+  uint64_t total_written() const {
+    return write_index_.load(std::memory_order_acquire);
+  }
+
+  uint32_t thread_id() const { return thread_id_; }
+  void set_thread_id(uint32_t thread_id) { thread_id_ = thread_id; }
+
+  const std::string& thread_name() const { return thread_name_; }
+  void set_thread_name(const std::string& name) { thread_name_ = name; }
+
+  // Called when the owner thread exits.
+  void Retire() { retired_.store(true, std::memory_order_release); }
+
+ private:
+  friend class FlightRecorder;
+
+  const uint32_t mask_;
+  std::unique_ptr<FlightRecorderEvent[]> events_;
+  // Number of events published.
+  std::atomic<uint64_t> write_index_{0};
+  // Number of events the writer started, one more than write_index_ while a
+  // slot is being filled.
+  std::atomic<uint64_t> claimed_index_{0};
+  uint32_t thread_id_ = 0;
+  std::string thread_name_;
+  // Set when the owner thread exits, the buffer is then handed to the next
+  // thread that starts recording.
+  std::atomic<bool> retired_{false};
+};
+
+// Always-on, low overhead recorder of engine activity. Every thread writes
+// into its own lock-free ring buffer, the buffers can be dumped on demand or
+// when a long task is detected. The dump uses the JSON trace event format
+// which can be opened directly by ui.perfetto.dev.
+class TRACE_EXPORT FlightRecorder {
+ public:
+  // Number of events kept per thread, must be a power of two.
+  static constexpr uint32_t kDefaultEventsPerThread = 16384;
+  // Minimum interval between two dumps triggered by long tasks.
+  static constexpr uint64_t kLongTaskDumpIntervalMs = 10000;
+
+  static FlightRecorder& Instance();
+
+  FlightRecorder(const FlightRecorder&) = delete;
+  FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+  ALWAYS_INLINE bool IsEnabled() const {
+    return enabled_.load(std::memory_order_relaxed);
+  }
+  void SetEnabled(bool enabled) {
+    enabled_.store(enabled, std::memory_order_relaxed);
+  }
+
+  // Returns a stable id for name. Callers are expected to cache the result,
+  // the TRACE_FLIGHT_* macros do this with a function-local static.
+  uint32_t InternName(const std::string& name);
+  std::string NameForId(uint32_t name_id);
+
+  ALWAYS_INLINE void Record(FlightRecorderEvent::Phase phase, uint32_t name_id,
+                            int64_t arg = 0) {
+    if (UNLIKELY(!IsEnabled())) {
+      return;
+    }
+    CurrentThreadBuffer()->Write(phase, name_id, arg, NowNanoseconds());
+  }
+
+  // Names the calling thread in the dumped trace.
+  void SetCurrentThreadName(const std::string& name);
+
+  // Serializes the content of all ring buffers.
+  std::string DumpToString();
+  bool DumpToFile(const std::string& file_path);
+
+  // Directory used for dumps triggered by NotifyLongTask(). Dumping on long
+  // tasks is disabled while the directory is empty.
+  void SetLongTaskDumpDir(const std::string& dir);
+  // Called by the long task monitor. Dumps the buffers into the long task dump
+  // dir, rate limited by kLongTaskDumpIntervalMs. Returns the path of the
+  // file written, or an empty string if nothing was dumped.
+  std::string NotifyLongTask(const std::string& task_name);
+
+  static ALWAYS_INLINE uint64_t NowNanoseconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+  }
+
+ private:
+  FlightRecorder();
+  ~FlightRecorder() = default;
+
+  ALWAYS_INLINE FlightRecorderRingBuffer* CurrentThreadBuffer() {
+    static thread_local FlightRecorderRingBuffer* buffer = nullptr;
+    if (UNLIKELY(buffer == nullptr)) {
+      buffer = AcquireBufferForCurrentThread();
+    }
+    return buffer;
+  }
+  FlightRecorderRingBuffer* AcquireBufferForCurrentThread();
+
+  std::atomic<bool> enabled_;
+
+  std::mutex names_mutex_;
+  std::unordered_map<std::string, uint32_t> name_ids_;
+  std::vector<std::string> names_;
+
+  std::mutex buffers_mutex_;
+  std::vector<std::unique_ptr<FlightRecorderRingBuffer>> buffers_;
+  uint32_t next_thread_id_ = 1;
+
+  std::mutex dump_mutex_;
+  std::string long_task_dump_dir_;
+  uint64_t last_long_task_dump_ns_ = 0;
+};
+
+// Records a BEGIN event and the matching END event when leaving the scope.
+class ScopedFlightEvent {
+ public:
+  ALWAYS_INLINE explicit ScopedFlightEvent(uint32_t name_id)
+      : name_id_(name_id) {
+    FlightRecorder::Instance().Record(FlightRecorderEvent::kBegin, name_id_);
+  }
+  ALWAYS_INLINE ~ScopedFlightEvent() {
+    FlightRecorder::Instance().Record(FlightRecorderEvent::kEnd, name_id_);
+  }
+
+  ScopedFlightEvent(const ScopedFlightEvent&) = delete;
+  ScopedFlightEvent& operator=(const ScopedFlightEvent&) = delete;
+
+ private:
+  const uint32_t name_id_;
+};
+
+}  // namespace trace
+}  // namespace lynx
+
+#define INTERNAL_FLIGHT_EVENT_UID3(a, b) flight_event_uid_##a##b
+#define INTERNAL_FLIGHT_EVENT_UID2(a, b) INTERNAL_FLIGHT_EVENT_UID3(a, b)
+#define INTERNAL_FLIGHT_EVENT_UID(name) \
+  INTERNAL_FLIGHT_EVENT_UID2(name, __LINE__)
+
+// |name| must be a string literal or another constant string, it is interned
+// only once per call site.
+#define INTERNAL_FLIGHT_EVENT_NAME_ID(name)                                \
+  ([]() {                                                                  \
+    static const uint32_t id =                                             \
+        lynx::trace::FlightRecorder::Instance().InternName(name);          \
+    return id;                                                             \
+  }())
+
+#define TRACE_FLIGHT_EVENT(name)                              \
+  lynx::trace::ScopedFlightEvent INTERNAL_FLIGHT_EVENT_UID(   \
+      scoped_flight_event)(INTERNAL_FLIGHT_EVENT_NAME_ID(name))
+
+#define TRACE_FLIGHT_EVENT_INSTANT(name, arg)                              \
+  lynx::trace::FlightRecorder::Instance().Record(                          \
+      lynx::trace::FlightRecorderEvent::kInstant,                          \
+      INTERNAL_FLIGHT_EVENT_NAME_ID(name), static_cast<int64_t>(arg))
+
+#define TRACE_FLIGHT_COUNTER(name, value)                                  \
+  lynx::trace::FlightRecorder::Instance().Record(                          \
+      lynx::trace::FlightRecorderEvent::kCounter,                          \
+      INTERNAL_FLIGHT_EVENT_NAME_ID(name), static_cast<int64_t>(value))
+
+#endif  // BASE_TRACE_NATIVE_FLIGHT_RECORDER_H_
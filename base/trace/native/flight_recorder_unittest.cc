@@ -0,0 +1,135 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "base/trace/native/flight_recorder.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace trace {
+
+TEST(FlightRecorderTest, RingBufferKeepsLatestEvents) {
+  FlightRecorderRingBuffer buffer(8);
+  for (int i = 0; i < 20; ++i) {
+    buffer.Write(FlightRecorderEvent::kInstant, 1, i, i);
+  }
+  auto events = buffer.Snapshot();
+  ASSERT_EQ(events.size(), 8u);
+  for (size_t i = 0; i < events.size(); ++i) {
+    EXPECT_EQ(events[i].arg, static_cast<int64_t>(12 + i));
+  }
+  EXPECT_EQ(buffer.total_written(), 20u);
+}
+
+TEST(FlightRecorderTest, RingBufferExactlyFullKeepsAllEvents) {
+  FlightRecorderRingBuffer buffer(8);
+  for (int i = 0; i < 8; ++i) {
+    buffer.Write(FlightRecorderEvent::kInstant, 1, i, 100 + i);
+  }
+  auto events = buffer.Snapshot();
+  ASSERT_EQ(events.size(), 8u);
+  for (size_t i = 0; i < events.size(); ++i) {
+    EXPECT_EQ(events[i].arg, static_cast<int64_t>(i));
+    EXPECT_EQ(events[i].timestamp_ns, 100 + i);
+  }
+
+  // One more event overwrites exactly the oldest one.
+  buffer.Write(FlightRecorderEvent::kCounter, 2, 8, 108);
+  events = buffer.Snapshot();
+  ASSERT_EQ(events.size(), 8u);
+  EXPECT_EQ(events.front().arg, 1);
+  EXPECT_EQ(events.back().arg, 8);
+  EXPECT_EQ(events.back().phase, FlightRecorderEvent::kCounter);
+  EXPECT_EQ(events.back().name_id, 2u);
+}
+
+TEST(FlightRecorderTest, RingBufferPartiallyFilled) {
+  FlightRecorderRingBuffer buffer(8);
+  buffer.Write(FlightRecorderEvent::kBegin, 1, 0, 10);
+  buffer.Write(FlightRecorderEvent::kEnd, 1, 0, 20);
+  auto events = buffer.Snapshot();
+  ASSERT_EQ(events.size(), 2u);
+  EXPECT_EQ(events[0].phase, FlightRecorderEvent::kBegin);
+  EXPECT_EQ(events[1].timestamp_ns, 20u);
+}
+
+TEST(FlightRecorderTest, InternNameIsStable) {
+  auto& recorder = FlightRecorder::Instance();
+  uint32_t id = recorder.InternName("FlightRecorderTest::Intern");
+  EXPECT_NE(id, 0u);
+  EXPECT_EQ(id, recorder.InternName("FlightRecorderTest::Intern"));
+  EXPECT_EQ(recorder.NameForId(id), "FlightRecorderTest::Intern");
+}
+
+TEST(FlightRecorderTest, DisabledRecorderWritesNothing) {
+  auto& recorder = FlightRecorder::Instance();
+  recorder.SetEnabled(false);
+  { TRACE_FLIGHT_EVENT("FlightRecorderTest::Disabled"); }
+  EXPECT_EQ(recorder.DumpToString().find("FlightRecorderTest::Disabled"),
+            std::string::npos);
+}
+
+TEST(FlightRecorderTest, DumpContainsEventsOfAllThreads) {
+  auto& recorder = FlightRecorder::Instance();
+  recorder.SetEnabled(true);
+  { TRACE_FLIGHT_EVENT("FlightRecorderTest::Main"); }
+  std::thread worker([&recorder]() {
+    recorder.SetCurrentThreadName("flight_worker");
+    TRACE_FLIGHT_EVENT("FlightRecorderTest::Worker");
+    TRACE_FLIGHT_COUNTER("FlightRecorderTest::Counter", 42);
+  });
+  worker.join();
+  std::string dump = recorder.DumpToString();
+  recorder.SetEnabled(false);
+
+  EXPECT_EQ(dump.find("{\"displayTimeUnit\""), 0u);
+  EXPECT_NE(dump.find("FlightRecorderTest::Main"), std::string::npos);
+  EXPECT_NE(dump.find("FlightRecorderTest::Worker"), std::string::npos);
+  EXPECT_NE(dump.find("\"value\":42"), std::string::npos);
+  EXPECT_NE(dump.find("flight_worker"), std::string::npos);
+}
+
+TEST(FlightRecorderTest, DumpKeepsLatestEventsInOrderAfterWraparound) {
+  auto& recorder = FlightRecorder::Instance();
+  recorder.SetEnabled(true);
+  constexpr int kOverflow = 10;
+  constexpr int kCount = FlightRecorder::kDefaultEventsPerThread + kOverflow;
+  std::thread worker([]() {
+    for (int i = 0; i < kCount; ++i) {
+      TRACE_FLIGHT_COUNTER("FlightRecorderTest::Wraparound", i);
+    }
+  });
+  worker.join();
+  std::string dump = recorder.DumpToString();
+  recorder.SetEnabled(false);
+
+  const std::string name = "\"name\":\"FlightRecorderTest::Wraparound\"";
+  const std::string value = "\"value\":";
+  std::vector<int64_t> values;
+  for (size_t pos = dump.find(name); pos != std::string::npos;
+       pos = dump.find(name, pos + name.size())) {
+    size_t value_pos = dump.find(value, pos);
+    ASSERT_NE(value_pos, std::string::npos);
+    values.push_back(std::stoll(dump.substr(value_pos + value.size())));
+  }
+  ASSERT_EQ(values.size(), FlightRecorder::kDefaultEventsPerThread);
+  for (size_t i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(values[i], static_cast<int64_t>(kOverflow + i));
+  }
+}
+
+TEST(FlightRecorderTest, LongTaskDumpRequiresDir) {
+  auto& recorder = FlightRecorder::Instance();
+  recorder.SetEnabled(true);
+  recorder.SetLongTaskDumpDir("");
+  EXPECT_TRUE(recorder.NotifyLongTask("task").empty());
+  recorder.SetEnabled(false);
+}
+
+}  // namespace trace
+}  // namespace lynx
@@ -0,0 +1,271 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/base/threading/frame_scheduler.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/include/fml/time/time_delta.h"
+#include "base/include/fml/time/time_point.h"
+#include "base/include/log/logging.h"
+
+namespace lynx {
+namespace base {
+
+namespace {
+
+constexpr int64_t kNanosPerMilli = 1000 * 1000;
+// Used when the vsync does not carry a valid frame interval.
+constexpr int64_t kDefaultFrameDuration = 16 * kNanosPerMilli;
+
+}  // namespace
+
+int64_t FrameScheduler::Deadline::RemainingNanos() const {
+  return deadline_ - scheduler_->Now();
+}
+
+FrameScheduler::FrameScheduler(fml::RefPtr<fml::TaskRunner> runner,
+                               std::shared_ptr<VSyncMonitor> monitor,
+                               Clock clock)
+    : runner_(std::move(runner)),
+      monitor_(std::move(monitor)),
+      clock_(std::move(clock)) {
+  // Leave room for the rendering of the frame.
+  budgets_[static_cast<size_t>(Lane::kVisibleUpdate)] = 8 * kNanosPerMilli;
+  budgets_[static_cast<size_t>(Lane::kIdle)] = 4 * kNanosPerMilli;
+}
+
+int64_t FrameScheduler::Now() const {
+  if (clock_) {
+    return clock_();
+  }
+  return fml::TimePoint::Now().ToEpochDelta().ToNanoseconds();
+}
+
+void FrameScheduler::PostTask(Lane lane, Task task) {
+  if (!task) {
+    return;
+  }
+  Enqueue(lane, {std::move(task), nullptr});
+}
+
+void FrameScheduler::PostSlicedTask(Lane lane, SlicedTask task) {
+  if (!task) {
+    return;
+  }
+  Enqueue(lane, {nullptr, std::move(task)});
+}
+
+void FrameScheduler::SetLaneBudget(Lane lane, int64_t budget_nanos) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  budgets_[static_cast<size_t>(lane)] = std::max<int64_t>(budget_nanos, 0);
+}
+
+size_t FrameScheduler::PendingTaskCount(Lane lane) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return lanes_[static_cast<size_t>(lane)].size();
+}
+
+bool FrameScheduler::HasPendingTasks() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return std::any_of(lanes_.begin(), lanes_.end(),
+                     [](const auto& lane) { return !lane.empty(); });
+}
+
+void FrameScheduler::Enqueue(Lane lane, Item item) {
+  DCHECK(lane < Lane::kCount);
+  item.enqueue_time = Now();
+  bool post_run = false;
+  bool post_idle_timeout = false;
+  bool request_frame = false;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    lanes_[static_cast<size_t>(lane)].emplace_back(std::move(item));
+    if (lane == Lane::kIdle) {
+      post_idle_timeout = !idle_timeout_posted_;
+      idle_timeout_posted_ = true;
+      request_frame = !frame_requested_;
+      frame_requested_ = true;
+    } else {
+      post_run = !run_posted_;
+      run_posted_ = true;
+    }
+  }
+  if (post_run) {
+    runner_->PostTask([weak_self = weak_from_this()]() {
+      if (auto self = weak_self.lock()) {
+        self->RunVisibleUpdates();
+      }
+    });
+  }
+  if (post_idle_timeout) {
+    PostIdleTimeout(kMaxIdleDelay);
+  }
+  if (!request_frame) {
+    return;
+  }
+  if (runner_->RunsTasksOnCurrentThread()) {
+    RequestFrame();
+    return;
+  }
+  runner_->PostTask([weak_self = weak_from_this()]() {
+    if (auto self = weak_self.lock()) {
+      self->RequestFrame();
+    }
+  });
+}
+
+void FrameScheduler::RequestFrame() {
+  monitor_->ScheduleVSyncSecondaryCallback(
+      reinterpret_cast<uintptr_t>(this),
+      [weak_self = weak_from_this()](int64_t frame_start_time,
+                                     int64_t frame_target_time) {
+        if (auto self = weak_self.lock()) {
+          self->RunFrame(frame_start_time, frame_target_time);
+        }
+      });
+}
+
+void FrameScheduler::RunFrame(int64_t frame_start_time,
+                              int64_t frame_target_time) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    frame_requested_ = false;
+  }
+  int64_t frame_duration = frame_target_time - frame_start_time;
+  if (frame_duration <= 0) {
+    frame_duration = kDefaultFrameDuration;
+  }
+  // The vsync timestamps may come from another clock, only the interval is
+  // used.
+  const int64_t frame_deadline = Now() + frame_duration;
+
+  for (size_t i = 0; i < static_cast<size_t>(Lane::kCount); ++i) {
+    const auto lane = static_cast<Lane>(i);
+    int64_t budget = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      budget = budgets_[i];
+    }
+    const int64_t now = Now();
+    const int64_t lane_deadline =
+        budget > 0 ? std::min(now + budget, frame_deadline) : frame_deadline;
+    // Every lane but the idle one makes progress in every frame, even when
+    // the frame is already over. So does the idle lane once its oldest task
+    // waited too long.
+    RunLane(lane, lane_deadline,
+            lane != Lane::kIdle || IsIdleTaskOverdue(now));
+  }
+  RequestFrameIfPending();
+}
+
+void FrameScheduler::RequestFrameIfPending() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const bool has_pending =
+        std::any_of(lanes_.begin(), lanes_.end(),
+                    [](const auto& lane) { return !lane.empty(); });
+    if (!has_pending || frame_requested_) {
+      return;
+    }
+    frame_requested_ = true;
+  }
+  RequestFrame();
+}
+
+void FrameScheduler::RunVisibleUpdates() {
+  int64_t budget = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    run_posted_ = false;
+    budget = budgets_[static_cast<size_t>(Lane::kVisibleUpdate)];
+  }
+  if (budget <= 0) {
+    budget = kDefaultFrameDuration;
+  }
+  RunLane(Lane::kVisibleUpdate, Now() + budget, true);
+  // Unfinished sliced tasks resume in the next frame.
+  RequestFrameIfPending();
+}
+
+void FrameScheduler::PostIdleTimeout(int64_t delay) {
+  runner_->PostDelayedTask(
+      [weak_self = weak_from_this()]() {
+        if (auto self = weak_self.lock()) {
+          self->RunOverdueIdleTasks();
+        }
+      },
+      fml::TimeDelta::FromNanoseconds(delay));
+}
+
+void FrameScheduler::RunOverdueIdleTasks() {
+  int64_t now = Now();
+  if (IsIdleTaskOverdue(now)) {
+    int64_t budget = 0;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      budget = budgets_[static_cast<size_t>(Lane::kIdle)];
+    }
+    RunLane(Lane::kIdle, now + budget, true);
+    now = Now();
+  }
+
+  int64_t delay = 0;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto& queue = lanes_[static_cast<size_t>(Lane::kIdle)];
+    if (queue.empty()) {
+      idle_timeout_posted_ = false;
+      return;
+    }
+    // At least one frame apart, an overdue sliced task gets one slice each.
+    delay = std::max(queue.front().enqueue_time + kMaxIdleDelay - now,
+                     kDefaultFrameDuration);
+  }
+  PostIdleTimeout(delay);
+}
+
+bool FrameScheduler::IsIdleTaskOverdue(int64_t now) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto& queue = lanes_[static_cast<size_t>(Lane::kIdle)];
+  return !queue.empty() && now - queue.front().enqueue_time >= kMaxIdleDelay;
+}
+
+void FrameScheduler::RunLane(Lane lane, int64_t lane_deadline,
+                             bool at_least_one) {
+  auto& queue = lanes_[static_cast<size_t>(lane)];
+  bool first = true;
+  while (true) {
+    if (!(first && at_least_one) && Now() >= lane_deadline) {
+      return;
+    }
+    first = false;
+
+    Item item;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (queue.empty()) {
+        return;
+      }
+      item = std::move(queue.front());
+      queue.pop_front();
+    }
+
+    if (item.task) {
+      item.task();
+      continue;
+    }
+    if (item.sliced_task(Deadline(this, lane_deadline))) {
+      continue;
+    }
+    // Not finished, resume it first in the next frame.
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue.emplace_front(std::move(item));
+    return;
+  }
+}
+
+}  // namespace base
+}  // namespace lynx
@@ -0,0 +1,121 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_BASE_THREADING_FRAME_SCHEDULER_H_
+#define CORE_BASE_THREADING_FRAME_SCHEDULER_H_
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+
+#include "base/include/closure.h"
+#include "base/include/fml/task_runner.h"
+#include "core/base/threading/vsync_monitor.h"
+
+namespace lynx {
+namespace base {
+
+// Runs work in lanes with their own time budgets. Visible updates run as soon
+// as they are posted, idle work only runs in the time left in vsync aligned
+// frames, so it is never in the way of the visible content. Long work can be
+// split across frames as a sliced task, which resumes in the next frame.
+//
+// Tasks can be posted from any thread, they run on the thread of runner,
+// which should be the thread the VSyncMonitor is bound to, e.g. the vsync
+// runner of the UI thread.
+class FrameScheduler : public std::enable_shared_from_this<FrameScheduler> {
+ public:
+  enum class Lane : uint8_t {
+    // Runs right away, it does not wait for the next vsync.
+    kVisibleUpdate = 0,
+    // Offscreen and idle work, only runs in the time left by the other lanes
+    // in vsync frames, or once it waited for kMaxIdleDelay.
+    kIdle,
+
+    // ADDED_BEFORE!!
+    kCount
+  };
+
+  // Lets sliced tasks yield before they run out of the lane budget.
+  class Deadline {
+   public:
+    Deadline(const FrameScheduler* scheduler, int64_t deadline)
+        : scheduler_(scheduler), deadline_(deadline) {}
+
+    int64_t RemainingNanos() const;
+    bool ShouldYield() const { return RemainingNanos() <= 0; }
+
+   private:
+    const FrameScheduler* scheduler_;
+    int64_t deadline_;
+  };
+
+  // Bounds the wait of idle tasks when frames have no time left, or when no
+  // vsync comes at all, e.g. in background.
+  static constexpr int64_t kMaxIdleDelay = 500 * 1000 * 1000;
+
+  using Task = base::closure;
+  // Returns true when the work is done, false to be resumed in the next
+  // frame.
+  using SlicedTask = base::MoveOnlyClosure<bool, const Deadline&>;
+  // Returns a monotonic time in nanoseconds.
+  using Clock = base::MoveOnlyClosure<int64_t>;
+
+  FrameScheduler(fml::RefPtr<fml::TaskRunner> runner,
+                 std::shared_ptr<VSyncMonitor> monitor,
+                 Clock clock = nullptr);
+  ~FrameScheduler() = default;
+
+  FrameScheduler(const FrameScheduler&) = delete;
+  FrameScheduler& operator=(const FrameScheduler&) = delete;
+
+  void PostTask(Lane lane, Task task);
+  void PostSlicedTask(Lane lane, SlicedTask task);
+
+  // The budget of a lane in every frame, 0 lets it run until the end of the
+  // frame.
+  void SetLaneBudget(Lane lane, int64_t budget_nanos);
+
+  size_t PendingTaskCount(Lane lane);
+  bool HasPendingTasks();
+
+  // Runs the lanes for the frame [frame_start_time, frame_target_time] in
+  // nanoseconds. Called on vsync, exposed for tests.
+  void RunFrame(int64_t frame_start_time, int64_t frame_target_time);
+
+ private:
+  struct Item {
+    Task task;
+    SlicedTask sliced_task;
+    int64_t enqueue_time{0};
+  };
+
+  int64_t Now() const;
+  void Enqueue(Lane lane, Item item);
+  void RequestFrame();
+  void RequestFrameIfPending();
+  void RunVisibleUpdates();
+  void PostIdleTimeout(int64_t delay);
+  void RunOverdueIdleTasks();
+  bool IsIdleTaskOverdue(int64_t now);
+  void RunLane(Lane lane, int64_t lane_deadline, bool at_least_one);
+
+  fml::RefPtr<fml::TaskRunner> runner_;
+  std::shared_ptr<VSyncMonitor> monitor_;
+  mutable Clock clock_;
+
+  std::mutex mutex_;
+  std::array<std::deque<Item>, static_cast<size_t>(Lane::kCount)> lanes_;
+  std::array<int64_t, static_cast<size_t>(Lane::kCount)> budgets_{};
+  bool frame_requested_{false};
+  bool run_posted_{false};
+  bool idle_timeout_posted_{false};
+};
+
+}  // namespace base
+}  // namespace lynx
+
+#endif  // CORE_BASE_THREADING_FRAME_SCHEDULER_H_
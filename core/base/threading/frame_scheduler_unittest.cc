@@ -0,0 +1,178 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/base/threading/frame_scheduler.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/include/fml/synchronization/waitable_event.h"
+#include "base/include/fml/thread.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace base {
+namespace testing {
+
+namespace {
+
+constexpr int64_t kMillis = 1000 * 1000;
+constexpr int64_t kFrameDuration = 16 * kMillis;
+
+class TestVSyncMonitor : public VSyncMonitor {
+ public:
+  TestVSyncMonitor() = default;
+  ~TestVSyncMonitor() override = default;
+
+  void RequestVSync() override { ++request_count_; }
+
+  void TriggerVsync() {
+    OnVSync(current_, current_ + kFrameDuration);
+    current_ += kFrameDuration;
+  }
+
+  int request_count() const { return request_count_; }
+
+ private:
+  int64_t current_ = kFrameDuration;
+  int request_count_ = 0;
+};
+
+}  // namespace
+
+class FrameSchedulerTest : public ::testing::Test {
+ protected:
+  FrameSchedulerTest() : thread_("FRAME_SCHEDULER_TEST") {}
+  ~FrameSchedulerTest() override = default;
+
+  void SetUp() override {
+    monitor_ = std::make_shared<TestVSyncMonitor>();
+    monitor_->BindTaskRunner(thread_.GetTaskRunner());
+    scheduler_ = std::make_shared<FrameScheduler>(
+        thread_.GetTaskRunner(), monitor_, [this]() { return now_; });
+  }
+
+  void TearDown() override {
+    thread_.GetTaskRunner()->PostSyncTask([this]() { scheduler_.reset(); });
+  }
+
+  void RunOnThread(base::closure task) {
+    thread_.GetTaskRunner()->PostSyncTask(std::move(task));
+  }
+
+  fml::Thread thread_;
+  int64_t now_ = 0;
+  std::shared_ptr<TestVSyncMonitor> monitor_;
+  std::shared_ptr<FrameScheduler> scheduler_;
+};
+
+TEST_F(FrameSchedulerTest, VisibleUpdatesDoNotWaitForVSync) {
+  using Lane = FrameScheduler::Lane;
+  std::vector<std::string> order;
+  RunOnThread([this, &order]() {
+    scheduler_->PostTask(Lane::kIdle, [&order]() { order.push_back("idle"); });
+    scheduler_->PostTask(Lane::kVisibleUpdate,
+                         [&order]() { order.push_back("update"); });
+    EXPECT_EQ(monitor_->request_count(), 1);
+    EXPECT_TRUE(order.empty());
+  });
+  RunOnThread([this, &order]() {
+    EXPECT_EQ(order, (std::vector<std::string>{"update"}));
+    EXPECT_EQ(monitor_->request_count(), 1);
+
+    monitor_->TriggerVsync();
+    EXPECT_EQ(order, (std::vector<std::string>{"update", "idle"}));
+    EXPECT_FALSE(scheduler_->HasPendingTasks());
+  });
+}
+
+TEST_F(FrameSchedulerTest, SlicedTaskYieldsAcrossFrames) {
+  using Lane = FrameScheduler::Lane;
+  int processed = 0;
+  static constexpr int kTotal = 10;
+  RunOnThread([this, &processed]() {
+    scheduler_->SetLaneBudget(Lane::kVisibleUpdate, 4 * kMillis);
+    scheduler_->PostSlicedTask(
+        Lane::kVisibleUpdate,
+        [this, &processed](const FrameScheduler::Deadline& deadline) {
+          while (processed < kTotal) {
+            if (deadline.ShouldYield()) {
+              return false;
+            }
+            now_ += kMillis;
+            ++processed;
+          }
+          return true;
+        });
+  });
+  RunOnThread([this, &processed]() {
+    EXPECT_EQ(processed, 4);
+    EXPECT_EQ(scheduler_->PendingTaskCount(Lane::kVisibleUpdate), 1u);
+    EXPECT_EQ(monitor_->request_count(), 1);
+
+    monitor_->TriggerVsync();
+    EXPECT_EQ(processed, 8);
+
+    monitor_->TriggerVsync();
+    EXPECT_EQ(processed, kTotal);
+    EXPECT_FALSE(scheduler_->HasPendingTasks());
+  });
+}
+
+TEST_F(FrameSchedulerTest, IdleLaneRunsOnlyWithTimeLeft) {
+  RunOnThread([this]() {
+    using Lane = FrameScheduler::Lane;
+    bool idle_run = false;
+    scheduler_->PostTask(Lane::kIdle, [this]() { now_ += kFrameDuration; });
+    scheduler_->PostTask(Lane::kIdle, [&idle_run]() { idle_run = true; });
+
+    monitor_->TriggerVsync();
+    EXPECT_FALSE(idle_run);
+    EXPECT_EQ(scheduler_->PendingTaskCount(Lane::kIdle), 1u);
+
+    monitor_->TriggerVsync();
+    EXPECT_TRUE(idle_run);
+    EXPECT_FALSE(scheduler_->HasPendingTasks());
+  });
+}
+
+TEST_F(FrameSchedulerTest, IdleLaneRunsOnceOverdueInBusyFrames) {
+  RunOnThread([this]() {
+    using Lane = FrameScheduler::Lane;
+    bool idle_run = false;
+    scheduler_->PostTask(Lane::kIdle, [&idle_run]() { idle_run = true; });
+    // Takes the whole frame, every frame.
+    scheduler_->SetLaneBudget(Lane::kVisibleUpdate, 0);
+    scheduler_->PostSlicedTask(Lane::kVisibleUpdate,
+                               [this](const FrameScheduler::Deadline&) {
+                                 now_ += kFrameDuration;
+                                 return false;
+                               });
+
+    int frames = 0;
+    while (!idle_run && frames < 100) {
+      monitor_->TriggerVsync();
+      ++frames;
+      EXPECT_EQ(idle_run, now_ >= FrameScheduler::kMaxIdleDelay);
+    }
+    EXPECT_TRUE(idle_run);
+  });
+}
+
+TEST_F(FrameSchedulerTest, IdleLaneRunsOnceOverdueWithoutVSync) {
+  fml::AutoResetWaitableEvent idle_run;
+  RunOnThread([this, &idle_run]() {
+    scheduler_->PostTask(FrameScheduler::Lane::kIdle,
+                         [&idle_run]() { idle_run.Signal(); });
+    now_ = FrameScheduler::kMaxIdleDelay;
+  });
+  // No vsync comes, e.g. in background.
+  idle_run.Wait();
+  EXPECT_EQ(monitor_->request_count(), 1);
+}
+
+}  // namespace testing
+}  // namespace base
+}  // namespace lynx
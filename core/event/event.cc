@@ -39,6 +39,7 @@ Event::Event(const std::string& type, int64_t time_stamp, EventType event_type,
              PhaseType phase_type)
     : time_stamp_(time_stamp),
       type_(type),
+      type_atom_(EventTypeAtomTable::Intern(type)),
       event_type_(event_type),
       bubbles_(bubbles == Bubbles::kYes),
       cancelable_(cancelable == Cancelable::kYes),
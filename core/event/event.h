@@ -33,6 +33,7 @@
 #include <vector>
 
 #include "core/event/event_dispatch_result.h"
+#include "core/event/event_type_atom.h"
 
 namespace lynx {
 namespace event {
@@ -88,6 +89,7 @@ class Event {
   virtual ~Event() = default;
 
   const std::string& type() const { return type_; }
+  EventTypeAtom type_atom() const { return type_atom_; }
   EventType event_type() { return event_type_; }
 
   PhaseType event_phase() const { return event_phase_; }
@@ -114,6 +116,7 @@ class Event {
  private:
   int64_t time_stamp_;
   std::string type_;
+  EventTypeAtom type_atom_;
 
   EventType event_type_;
 
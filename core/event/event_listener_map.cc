@@ -38,6 +38,7 @@
 
 #include <algorithm>
 #include <tuple>
+#include <utility>
 
 namespace lynx {
 namespace event {
@@ -57,6 +58,12 @@ bool EventListenerMap::IsEmpty() const {
 }
 
 bool EventListenerMap::Contains(const std::string& type) const {
+  // A type that has never been interned can't have listeners.
+  EventTypeAtom atom = EventTypeAtomTable::Find(type);
+  return atom != EventTypeAtomTable::kInvalidAtom && Contains(atom);
+}
+
+bool EventListenerMap::Contains(EventTypeAtom type) const {
   for (const auto& pair : map_) {
     if (pair.first == type) {
       return true;
@@ -68,6 +75,12 @@ bool EventListenerMap::Contains(const std::string& type) const {
 bool EventListenerMap::Add(const std::string& type,
                            std::shared_ptr<EventListener> listener,
                            const AddOptions& options) {
+  return Add(EventTypeAtomTable::Intern(type), std::move(listener), options);
+}
+
+bool EventListenerMap::Add(EventTypeAtom type,
+                           std::shared_ptr<EventListener> listener,
+                           const AddOptions& options) {
   EventListenerVector* vector = Find(type);
   if (vector == nullptr) {
     vector = &map_.emplace_back(std::piecewise_construct,
@@ -80,6 +93,15 @@ bool EventListenerMap::Add(const std::string& type,
 
 bool EventListenerMap::Remove(const std::string& type,
                               std::shared_ptr<EventListener> listener) {
+  EventTypeAtom atom = EventTypeAtomTable::Find(type);
+  if (atom == EventTypeAtomTable::kInvalidAtom) {
+    return false;
+  }
+  return Remove(atom, std::move(listener));
+}
+
+bool EventListenerMap::Remove(EventTypeAtom type,
+                              std::shared_ptr<EventListener> listener) {
   EventListenerVector* vector = Find(type);
   if (!vector || vector->empty()) {
     return false;
@@ -100,6 +122,14 @@ bool EventListenerMap::Remove(const std::string& type,
 }
 
 EventListenerVector* EventListenerMap::Find(const std::string& type) {
+  EventTypeAtom atom = EventTypeAtomTable::Find(type);
+  if (atom == EventTypeAtomTable::kInvalidAtom) {
+    return nullptr;
+  }
+  return Find(atom);
+}
+
+EventListenerVector* EventListenerMap::Find(EventTypeAtom type) {
   for (auto& pair : map_) {
     if (pair.first == type) {
       return &(pair.second);
@@ -41,6 +41,7 @@
 
 #include "base/include/vector.h"
 #include "core/event/event_listener.h"
+#include "core/event/event_type_atom.h"
 
 #ifndef CORE_EVENT_EVENT_LISTENER_MAP_H_
 #define CORE_EVENT_EVENT_LISTENER_MAP_H_
@@ -61,15 +62,24 @@ class EventListenerMap {
   void Clear();
   bool IsEmpty() const;
   bool Contains(const std::string& type) const;
+  bool Contains(EventTypeAtom type) const;
 
+  // Listeners are keyed by the atom of their event type, the string overloads
+  // resolve the atom once and forward to the atom overloads.
   bool Add(const std::string& type, std::shared_ptr<EventListener> listener,
            const AddOptions& options = AddOptions());
+  bool Add(EventTypeAtom type, std::shared_ptr<EventListener> listener,
+           const AddOptions& options = AddOptions());
   bool Remove(const std::string& type, std::shared_ptr<EventListener> listener);
+  bool Remove(EventTypeAtom type, std::shared_ptr<EventListener> listener);
 
   EventListenerVector* Find(const std::string& type);
+  EventListenerVector* Find(EventTypeAtom type);
 
  private:
-  base::InlineVector<std::pair<std::string, EventListenerVector>, 2> map_;
+  base::InlineVector<std::pair<EventTypeAtom, EventListenerVector>, 2> map_;
+  // Keeps the atoms of map_ valid.
+  EventTypeAtomTable::Scope atom_scope_;
 };
 
 }  // namespace event
@@ -47,7 +47,7 @@ EventTarget::EventTarget()
     : event_listener_map_(std::make_unique<EventListenerMap>()) {}
 
 DispatchEventResult EventTarget::DispatchEvent(Event& event) {
-  auto vector = event_listener_map_->Find(event.type());
+  auto vector = event_listener_map_->Find(event.type_atom());
   if (vector == nullptr) {
     return {EventCancelType::kNotCanceled, false};
   }
@@ -0,0 +1,116 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/event/event_type_atom.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "base/include/no_destructor.h"
+
+namespace lynx {
+namespace event {
+
+namespace {
+
+struct AtomStorage {
+  std::shared_mutex mutex;
+  size_t scope_count{0};
+  // The atom of names.front(). It grows when the table is emptied, so that
+  // atoms are never reused.
+  EventTypeAtom first_atom{1};
+  // std::deque never relocates its elements, the string views used as keys
+  // of |atoms| stay valid.
+  std::deque<base::String> names;
+  std::unordered_map<base::static_string::GenericCacheKey, EventTypeAtom>
+      atoms;
+};
+
+AtomStorage& GetAtomStorage() {
+  static base::NoDestructor<AtomStorage> storage;
+  return *storage;
+}
+
+EventTypeAtom InternKey(const base::static_string::GenericCacheKey& key,
+                        const base::String* source) {
+  auto& storage = GetAtomStorage();
+  {
+    std::shared_lock<std::shared_mutex> lock(storage.mutex);
+    auto it = storage.atoms.find(key);
+    if (it != storage.atoms.end()) {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(storage.mutex);
+  auto it = storage.atoms.find(key);
+  if (it != storage.atoms.end()) {
+    return it->second;
+  }
+  auto atom =
+      storage.first_atom + static_cast<EventTypeAtom>(storage.names.size());
+  if (source != nullptr) {
+    storage.names.emplace_back(*source);
+  } else {
+    storage.names.emplace_back(key.content.data(), key.content.size());
+  }
+  storage.atoms.emplace(storage.names.back(), atom);
+  return atom;
+}
+
+}  // namespace
+
+EventTypeAtom EventTypeAtomTable::Intern(std::string_view type) {
+  if (type.empty()) {
+    return kInvalidAtom;
+  }
+  return InternKey(
+      base::static_string::GenericCacheKey(type.data(), type.size()), nullptr);
+}
+
+EventTypeAtom EventTypeAtomTable::Intern(const base::String& type) {
+  if (type.empty()) {
+    return kInvalidAtom;
+  }
+  return InternKey(base::static_string::GenericCacheKey(type), &type);
+}
+
+EventTypeAtom EventTypeAtomTable::Find(std::string_view type) {
+  auto& storage = GetAtomStorage();
+  std::shared_lock<std::shared_mutex> lock(storage.mutex);
+  auto it = storage.atoms.find(
+      base::static_string::GenericCacheKey(type.data(), type.size()));
+  return it == storage.atoms.end() ? kInvalidAtom : it->second;
+}
+
+base::String EventTypeAtomTable::Name(EventTypeAtom atom) {
+  auto& storage = GetAtomStorage();
+  std::shared_lock<std::shared_mutex> lock(storage.mutex);
+  if (atom < storage.first_atom ||
+      atom - storage.first_atom >= storage.names.size()) {
+    return base::String();
+  }
+  return storage.names[atom - storage.first_atom];
+}
+
+EventTypeAtomTable::Scope::Scope() {
+  auto& storage = GetAtomStorage();
+  std::unique_lock<std::shared_mutex> lock(storage.mutex);
+  ++storage.scope_count;
+}
+
+EventTypeAtomTable::Scope::~Scope() {
+  auto& storage = GetAtomStorage();
+  std::unique_lock<std::shared_mutex> lock(storage.mutex);
+  if (--storage.scope_count > 0) {
+    return;
+  }
+  storage.first_atom += static_cast<EventTypeAtom>(storage.names.size());
+  storage.atoms.clear();
+  storage.names.clear();
+}
+
+}  // namespace event
+}  // namespace lynx
@@ -0,0 +1,70 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_EVENT_EVENT_TYPE_ATOM_H_
+#define CORE_EVENT_EVENT_TYPE_ATOM_H_
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include "base/include/value/base_string.h"
+
+namespace lynx {
+namespace event {
+
+// Integer id of an event type name such as "tap" or "touchmove". Event names
+// are resolved to atoms once, when a listener is registered or when an event
+// enters the dispatcher, so that the bubble and capture chains only compare
+// integers.
+//
+// The table lives as long as the pages using it: pages and event listener
+// maps hold a Scope, and the table is emptied when the last Scope is gone,
+// so that the custom event names of closed pages do not accumulate. Atoms
+// are not reused after that, an atom interned before matches nothing.
+using EventTypeAtom = uint32_t;
+
+class EventTypeAtomTable {
+ public:
+  static constexpr EventTypeAtom kInvalidAtom = 0;
+
+  EventTypeAtomTable() = delete;
+
+  class Scope {
+   public:
+    Scope();
+    ~Scope();
+    Scope(const Scope&) : Scope() {}
+    Scope& operator=(const Scope&) { return *this; }
+  };
+
+  // Returns the atom of |type|, registering it if needed. Thread safe.
+  static EventTypeAtom Intern(std::string_view type);
+  static EventTypeAtom Intern(const base::String& type);
+  static EventTypeAtom Intern(const std::string& type) {
+    return Intern(std::string_view(type));
+  }
+  static EventTypeAtom Intern(const char* type) {
+    return Intern(std::string_view(type));
+  }
+
+  // Returns kInvalidAtom if |type| has never been interned.
+  static EventTypeAtom Find(std::string_view type);
+
+  // Returns the canonical string of |atom|. All the strings returned for the
+  // same atom share one RefCountedStringImpl, so base::String comparisons
+  // between them succeed on the pointer check.
+  static base::String Name(EventTypeAtom atom);
+
+  // Shortcut of Name(Intern(type)), used to build handler map keys.
+  template <typename T>
+  static base::String CanonicalName(const T& type) {
+    return Name(Intern(type));
+  }
+};
+
+}  // namespace event
+}  // namespace lynx
+
+#endif  // CORE_EVENT_EVENT_TYPE_ATOM_H_
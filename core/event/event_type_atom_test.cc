@@ -0,0 +1,59 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/event/event_type_atom.h"
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace event {
+namespace test {
+
+TEST(EventTypeAtomTest, InternIsStable) {
+  EXPECT_EQ(EventTypeAtomTable::Find("atom_test_not_interned"),
+            EventTypeAtomTable::kInvalidAtom);
+  auto atom = EventTypeAtomTable::Intern("atom_test_tap");
+  EXPECT_NE(atom, EventTypeAtomTable::kInvalidAtom);
+  EXPECT_EQ(EventTypeAtomTable::Intern(std::string("atom_test_tap")), atom);
+  EXPECT_EQ(EventTypeAtomTable::Intern(base::String("atom_test_tap")), atom);
+  EXPECT_EQ(EventTypeAtomTable::Find("atom_test_tap"), atom);
+  EXPECT_NE(EventTypeAtomTable::Intern("atom_test_touchmove"), atom);
+  EXPECT_EQ(EventTypeAtomTable::Name(atom).str(), "atom_test_tap");
+}
+
+TEST(EventTypeAtomTest, EmptyTypeIsInvalid) {
+  EXPECT_EQ(EventTypeAtomTable::Intern(""), EventTypeAtomTable::kInvalidAtom);
+  EXPECT_TRUE(EventTypeAtomTable::Name(EventTypeAtomTable::kInvalidAtom)
+                  .empty());
+}
+
+TEST(EventTypeAtomTest, CanonicalNameSharesImpl) {
+  const auto& name0 = EventTypeAtomTable::CanonicalName("atom_test_scroll");
+  const auto& name1 =
+      EventTypeAtomTable::CanonicalName(base::String("atom_test_scroll"));
+  EXPECT_EQ(&name0.str(), &name1.str());
+  EXPECT_TRUE(name0 == name1);
+}
+
+TEST(EventTypeAtomTest, LastScopeEmptiesTable) {
+  EventTypeAtom atom = EventTypeAtomTable::kInvalidAtom;
+  {
+    EventTypeAtomTable::Scope scope;
+    EventTypeAtomTable::Scope copied(scope);
+    atom = EventTypeAtomTable::Intern("atom_test_page_event");
+    EXPECT_EQ(EventTypeAtomTable::Find("atom_test_page_event"), atom);
+  }
+  EXPECT_EQ(EventTypeAtomTable::Find("atom_test_page_event"),
+            EventTypeAtomTable::kInvalidAtom);
+  EXPECT_TRUE(EventTypeAtomTable::Name(atom).empty());
+
+  EventTypeAtomTable::Scope scope;
+  auto reinterned = EventTypeAtomTable::Intern("atom_test_page_event");
+  EXPECT_NE(reinterned, atom);
+  EXPECT_EQ(EventTypeAtomTable::Name(reinterned).str(), "atom_test_page_event");
+}
+
+}  // namespace test
+}  // namespace event
+}  // namespace lynx
@@ -3,15 +3,100 @@
 // LICENSE file in the root directory of this source tree.
 #include "core/renderer/css/css_style_sheet_manager.h"
 
+#include <algorithm>
+
 #include "base/trace/native/trace_event.h"
 #include "core/renderer/css/css_fragment.h"
 #include "core/renderer/trace/renderer_trace_event_def.h"
+#include "core/renderer/utils/lynx_env.h"
 
 namespace lynx {
 namespace tasm {
 // app.ttss
 static uint32_t sBasicCSSId = 0;
 
+namespace {
+// Innermost scope of the current thread.
+thread_local CSSStyleSheetManager::ReadScope* sCurrentReadScope = nullptr;
+}  // namespace
+
+CSSStyleSheetManager::ReadScope::ReadScope() : outer_(sCurrentReadScope) {
+  sCurrentReadScope = this;
+}
+
+CSSStyleSheetManager::ReadScope::~ReadScope() {
+  sCurrentReadScope = outer_;
+  for (auto& pinned : pinned_) {
+    auto& index = *pinned.index;
+    index.LeaveReadEpoch(pinned.epoch);
+    // Releases the fragments this scope was the last to hold back, without
+    // waiting for the writer.
+    if (index.has_retired_fragments.load()) {
+      std::unique_lock<std::mutex> lock(index.mutex, std::try_to_lock);
+      if (lock.owns_lock()) {
+        index.ReclaimRetiredFragmentsLocked();
+      }
+    }
+  }
+}
+
+void CSSStyleSheetManager::ReadScope::Pin(
+    const std::shared_ptr<FragmentIndex>& index) {
+  if (sCurrentReadScope == nullptr) {
+    return;
+  }
+  for (auto* scope = sCurrentReadScope; scope != nullptr;
+       scope = scope->outer_) {
+    for (const auto& pinned : scope->pinned_) {
+      if (pinned.index == index) {
+        return;
+      }
+    }
+  }
+  sCurrentReadScope->pinned_.push_back(
+      PinnedIndex{index, index->EnterReadEpoch()});
+}
+
+uint64_t CSSStyleSheetManager::FragmentIndex::EnterReadEpoch() {
+  while (true) {
+    const uint64_t epoch = read_epoch.load();
+    read_scope_counts_[epoch & 1].fetch_add(1);
+    if (read_epoch.load() == epoch) {
+      return epoch;
+    }
+    // The epoch moved on meanwhile, the writer may have missed this scope.
+    read_scope_counts_[epoch & 1].fetch_sub(1);
+  }
+}
+
+void CSSStyleSheetManager::FragmentIndex::LeaveReadEpoch(uint64_t epoch) {
+  read_scope_counts_[epoch & 1].fetch_sub(1);
+}
+
+uint64_t CSSStyleSheetManager::FragmentIndex::TryAdvanceEpoch() {
+  uint64_t epoch = read_epoch.load();
+  // The scopes of the previous epoch share the parity of the next one.
+  if (read_scope_counts_[(epoch + 1) & 1].load() == 0 &&
+      read_epoch.compare_exchange_strong(epoch, epoch + 1)) {
+    return epoch + 1;
+  }
+  return epoch;
+}
+
+void CSSStyleSheetManager::FragmentIndex::ReclaimRetiredFragmentsLocked() {
+  // A scope which may have read a fragment retired in epoch E entered in E
+  // at the latest, it is gone once the epoch reached E + 2.
+  TryAdvanceEpoch();
+  const uint64_t epoch = TryAdvanceEpoch();
+  retired_fragments.erase(
+      std::remove_if(retired_fragments.begin(), retired_fragments.end(),
+                     [epoch](const auto& retired_fragment) {
+                       return retired_fragment.epoch + 2 <= epoch;
+                     }),
+      retired_fragments.end());
+  has_retired_fragments.store(!retired_fragments.empty());
+}
+
 SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheetForComponent(
     int32_t id) {
   // Actually this function can be fully replaced by
@@ -31,11 +116,13 @@ SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheetForPage(int32_t id) {
     if (it != page_fragments_.end() && it->second->is_baked()) {
       return it->second.get();
     }
-    auto fragment = std::make_unique<SharedCSSFragment>(id, this);
-    fragment->ImportOtherFragment(GetCSSStyleSheet(sBasicCSSId));
+    auto fragment = std::make_shared<SharedCSSFragment>(id, this);
+    std::vector<std::shared_ptr<SharedCSSFragment>> imports{
+        GetCSSStyleSheetRef(sBasicCSSId)};
     if (id > 0) {
-      fragment->ImportOtherFragment(GetCSSStyleSheet(id));
+      imports.push_back(GetCSSStyleSheetRef(id));
     }
+    ImportFragments(fragment.get(), std::move(imports));
     fragment->MarkBaked();
     auto ptr = fragment.get();
     page_fragments_[id] = std::move(fragment);
@@ -43,48 +130,229 @@ SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheetForPage(int32_t id) {
   }
 }
 
+CSSStyleSheetManager::FragmentIndex::~FragmentIndex() {
+  for (auto& chunk : chunks_) {
+    delete chunk.load(std::memory_order_relaxed);
+  }
+}
+
+CSSStyleSheetManager::FragmentIndex::Slot*
+CSSStyleSheetManager::FragmentIndex::GetSlot(int32_t id, bool create) {
+  if (id < 0 || id >= kIndexedIdCount) {
+    return nullptr;
+  }
+  auto& chunk_ptr = chunks_[id / kChunkSize];
+  Chunk* chunk = chunk_ptr.load(std::memory_order_acquire);
+  if (chunk == nullptr) {
+    if (!create) {
+      return nullptr;
+    }
+    Chunk* new_chunk = new Chunk();
+    if (chunk_ptr.compare_exchange_strong(chunk, new_chunk,
+                                          std::memory_order_acq_rel,
+                                          std::memory_order_acquire)) {
+      chunk = new_chunk;
+    } else {
+      // Another thread installed the chunk first.
+      delete new_chunk;
+    }
+  }
+  return &chunk->slots[id % kChunkSize];
+}
+
+SharedCSSFragment* CSSStyleSheetManager::GetSharedCSSFragmentById(int32_t id) {
+  ReadScope::Pin(fragment_index_);
+  auto* slot = fragment_index_->GetSlot(id, true);
+  if (slot != nullptr) {
+    if (!slot->requested.load(std::memory_order_relaxed)) {
+      slot->requested.store(true, std::memory_order_relaxed);
+    }
+    SharedCSSFragment* fragment =
+        slot->fragment.load(std::memory_order_acquire);
+    if (fragment != nullptr) {
+      return fragment;
+    }
+  }
+
+  std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+  if (slot == nullptr) {
+    fragment_index_->requested_ids.emplace(id);
+  }
+  auto fragment_iter = raw_fragments_->find(id);
+  SharedCSSFragment* fragment = fragment_iter != raw_fragments_->end()
+                                    ? fragment_iter->second.get()
+                                    : nullptr;
+  if (slot != nullptr && fragment != nullptr) {
+    slot->fragment.store(fragment, std::memory_order_release);
+  }
+  return fragment;
+}
+
+bool CSSStyleSheetManager::IsSharedCSSFragmentDecoded(int32_t id) {
+  auto* slot = fragment_index_->GetSlot(id, false);
+  if (slot != nullptr) {
+    return slot->requested.load(std::memory_order_relaxed);
+  }
+  std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+  return fragment_index_->requested_ids.find(id) !=
+         fragment_index_->requested_ids.end();
+}
+
+void CSSStyleSheetManager::AddSharedCSSFragment(
+    std::shared_ptr<SharedCSSFragment> fragment) {
+  const int32_t id = fragment->id();
+  std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+  auto result = raw_fragments_->emplace(id, std::move(fragment));
+  if (auto* slot = fragment_index_->GetSlot(id, true)) {
+    slot->fragment.store(result.first->second.get(),
+                         std::memory_order_release);
+  }
+}
+
+void CSSStyleSheetManager::ReplaceSharedCSSFragment(
+    std::shared_ptr<SharedCSSFragment> fragment) {
+  const int32_t id = fragment->id();
+  {
+    std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+    // Unpublished before being retired, so that no reader entering later can
+    // find the old fragment.
+    if (auto* slot = fragment_index_->GetSlot(id, true)) {
+      slot->fragment.store(fragment.get());
+    }
+    RetireSharedCSSFragmentLocked(id);
+    raw_fragments_->insert_or_assign(id, std::move(fragment));
+  }
+  ReclaimRetiredFragments();
+}
+
+void CSSStyleSheetManager::RemoveSharedCSSFragment(int32_t id) {
+  {
+    std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+    if (auto* slot = fragment_index_->GetSlot(id, false)) {
+      slot->fragment.store(nullptr);
+    }
+    RetireSharedCSSFragmentLocked(id);
+    raw_fragments_->erase(id);
+  }
+  ReclaimRetiredFragments();
+}
+
+void CSSStyleSheetManager::RetireSharedCSSFragmentLocked(int32_t id) {
+  auto it = raw_fragments_->find(id);
+  if (it != raw_fragments_->end() && it->second != nullptr) {
+    fragment_index_->retired_fragments.push_back(
+        {fragment_index_->read_epoch.load(), std::move(it->second)});
+    fragment_index_->has_retired_fragments.store(true);
+  }
+}
+
+void CSSStyleSheetManager::ReclaimRetiredFragments() {
+  std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+  fragment_index_->ReclaimRetiredFragmentsLocked();
+}
+
 SharedCSSFragment* CSSStyleSheetManager::GetCSSStyleSheet(int32_t id) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, STYLE_SHEET_MANAGER_GET_STYLE_SHEET);
   SharedCSSFragment* fragment = GetSharedCSSFragmentById(id);
   if (fragment == nullptr) {
-    if (delegate_ && delegate_->DecodeCSSFragmentById(id)) {
-      fragment = GetSharedCSSFragmentById(id);
-    } else {
+    if (delegate_ == nullptr) {
       return nullptr;
     }
+    auto* slot = fragment_index_->GetSlot(id, false);
+    std::unique_lock<std::mutex> install_lock;
+    if (slot != nullptr) {
+      install_lock = std::unique_lock<std::mutex>(slot->install_mutex);
+      // Decoded by another thread while waiting.
+      fragment = GetSharedCSSFragmentById(id);
+    }
+    if (fragment == nullptr) {
+      if (!delegate_->DecodeCSSFragmentById(id)) {
+        return nullptr;
+      }
+      fragment = GetSharedCSSFragmentById(id);
+    }
   }
   if (fragment == nullptr || fragment->is_baked()) {
     return fragment;
   }
-  FlatDependentCSS(fragment);
+  EnsureFragmentBaked(fragment, id);
   return fragment;
 }
 
+std::shared_ptr<SharedCSSFragment> CSSStyleSheetManager::GetCSSStyleSheetRef(
+    int32_t id) {
+  SharedCSSFragment* fragment = GetCSSStyleSheet(id);
+  if (fragment == nullptr) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> g_lock(fragment_index_->mutex);
+  auto it = raw_fragments_->find(id);
+  if (it == raw_fragments_->end() || it->second.get() != fragment) {
+    // Replaced in the meantime, the caller imports the current one later.
+    return nullptr;
+  }
+  return it->second;
+}
+
+void CSSStyleSheetManager::EnsureFragmentBaked(SharedCSSFragment* fragment,
+                                               int32_t id) {
+  auto* slot = fragment_index_->GetSlot(id, false);
+  if (slot == nullptr) {
+    if (!fragment->is_baked()) {
+      FlatDependentCSS(fragment);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> install_lock(slot->install_mutex);
+  if (!fragment->is_baked()) {
+    FlatDependentCSS(fragment);
+  }
+}
+
 void CSSStyleSheetManager::FlatDependentCSS(SharedCSSFragment* fragment) {
   const auto& dependents = fragment->dependent_ids();
+  std::vector<std::shared_ptr<SharedCSSFragment>> imports;
+  imports.reserve(dependents.size());
   if (fragment->enable_css_selector() && fix_css_import_rule_order_) {
     std::for_each(dependents.begin(), dependents.end(), [&](int32_t id) {
-      fragment->ImportOtherFragment(GetCSSStyleSheet(id));
+      imports.push_back(GetCSSStyleSheetRef(id));
     });
   } else {
     // FIXME(linxs:) Retaining the logic below to avoid breaking changes,
     // although it is incorrect...
     std::for_each(dependents.rbegin(), dependents.rend(), [&](int32_t id) {
-      fragment->ImportOtherFragment(GetCSSStyleSheet(id));
+      imports.push_back(GetCSSStyleSheetRef(id));
     });
   }
+  ImportFragments(fragment, std::move(imports));
   fragment->MarkBaked();
 }
 
+void CSSStyleSheetManager::ImportFragments(
+    SharedCSSFragment* fragment,
+    std::vector<std::shared_ptr<SharedCSSFragment>> imports) {
+  // Class merge rewrites the imported tokens, it still needs the copies.
+  if (LynxEnv::GetInstance().EnableLayeredCSSFragment() &&
+      !fragment->enable_class_merge()) {
+    fragment->ImportFragmentLayers(std::move(imports));
+    return;
+  }
+  for (const auto& import : imports) {
+    fragment->ImportOtherFragment(import.get());
+  }
+}
+
 void CSSStyleSheetManager::FlattenAllCSSFragment() {
   std::for_each(raw_fragments_->begin(), raw_fragments_->end(),
                 [this](const auto& fragment) {
-                  this->FlatDependentCSS(fragment.second.get());
+                  this->EnsureFragmentBaked(fragment.second.get(),
+                                            fragment.first);
                 });
 }
 
 void CSSStyleSheetManager::CopyFrom(const CSSStyleSheetManager& other) {
   raw_fragments_ = other.raw_fragments_;
+  fragment_index_ = other.fragment_index_;
   enable_new_import_rule_ = other.enable_new_import_rule_;
 }
 
@@ -5,12 +5,15 @@
 #ifndef CORE_RENDERER_CSS_CSS_STYLE_SHEET_MANAGER_H_
 #define CORE_RENDERER_CSS_CSS_STYLE_SHEET_MANAGER_H_
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
+#include "base/include/vector.h"
 #include "core/renderer/css/shared_css_fragment.h"
 #include "core/template_bundle/template_codec/binary_decoder/page_config.h"
 #include "core/template_bundle/template_codec/moulds.h"
@@ -27,12 +30,16 @@ class CSSStyleSheetDelegate {
 };
 
 class CSSStyleSheetManager {
+ private:
+  class FragmentIndex;
+
  public:
   using CSSFragmentMap =
-      std::unordered_map<int32_t, std::unique_ptr<SharedCSSFragment>>;
+      std::unordered_map<int32_t, std::shared_ptr<SharedCSSFragment>>;
 
   CSSStyleSheetManager(CSSStyleSheetDelegate* delegate)
       : raw_fragments_(std::make_shared<CSSFragmentMap>()),
+        fragment_index_(std::make_shared<FragmentIndex>()),
         delegate_(delegate){};
 
   SharedCSSFragment* GetCSSStyleSheetForComponent(int32_t id);
@@ -42,36 +49,47 @@ class CSSStyleSheetManager {
 
   void SetThreadStopFlag(bool stop_thread) { stop_thread_ = stop_thread; }
 
-  SharedCSSFragment* GetSharedCSSFragmentById(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    decoded_fragment_.emplace(id);
-    auto fragment_iter = raw_fragments_->find(id);
-    return fragment_iter != raw_fragments_->end() ? fragment_iter->second.get()
-                                                  : nullptr;
-  }
+  // Pins the shared CSS fragments looked up by the current thread while
+  // alive. A fragment replaced or removed is freed only once every scope
+  // which may have looked it up is gone. Each manager keeps its own grace
+  // period: a scope only holds back the managers it actually read from, it
+  // enters their epoch on its first lookup. The thread replacing the
+  // fragments does not need one, the other threads take one per task
+  // resolving styles.
+  class ReadScope {
+   public:
+    ReadScope();
+    ~ReadScope();
 
-  bool IsSharedCSSFragmentDecoded(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    if (decoded_fragment_.find(id) != decoded_fragment_.end()) {
-      return true;
-    }
-    return false;
-  }
+    ReadScope(const ReadScope&) = delete;
+    ReadScope& operator=(const ReadScope&) = delete;
 
-  void AddSharedCSSFragment(std::unique_ptr<SharedCSSFragment> fragment) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->emplace(fragment->id(), std::move(fragment));
-  }
+   private:
+    friend class CSSStyleSheetManager;
 
-  void ReplaceSharedCSSFragment(std::unique_ptr<SharedCSSFragment> fragment) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->insert_or_assign(fragment->id(), std::move(fragment));
-  }
+    // Enters the epoch of index unless the scopes of the calling thread
+    // already did. Does nothing outside of a scope.
+    static void Pin(const std::shared_ptr<FragmentIndex>& index);
 
-  void RemoveSharedCSSFragment(int32_t id) {
-    std::lock_guard<std::mutex> g_lock(fragment_mutex_);
-    raw_fragments_->erase(id);
-  }
+    struct PinnedIndex {
+      std::shared_ptr<FragmentIndex> index;
+      uint64_t epoch;
+    };
+    base::InlineVector<PinnedIndex, 2> pinned_;
+    ReadScope* outer_;
+  };
+
+  // Lock free once the fragment has been looked up, safe to call from the
+  // parallel resolving threads within a ReadScope.
+  SharedCSSFragment* GetSharedCSSFragmentById(int32_t id);
+
+  bool IsSharedCSSFragmentDecoded(int32_t id);
+
+  void AddSharedCSSFragment(std::shared_ptr<SharedCSSFragment> fragment);
+
+  void ReplaceSharedCSSFragment(std::shared_ptr<SharedCSSFragment> fragment);
+
+  void RemoveSharedCSSFragment(int32_t id);
 
   void SetEnableNewImportRule(bool enable) { enable_new_import_rule_ = enable; }
 
@@ -101,16 +119,101 @@ class CSSStyleSheetManager {
   friend class LynxBinaryBaseCSSReader;
   friend class LynxBinaryReader;
 
+  // Index over raw_fragments_ for lock free lookups. Fragment ids in
+  // [0, kIndexedIdCount) map to slots that are allocated by chunks on first
+  // use and only released with the index, so a reader needs two atomic loads
+  // and never observes freed memory. Fragments inserted in raw_fragments_
+  // without going through the manager, e.g. by the greedy decoders, are
+  // indexed on their first lookup. Other ids fall back to the locked path.
+  class FragmentIndex {
+   public:
+    static constexpr int32_t kChunkSize = 64;
+    static constexpr int32_t kChunkCount = 128;
+    static constexpr int32_t kIndexedIdCount = kChunkSize * kChunkCount;
+
+    struct Slot {
+      std::atomic<SharedCSSFragment*> fragment{nullptr};
+      // Set once the fragment has been looked up, see
+      // IsSharedCSSFragmentDecoded().
+      std::atomic<bool> requested{false};
+      // Serializes the lazy decoding and the flattening of the fragment, so
+      // that they happen once even when several threads miss it together.
+      std::mutex install_mutex;
+    };
+
+    FragmentIndex() = default;
+    ~FragmentIndex();
+
+    // Returns nullptr if id is not indexed, or if the slot has not been
+    // allocated yet and create is false.
+    Slot* GetSlot(int32_t id, bool create);
+
+    // Grace period of the retired fragments. The scopes count themselves in
+    // the slot of the parity of the epoch they entered.
+    uint64_t EnterReadEpoch();
+    void LeaveReadEpoch(uint64_t epoch);
+    // Releases the retired fragments no reader may still use. mutex must be
+    // held.
+    void ReclaimRetiredFragmentsLocked();
+
+    // Guards the writes to raw_fragments_ and requested_ids.
+    std::mutex mutex;
+    // Requested ids that are not indexed.
+    std::unordered_set<int32_t> requested_ids;
+    // Replaced or removed fragments, released once no ReadScope entered
+    // before their retirement is alive. Fragments importing them as layers
+    // keep them alive longer, see SharedCSSFragment::ImportFragmentLayers().
+    struct RetiredFragment {
+      uint64_t epoch;
+      std::shared_ptr<SharedCSSFragment> fragment;
+    };
+    std::vector<RetiredFragment> retired_fragments;
+    // Whether retired_fragments is not empty, lets the leaving readers skip
+    // the lock.
+    std::atomic<bool> has_retired_fragments{false};
+    std::atomic<uint64_t> read_epoch{0};
+
+   private:
+    // Starts a new epoch unless a scope entered before the current one is
+    // still alive. Returns the current epoch.
+    uint64_t TryAdvanceEpoch();
+
+    std::atomic<uint32_t> read_scope_counts_[2] = {};
+
+    struct Chunk {
+      Slot slots[kChunkSize];
+    };
+
+    std::atomic<Chunk*> chunks_[kChunkCount] = {};
+
+    FragmentIndex(const FragmentIndex&) = delete;
+    FragmentIndex& operator=(const FragmentIndex&) = delete;
+  };
+
   void FlatDependentCSS(SharedCSSFragment* fragment);
+  // Imports the fragments in order, either by copying their rules or as
+  // layers when layered fragments are enabled.
+  void ImportFragments(SharedCSSFragment* fragment,
+                       std::vector<std::shared_ptr<SharedCSSFragment>> imports);
+  // Like GetCSSStyleSheet() but shares the ownership of the fragment.
+  std::shared_ptr<SharedCSSFragment> GetCSSStyleSheetRef(int32_t id);
+  // Moves the fragment of id out of raw_fragments_ to the retired ones.
+  // fragment_index_->mutex must be held.
+  void RetireSharedCSSFragmentLocked(int32_t id);
+  // Releases the retired fragments no reader may still use. The others are
+  // released later, by a writer or by the last reader leaving their epoch.
+  void ReclaimRetiredFragments();
+  // Flattens fragment unless another thread already did.
+  void EnsureFragmentBaked(SharedCSSFragment* fragment, int32_t id);
 
   CSSRoute route_;
   CSSFragmentMap page_fragments_;
   // shared in pre-decoding
   std::shared_ptr<CSSFragmentMap> raw_fragments_;
+  // shared along with raw_fragments_
+  std::shared_ptr<FragmentIndex> fragment_index_;
   CSSStyleSheetDelegate* delegate_ = nullptr;
-  std::unordered_set<int> decoded_fragment_;
   volatile std::atomic_bool stop_thread_ = false;
-  std::mutex fragment_mutex_;
   bool enable_new_import_rule_ = false;
 
   // enableCSSLazyImport default value is false.
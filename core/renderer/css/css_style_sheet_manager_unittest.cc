@@ -4,7 +4,10 @@
 
 #include "core/renderer/css/css_style_sheet_manager.h"
 
+#include <atomic>
 #include <fstream>
+#include <thread>
+#include <vector>
 
 #include "core/base/threading/task_runner_manufactor.h"
 #include "core/renderer/dom/element_manager.h"
@@ -155,6 +158,149 @@ TEST_F(CSSStyleSheetManagerTest, DISABLED_Fontfaces) {
             "url('DroidSerif-BoldItalic-webfont.ttf') format('truetype')");
 }
 
+TEST_F(CSSStyleSheetManagerTest, ConcurrentFragmentLookup) {
+  auto manager = std::make_shared<CSSStyleSheetManager>(nullptr);
+  constexpr int32_t kFragmentCount = 32;
+  for (int32_t id = 0; id < kFragmentCount; ++id) {
+    manager->AddSharedCSSFragment(std::make_unique<SharedCSSFragment>(id));
+  }
+  // Inserted without the manager, indexed on the first lookup.
+  manager->GetCSSFragmentMap()->emplace(
+      kFragmentCount, std::make_unique<SharedCSSFragment>(kFragmentCount));
+  // Not indexed, served by the locked path.
+  constexpr int32_t kLargeId = 1 << 20;
+  manager->AddSharedCSSFragment(std::make_unique<SharedCSSFragment>(kLargeId));
+
+  std::atomic<int> failures{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&manager, &failures]() {
+      for (int round = 0; round < 100; ++round) {
+        for (int32_t id = 0; id <= kFragmentCount; ++id) {
+          auto* fragment = manager->GetCSSStyleSheet(id);
+          if (fragment == nullptr || fragment->id() != id ||
+              !fragment->is_baked()) {
+            ++failures;
+          }
+        }
+        if (manager->GetCSSStyleSheet(kLargeId) == nullptr) {
+          ++failures;
+        }
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  EXPECT_EQ(failures.load(), 0);
+
+  EXPECT_TRUE(manager->IsSharedCSSFragmentDecoded(3));
+  EXPECT_TRUE(manager->IsSharedCSSFragmentDecoded(kLargeId));
+  EXPECT_FALSE(manager->IsSharedCSSFragmentDecoded(kFragmentCount + 1));
+  EXPECT_EQ(manager->GetCSSStyleSheet(kFragmentCount + 1), nullptr);
+  EXPECT_TRUE(manager->IsSharedCSSFragmentDecoded(kFragmentCount + 1));
+
+  manager->ReplaceSharedCSSFragment(std::make_unique<SharedCSSFragment>(3));
+  auto* replaced = manager->GetSharedCSSFragmentById(3);
+  EXPECT_EQ(replaced, manager->raw_fragments().at(3).get());
+  EXPECT_FALSE(replaced->is_baked());
+
+  // Managers sharing the fragments share the index.
+  CSSStyleSheetManager copy(nullptr);
+  copy.CopyFrom(*manager);
+  manager->RemoveSharedCSSFragment(3);
+  EXPECT_EQ(manager->GetSharedCSSFragmentById(3), nullptr);
+  EXPECT_EQ(copy.GetSharedCSSFragmentById(3), nullptr);
+}
+
+namespace {
+
+class TrackedFragment : public SharedCSSFragment {
+ public:
+  TrackedFragment(int32_t id, bool* destroyed)
+      : SharedCSSFragment(id), destroyed_(destroyed) {}
+  ~TrackedFragment() override { *destroyed_ = true; }
+
+ private:
+  bool* destroyed_;
+};
+
+}  // namespace
+
+TEST_F(CSSStyleSheetManagerTest, ReplacedFragmentOutlivesReadScope) {
+  CSSStyleSheetManager manager(nullptr);
+  bool destroyed = false;
+  manager.AddSharedCSSFragment(
+      std::make_unique<TrackedFragment>(1, &destroyed));
+
+  std::atomic<bool> looked_up{false};
+  std::atomic<bool> replaced{false};
+  std::thread reader([&]() {
+    CSSStyleSheetManager::ReadScope scope;
+    auto* fragment = manager.GetSharedCSSFragmentById(1);
+    looked_up = true;
+    while (!replaced) {
+      std::this_thread::yield();
+    }
+    // Still readable after the replacement.
+    EXPECT_EQ(fragment->id(), 1);
+    EXPECT_FALSE(destroyed);
+  });
+  while (!looked_up) {
+    std::this_thread::yield();
+  }
+  manager.ReplaceSharedCSSFragment(std::make_unique<SharedCSSFragment>(1));
+  EXPECT_FALSE(destroyed);
+  replaced = true;
+  reader.join();
+
+  // Freed by the reader leaving its scope, without another retirement.
+  EXPECT_TRUE(destroyed);
+}
+
+TEST_F(CSSStyleSheetManagerTest, ReadScopeOnlyPinsManagersItReads) {
+  CSSStyleSheetManager manager(nullptr);
+  CSSStyleSheetManager other_manager(nullptr);
+  bool destroyed = false;
+  manager.AddSharedCSSFragment(
+      std::make_unique<TrackedFragment>(1, &destroyed));
+  other_manager.AddSharedCSSFragment(std::make_unique<SharedCSSFragment>(1));
+
+  std::atomic<bool> looked_up{false};
+  std::atomic<bool> replaced{false};
+  std::thread reader([&]() {
+    CSSStyleSheetManager::ReadScope scope;
+    EXPECT_NE(other_manager.GetSharedCSSFragmentById(1), nullptr);
+    looked_up = true;
+    while (!replaced) {
+      std::this_thread::yield();
+    }
+  });
+  while (!looked_up) {
+    std::this_thread::yield();
+  }
+  // The scope of the reader does not hold back the other managers.
+  manager.ReplaceSharedCSSFragment(std::make_unique<SharedCSSFragment>(1));
+  EXPECT_TRUE(destroyed);
+  replaced = true;
+  reader.join();
+}
+
+TEST_F(CSSStyleSheetManagerTest, ReplacedFragmentsAreNotAccumulated) {
+  CSSStyleSheetManager manager(nullptr);
+  constexpr int kReplaceCount = 200;
+  bool destroyed[kReplaceCount] = {};
+  for (int i = 0; i < kReplaceCount; ++i) {
+    manager.ReplaceSharedCSSFragment(
+        std::make_shared<TrackedFragment>(1, &destroyed[i]));
+  }
+  // Without readers, each replacement frees the previous fragment.
+  for (int i = 0; i < kReplaceCount - 1; ++i) {
+    EXPECT_TRUE(destroyed[i]);
+  }
+  EXPECT_FALSE(destroyed[kReplaceCount - 1]);
+}
+
 }  // namespace testing
 }  // namespace tasm
 }  // namespace lynx
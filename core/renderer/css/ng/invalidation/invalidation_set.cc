@@ -84,6 +84,18 @@ void InvalidationSet::Combine(const InvalidationSet& other) {
 
   DCHECK(&other != this);
 
+  if (IsSiblingInvalidationSet()) {
+    auto& sibling_set = static_cast<SiblingInvalidationSet&>(*this);
+    const auto& other_sibling_set =
+        static_cast<const SiblingInvalidationSet&>(other);
+    sibling_set.UpdateMaxDirectAdjacentSelectors(
+        other_sibling_set.MaxDirectAdjacentSelectors());
+    if (const auto* other_descendants =
+            other_sibling_set.SiblingDescendants()) {
+      sibling_set.EnsureSiblingDescendants().Combine(*other_descendants);
+    }
+  }
+
   if (other.InvalidatesSelf()) {
     SetInvalidatesSelf();
     if (other.IsSelfInvalidationSet()) {
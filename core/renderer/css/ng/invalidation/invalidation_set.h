@@ -34,6 +34,7 @@
 #ifndef CORE_RENDERER_CSS_NG_INVALIDATION_INVALIDATION_SET_H_
 #define CORE_RENDERER_CSS_NG_INVALIDATION_INVALIDATION_SET_H_
 
+#include <limits>
 #include <memory>
 #include <string>
 #include <unordered_set>
@@ -50,10 +51,12 @@ namespace css {
 
 enum class InvalidationType {
   kInvalidateDescendants,
+  kInvalidateSiblings,
 };
 
 class InvalidationSet;
 class DescendantInvalidationSet;
+class SiblingInvalidationSet;
 
 // Tracks data to determine which descendants in a DOM subtree need to have
 // style recalculated.
@@ -71,6 +74,15 @@ class DescendantInvalidationSet;
 //   For class v we will have a DescendantInvalidationSet with
 //   wholeSubtreeInvalid.
 //
+// .w + .x {}
+//   For class w we will have a SiblingInvalidationSet containing class x with
+//   maxDirectAdjacentSelectors 1 (only the next sibling is invalidated).
+//
+// .w ~ .x .y {}
+//   For class w we will have a SiblingInvalidationSet containing class x, the
+//   matching siblings get their descendants with class y invalidated through
+//   the sibling descendants set.
+//
 // Avoid virtual functions to minimize space consumption.
 class InvalidationSet {
  public:
@@ -93,6 +105,9 @@ class InvalidationSet {
   bool IsDescendantInvalidationSet() const {
     return GetType() == InvalidationType::kInvalidateDescendants;
   }
+  bool IsSiblingInvalidationSet() const {
+    return GetType() == InvalidationType::kInvalidateSiblings;
+  }
 
   bool InvalidatesElement(const tasm::AttributeHolder&) const;
 
@@ -295,6 +310,8 @@ using InvalidationSetPtr =
     std::unique_ptr<InvalidationSet, InvalidationSet::Deleter>;
 using DescendantInvalidationSetPtr =
     std::unique_ptr<DescendantInvalidationSet, InvalidationSet::Deleter>;
+using SiblingInvalidationSetPtr =
+    std::unique_ptr<SiblingInvalidationSet, InvalidationSet::Deleter>;
 
 class DescendantInvalidationSet : public InvalidationSet {
  public:
@@ -306,10 +323,60 @@ class DescendantInvalidationSet : public InvalidationSet {
       : InvalidationSet(InvalidationType::kInvalidateDescendants) {}
 };
 
+// Invalidates the following siblings of the element whose feature changed.
+// The features of the set describe the siblings to invalidate, at most
+// MaxDirectAdjacentSelectors() siblings are visited.
+class SiblingInvalidationSet : public InvalidationSet {
+ public:
+  static constexpr unsigned kDirectAdjacentMax =
+      std::numeric_limits<unsigned>::max();
+
+  static SiblingInvalidationSetPtr Create() {
+    return SiblingInvalidationSetPtr(new SiblingInvalidationSet());
+  }
+
+  SiblingInvalidationSet()
+      : InvalidationSet(InvalidationType::kInvalidateSiblings) {}
+
+  unsigned MaxDirectAdjacentSelectors() const {
+    return max_direct_adjacent_selectors_;
+  }
+  void UpdateMaxDirectAdjacentSelectors(unsigned value) {
+    if (value > max_direct_adjacent_selectors_) {
+      max_direct_adjacent_selectors_ = value;
+    }
+  }
+
+  // Applied to the subtrees of the invalidated siblings, e.g. for '.a + .b .c'
+  // it contains class c.
+  DescendantInvalidationSet* SiblingDescendants() const {
+    return sibling_descendant_invalidation_set_.get();
+  }
+  DescendantInvalidationSet& EnsureSiblingDescendants() {
+    if (!sibling_descendant_invalidation_set_) {
+      sibling_descendant_invalidation_set_ =
+          DescendantInvalidationSet::Create();
+    }
+    return *sibling_descendant_invalidation_set_;
+  }
+
+ private:
+  unsigned max_direct_adjacent_selectors_{1};
+  DescendantInvalidationSetPtr sibling_descendant_invalidation_set_;
+};
+
 using InvalidationSetVector = base::Vector<InvalidationSet*>;
 
 struct InvalidationLists {
   InvalidationSetVector descendants;
+  InvalidationSetVector siblings;
+
+  bool IsEmpty() const { return descendants.empty() && siblings.empty(); }
+  size_t Size() const { return descendants.size() + siblings.size(); }
+  void Clear() {
+    descendants.clear_and_shrink();
+    siblings.clear_and_shrink();
+  }
 };
 
 template <typename InvalidationSet::BackingType type>
@@ -390,6 +457,8 @@ inline void InvalidationSet::Deleter::operator()(InvalidationSet* set) {
   }
   if (set->IsDescendantInvalidationSet()) {
     delete static_cast<DescendantInvalidationSet*>(set);
+  } else if (set->IsSiblingInvalidationSet()) {
+    delete static_cast<SiblingInvalidationSet*>(set);
   }
 }
 
@@ -21,6 +21,21 @@ static inline bool SupportedRelation(LynxCSSSelector::RelationType relation) {
          relation == LynxCSSSelector::kUAShadow;
 }
 
+static inline bool IsSiblingRelation(LynxCSSSelector::RelationType relation) {
+  return relation == LynxCSSSelector::kDirectAdjacent ||
+         relation == LynxCSSSelector::kIndirectAdjacent;
+}
+
+template <typename Map, typename Key>
+static SiblingInvalidationSet& EnsureSiblingInvalidationSet(Map& map,
+                                                            const Key& key) {
+  SiblingInvalidationSetPtr& invalidation_set = map[key];
+  if (!invalidation_set) {
+    invalidation_set = SiblingInvalidationSet::Create();
+  }
+  return *invalidation_set;
+}
+
 InvalidationSet& RuleInvalidationSet::GetInvalidationSet(
     PositionType position, InvalidationSetPtr& invalidation_set) {
   if (!invalidation_set) {
@@ -76,6 +91,43 @@ void RuleInvalidationSet::ExtractSimpleSelector(
   }
 }
 
+// Extracts the feature of a whole compound, e.g. for '.b.c' of '.a + .b.c .d'.
+void RuleInvalidationSet::ExtractCompoundFeature(
+    const LynxCSSSelector& compound, InvalidationSetFeature& feature) {
+  for (const LynxCSSSelector* simple_selector = &compound; simple_selector;
+       simple_selector = simple_selector->TagHistory()) {
+    ExtractSimpleSelector(*simple_selector, feature);
+    if (simple_selector->Relation() != LynxCSSSelector::kSubSelector) {
+      break;
+    }
+  }
+}
+
+SiblingInvalidationSet*
+RuleInvalidationSet::GetSiblingInvalidationSetForSimpleSelector(
+    const LynxCSSSelector& selector) {
+  if (selector.Match() == LynxCSSSelector::kClass) {
+    return &EnsureSiblingInvalidationSet(class_sibling_invalidation_sets_,
+                                         selector.Value());
+  }
+  if (selector.Match() == LynxCSSSelector::kId) {
+    return &EnsureSiblingInvalidationSet(id_sibling_invalidation_sets_,
+                                         selector.Value());
+  }
+  if (selector.Match() == LynxCSSSelector::kPseudoClass) {
+    switch (selector.GetPseudoType()) {
+      case LynxCSSSelector::kPseudoHover:
+      case LynxCSSSelector::kPseudoFocus:
+      case LynxCSSSelector::kPseudoActive:
+        return &EnsureSiblingInvalidationSet(pseudo_sibling_invalidation_sets_,
+                                             selector.GetPseudoType());
+      default:
+        break;
+    }
+  }
+  return nullptr;
+}
+
 InvalidationSet* RuleInvalidationSet::GetInvalidationSetForSimpleSelector(
     const LynxCSSSelector& selector, PositionType position) {
   if (selector.Match() == LynxCSSSelector::kClass) {
@@ -118,10 +170,9 @@ void RuleInvalidationSet::UpdateInvalidationSets(
   }
 
   const LynxCSSSelector* next_compound = last_in_compound->TagHistory();
-  // For example, '.a .b', only support descendants
-  if (next_compound && SupportedRelation(last_in_compound->Relation())) {
-    // Add next_compound in *_invalidation_sets_
-    AddSelectorToInvalidationSets(*next_compound, feature);
+  if (next_compound) {
+    // Add the compounds on the left in *_invalidation_sets_
+    AddSelectorToInvalidationSets(*last_in_compound, feature);
   }
 
   if (!next_compound) {
@@ -224,24 +275,97 @@ RuleInvalidationSet::AddCompoundSelectorToInvalidationSets(
   return simple_selector;
 }
 
+const LynxCSSSelector*
+RuleInvalidationSet::AddCompoundSelectorToSiblingInvalidationSets(
+    const LynxCSSSelector& compound,
+    const InvalidationSetFeature& sibling_feature,
+    unsigned max_direct_adjacent_selectors,
+    const InvalidationSetFeature* descendant_feature) {
+  // For example, for selector '.m + .n.x .p' we will add sibling-invalidation
+  // sets for '.n' and '.x' containing '.p' and for '.m' containing '.n.x' with
+  // sibling descendants containing '.p'.
+  const LynxCSSSelector* simple_selector = &compound;
+  for (; simple_selector; simple_selector = simple_selector->TagHistory()) {
+    if (SiblingInvalidationSet* invalidation_set =
+            GetSiblingInvalidationSetForSimpleSelector(*simple_selector)) {
+      invalidation_set->UpdateMaxDirectAdjacentSelectors(
+          max_direct_adjacent_selectors);
+      AddFeatureToInvalidationSet(*invalidation_set, sibling_feature);
+      if (descendant_feature) {
+        AddFeatureToInvalidationSet(
+            invalidation_set->EnsureSiblingDescendants(), *descendant_feature);
+      }
+    }
+    if (simple_selector->Relation() != LynxCSSSelector::kSubSelector) {
+      break;
+    }
+    if (!simple_selector->TagHistory()) {
+      break;
+    }
+  }
+
+  return simple_selector;
+}
+
 void RuleInvalidationSet::AddSelectorToInvalidationSets(
-    const LynxCSSSelector& selector,
+    const LynxCSSSelector& last_in_subject,
     InvalidationSetFeature& descendant_feature) {
-  // The 'selector' is the selector immediately to the left of the rightmost
-  // combinator. descendant_feature has the feature of the rightmost compound
-  // selector.
-  const LynxCSSSelector* compound = &selector;
-  while (compound) {
-    // NOTE: We only support descendants
-    if (!SupportedRelation(compound->Relation())) {
+  // 'last_in_subject' is the last simple selector of the rightmost compound,
+  // descendant_feature has the feature of the rightmost compound. Any
+  // compound on the left of a descendant or child combinator gets a
+  // descendant-invalidation set, any compound on the left of a sibling
+  // combinator gets a sibling-invalidation set.
+  const LynxCSSSelector* last_in_compound = &last_in_subject;
+  // Start of the compound on the right of the visited combinator, nullptr
+  // while it is the rightmost compound.
+  const LynxCSSSelector* right_compound = nullptr;
+
+  // For '.a ~ .b + .c', the siblings to invalidate when '.a' or '.b' changes
+  // are described by '.c', the compound on the right of the whole sibling
+  // chain.
+  bool in_sibling_chain = false;
+  InvalidationSetFeature sibling_feature;
+  unsigned max_direct_adjacent_selectors = 0;
+  bool has_sibling_descendants = false;
+
+  while (const LynxCSSSelector* compound = last_in_compound->TagHistory()) {
+    const auto relation = last_in_compound->Relation();
+    if (IsSiblingRelation(relation)) {
+      if (!in_sibling_chain) {
+        in_sibling_chain = true;
+        max_direct_adjacent_selectors = 0;
+        has_sibling_descendants = right_compound != nullptr;
+        if (right_compound) {
+          sibling_feature = InvalidationSetFeature();
+          ExtractCompoundFeature(*right_compound, sibling_feature);
+          sibling_feature.SetFullInvalid(!sibling_feature.HasFeature());
+        } else {
+          sibling_feature = descendant_feature;
+        }
+      }
+      if (relation == LynxCSSSelector::kDirectAdjacent &&
+          max_direct_adjacent_selectors !=
+              SiblingInvalidationSet::kDirectAdjacentMax) {
+        ++max_direct_adjacent_selectors;
+      } else {
+        max_direct_adjacent_selectors =
+            SiblingInvalidationSet::kDirectAdjacentMax;
+      }
+      last_in_compound = AddCompoundSelectorToSiblingInvalidationSets(
+          *compound, sibling_feature, max_direct_adjacent_selectors,
+          has_sibling_descendants ? &descendant_feature : nullptr);
+    } else if (SupportedRelation(relation)) {
+      // The subject is a descendant of every compound on the left of a
+      // descendant combinator, even through sibling combinators.
+      in_sibling_chain = false;
+      last_in_compound =
+          AddCompoundSelectorToInvalidationSets(*compound, descendant_feature);
+    } else {
+      // Relative selectors are not supported.
       return;
     }
-
-    // For example, for selector '.m .n.x .p' the loop is '.n' and '.m'
-    const LynxCSSSelector* last_in_compound =
-        AddCompoundSelectorToInvalidationSets(*compound, descendant_feature);
     DCHECK(last_in_compound);
-    compound = last_in_compound->TagHistory();
+    right_compound = compound;
   }
 }
 
@@ -281,34 +405,50 @@ void RuleInvalidationSet::Merge(const RuleInvalidationSet& other) {
     auto key = static_cast<LynxCSSSelector::PseudoType>(entry.first);
     CombineInvalidationSet(pseudo_invalidation_sets_, key, entry.second.get());
   }
+  for (const auto& entry : other.class_sibling_invalidation_sets_)
+    EnsureSiblingInvalidationSet(class_sibling_invalidation_sets_, entry.first)
+        .Combine(*entry.second);
+  for (const auto& entry : other.id_sibling_invalidation_sets_)
+    EnsureSiblingInvalidationSet(id_sibling_invalidation_sets_, entry.first)
+        .Combine(*entry.second);
+  for (const auto& entry : other.pseudo_sibling_invalidation_sets_)
+    EnsureSiblingInvalidationSet(pseudo_sibling_invalidation_sets_, entry.first)
+        .Combine(*entry.second);
 }
 
 void RuleInvalidationSet::Clear() {
   class_invalidation_sets_.clear();
   id_invalidation_sets_.clear();
   pseudo_invalidation_sets_.clear();
+  class_sibling_invalidation_sets_.clear();
+  id_sibling_invalidation_sets_.clear();
+  pseudo_sibling_invalidation_sets_.clear();
 }
 
-#define COLLECT_INVALIDATION_SETS(field, name, key_type)                  \
+#define COLLECT_INVALIDATION_SETS(field, sibling_field, name, key_type)   \
   void RuleInvalidationSet::Collect##name(                                \
       InvalidationLists& invalidation_lists, const key_type& key) const { \
     auto it = field.find(key);                                            \
-    if (it == field.end()) {                                              \
-      return;                                                             \
-    }                                                                     \
-    if (!it->second->IsAlive()) {                                         \
-      return;                                                             \
+    if (it != field.end() && it->second->IsAlive()) {                     \
+      DescendantInvalidationSet* descendants =                            \
+          static_cast<DescendantInvalidationSet*>(it->second.get());      \
+      if (descendants) {                                                  \
+        invalidation_lists.descendants.push_back(descendants);            \
+      }                                                                   \
     }                                                                     \
-    DescendantInvalidationSet* descendants =                              \
-        static_cast<DescendantInvalidationSet*>(it->second.get());        \
-    if (descendants) {                                                    \
-      invalidation_lists.descendants.push_back(descendants);              \
+    auto sibling_it = sibling_field.find(key);                            \
+    if (sibling_it != sibling_field.end() &&                              \
+        sibling_it->second->IsAlive()) {                                  \
+      invalidation_lists.siblings.push_back(sibling_it->second.get());    \
     }                                                                     \
   }
 
-COLLECT_INVALIDATION_SETS(id_invalidation_sets_, Id, std::string)
-COLLECT_INVALIDATION_SETS(class_invalidation_sets_, Class, std::string)
-COLLECT_INVALIDATION_SETS(pseudo_invalidation_sets_, PseudoClass,
+COLLECT_INVALIDATION_SETS(id_invalidation_sets_, id_sibling_invalidation_sets_,
+                          Id, std::string)
+COLLECT_INVALIDATION_SETS(class_invalidation_sets_,
+                          class_sibling_invalidation_sets_, Class, std::string)
+COLLECT_INVALIDATION_SETS(pseudo_invalidation_sets_,
+                          pseudo_sibling_invalidation_sets_, PseudoClass,
                           LynxCSSSelector::PseudoType)
 #undef COLLECT_INVALIDATION_SETS
 
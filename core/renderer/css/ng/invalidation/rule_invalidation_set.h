@@ -43,21 +43,36 @@ class RuleInvalidationSet {
       std::unordered_map<std::string, InvalidationSetPtr>;
   using PseudoTypeInvalidationSetMap =
       std::unordered_map<LynxCSSSelector::PseudoType, InvalidationSetPtr>;
+  using SiblingInvalidationSetMap =
+      std::unordered_map<std::string, SiblingInvalidationSetPtr>;
+  using PseudoTypeSiblingInvalidationSetMap =
+      std::unordered_map<LynxCSSSelector::PseudoType,
+                         SiblingInvalidationSetPtr>;
+
+  SiblingInvalidationSet* GetSiblingInvalidationSetForSimpleSelector(
+      const LynxCSSSelector&);
 
   void UpdateInvalidationSets(const LynxCSSSelector&, InvalidationSetFeature&,
                               PositionType);
 
   static void ExtractSimpleSelector(const LynxCSSSelector&,
                                     InvalidationSetFeature&);
+  static void ExtractCompoundFeature(const LynxCSSSelector&,
+                                     InvalidationSetFeature&);
   const LynxCSSSelector* ExtractCompound(const LynxCSSSelector&,
                                          InvalidationSetFeature&, PositionType);
   void ExtractSelectorList(const LynxCSSSelector&, PositionType);
   void AddFeatureToInvalidationSet(InvalidationSet&,
                                    const InvalidationSetFeature&);
   void AddSelectorToInvalidationSets(
-      const LynxCSSSelector&, InvalidationSetFeature& descendant_feature);
+      const LynxCSSSelector& last_in_subject,
+      InvalidationSetFeature& descendant_feature);
   const LynxCSSSelector* AddCompoundSelectorToInvalidationSets(
       const LynxCSSSelector&, InvalidationSetFeature& descendant_feature);
+  const LynxCSSSelector* AddCompoundSelectorToSiblingInvalidationSets(
+      const LynxCSSSelector&, const InvalidationSetFeature& sibling_feature,
+      unsigned max_direct_adjacent_selectors,
+      const InvalidationSetFeature* descendant_feature);
   void AddSimpleSelectorToInvalidationSets(
       const LynxCSSSelector& simple_selector,
       InvalidationSetFeature& descendant_feature);
@@ -81,6 +96,9 @@ class RuleInvalidationSet {
   InvalidationSetMap class_invalidation_sets_;
   InvalidationSetMap id_invalidation_sets_;
   PseudoTypeInvalidationSetMap pseudo_invalidation_sets_;
+  SiblingInvalidationSetMap class_sibling_invalidation_sets_;
+  SiblingInvalidationSetMap id_sibling_invalidation_sets_;
+  PseudoTypeSiblingInvalidationSetMap pseudo_sibling_invalidation_sets_;
 
   friend class RuleInvalidationSetTest;
 };
@@ -481,5 +481,85 @@ TEST_F(RuleInvalidationSetTest, IgnoreSibling) {
   EXPECT_TRUE(HasNoInvalidation(lists.descendants));
 }
 
+TEST_F(RuleInvalidationSetTest, DirectAdjacent) {
+  AddSelector(".a + .b");
+  InvalidationLists lists;
+  CollectClass(lists, "a");
+  EXPECT_TRUE(HasNoInvalidation(lists.descendants));
+  EXPECT_TRUE(HasClassInvalidation("b", lists.siblings));
+  auto* sibling_set = static_cast<SiblingInvalidationSet*>(lists.siblings[0]);
+  EXPECT_EQ(sibling_set->MaxDirectAdjacentSelectors(), 1u);
+  EXPECT_EQ(sibling_set->SiblingDescendants(), nullptr);
+
+  lists = InvalidationLists();
+  CollectClass(lists, "b");
+  EXPECT_TRUE(HasSelfInvalidation(lists.descendants));
+  EXPECT_TRUE(HasNoInvalidation(lists.siblings));
+}
+
+TEST_F(RuleInvalidationSetTest, SiblingChain) {
+  AddSelector(".a ~ .b + .c");
+  InvalidationLists lists;
+  CollectClass(lists, "a");
+  EXPECT_TRUE(HasClassInvalidation("c", lists.siblings));
+  EXPECT_EQ(static_cast<SiblingInvalidationSet*>(lists.siblings[0])
+                ->MaxDirectAdjacentSelectors(),
+            SiblingInvalidationSet::kDirectAdjacentMax);
+
+  lists = InvalidationLists();
+  CollectClass(lists, "b");
+  EXPECT_TRUE(HasClassInvalidation("c", lists.siblings));
+  EXPECT_EQ(static_cast<SiblingInvalidationSet*>(lists.siblings[0])
+                ->MaxDirectAdjacentSelectors(),
+            1u);
+}
+
+TEST_F(RuleInvalidationSetTest, SiblingDescendants) {
+  AddSelector(".a + .b .c");
+  InvalidationLists lists;
+  CollectClass(lists, "a");
+  EXPECT_TRUE(HasNoInvalidation(lists.descendants));
+  EXPECT_TRUE(HasClassInvalidation("b", lists.siblings));
+  auto* sibling_set = static_cast<SiblingInvalidationSet*>(lists.siblings[0]);
+  ASSERT_NE(sibling_set->SiblingDescendants(), nullptr);
+  InvalidationSetVector sibling_descendants;
+  sibling_descendants.push_back(sibling_set->SiblingDescendants());
+  EXPECT_TRUE(HasClassInvalidation("c", sibling_descendants));
+
+  lists = InvalidationLists();
+  CollectClass(lists, "b");
+  EXPECT_TRUE(HasClassInvalidation("c", lists.descendants));
+}
+
+TEST_F(RuleInvalidationSetTest, DescendantThroughSibling) {
+  AddSelector(".x .a ~ .b");
+  InvalidationLists lists;
+  CollectClass(lists, "x");
+  EXPECT_TRUE(HasClassInvalidation("b", lists.descendants));
+  EXPECT_TRUE(HasNoInvalidation(lists.siblings));
+}
+
+TEST_F(RuleInvalidationSetTest, WholeSiblingInvalid) {
+  AddSelector(".a + *");
+  InvalidationLists lists;
+  CollectClass(lists, "a");
+  EXPECT_TRUE(HasWholeSubtreeInvalidation(lists.siblings));
+}
+
+TEST_F(RuleInvalidationSetTest, MergeSibling) {
+  RuleInvalidationSet local;
+  AddSelector(".a + .b");
+  AddSelector(".a ~ .c .d");
+  MergeInto(local);
+  ClearInvalidations();
+  InvalidationLists lists;
+  local.CollectClass(lists, "a");
+  EXPECT_TRUE(HasClassInvalidation("b", "c", lists.siblings));
+  auto* sibling_set = static_cast<SiblingInvalidationSet*>(lists.siblings[0]);
+  EXPECT_EQ(sibling_set->MaxDirectAdjacentSelectors(),
+            SiblingInvalidationSet::kDirectAdjacentMax);
+  ASSERT_NE(sibling_set->SiblingDescendants(), nullptr);
+}
+
 }  // namespace css
 }  // namespace lynx
@@ -62,6 +62,9 @@ void RuleSet::MatchStyles(StyleNode* node, unsigned& level,
   for (const auto& dep : deps_) {
     dep.MatchStyles(node, level, output);
   }
+  for (const auto& layer : layers_) {
+    layer->MatchStyles(node, level, output);
+  }
   ++level;
   MatchKey(node, universal_rules_, level, output);
   if (node->GetPseudoState() != tasm::kPseudoStateNone) {
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/include/fml/memory/ref_counted.h"
@@ -56,6 +57,11 @@ class RuleSet {
 
   void Merge(const RuleSet& rule_set) { deps_.push_back(rule_set); }
 
+  // Like Merge() but shares |rule_set| instead of copying it.
+  void AddLayer(std::shared_ptr<const RuleSet> rule_set) {
+    layers_.push_back(std::move(rule_set));
+  }
+
   void AddStyleRule(const fml::RefPtr<StyleRule>& r);
 
   fml::RefPtr<tasm::CSSParseToken> GetRootToken();
@@ -89,6 +95,7 @@ class RuleSet {
   CompactRuleDataVector universal_rules_;
 
   std::vector<RuleSet> deps_;
+  std::vector<std::shared_ptr<const RuleSet>> layers_;
   tasm::SharedCSSFragment* fragment_ = nullptr;
   unsigned rule_count_ = 0;
 };
@@ -3,6 +3,8 @@
 // LICENSE file in the root directory of this source tree.
 #include "core/renderer/css/shared_css_fragment.h"
 
+#include <algorithm>
+
 #include "base/trace/native/trace_event.h"
 #include "core/renderer/css/css_style_sheet_manager.h"
 #include "core/renderer/trace/renderer_trace_event_def.h"
@@ -175,6 +177,54 @@ void SharedCSSFragment::ImportOtherFragment(const SharedCSSFragment* fragment) {
   }
 }
 
+void SharedCSSFragment::ImportFragmentLayers(
+    std::vector<std::shared_ptr<SharedCSSFragment>> fragments) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, SHARED_FRAGMENT_IMPORT_LAYERS);
+  fragments.erase(std::remove(fragments.begin(), fragments.end(), nullptr),
+                  fragments.end());
+  for (const auto& fragment : fragments) {
+    if (fragment->HasTouchPseudoToken()) {
+      MarkHasTouchPseudoToken();
+    }
+    // The layers are baked before being imported, their maps are final.
+    MergeLayerMaps(*fragment);
+    if (rule_set_ && fragment->rule_set_) {
+      // Shares the ownership of the fragment owning the rule set.
+      rule_set_->AddLayer(std::shared_ptr<const css::RuleSet>(
+          fragment, fragment->rule_set_.get()));
+    }
+  }
+  layers_ = std::move(fragments);
+}
+
+namespace {
+
+// Entries of |layer| override the ones of |map|.
+template <typename Map>
+void MergeLayer(Map& map, const Map& layer) {
+  for (const auto& entry : layer) {
+    map[entry.first] = entry.second;
+  }
+}
+
+}  // namespace
+
+void SharedCSSFragment::MergeLayerMaps(const SharedCSSFragment& layer) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, SHARED_FRAGMENT_MERGE_LAYERS);
+  // Lazy import looks the dependents up instead, see GetCSSStyle().
+  if (!enable_css_lazy_import_) {
+    MergeLayer(css_, layer.css_);
+  }
+  MergeLayer(pseudo_map_, layer.pseudo_map_);
+  MergeLayer(child_pseudo_map_, layer.child_pseudo_map_);
+  MergeLayer(cascade_map_, layer.cascade_map_);
+  MergeLayer(id_map_, layer.id_map_);
+  MergeLayer(tag_map_, layer.tag_map_);
+  MergeLayer(universal_map_, layer.universal_map_);
+  MergeLayer(keyframes_, layer.keyframes_);
+  MergeLayer(fontfaces_, layer.fontfaces_);
+}
+
 void SharedCSSFragment::InitPseudoNotStyle() {
   if (pseudo_map_.empty()) {
     return;
@@ -282,6 +332,9 @@ void SharedCSSFragment::CollectInvalidationSetsForId(
     css::InvalidationLists& lists, const std::string& id) {
   if (rule_invalidation_set_) {
     rule_invalidation_set_->CollectId(lists, id);
+    for (const auto& layer : layers_) {
+      layer->CollectInvalidationSetsForId(lists, id);
+    }
   }
 }
 
@@ -289,6 +342,9 @@ void SharedCSSFragment::CollectInvalidationSetsForClass(
     css::InvalidationLists& lists, const std::string& class_name) {
   if (rule_invalidation_set_) {
     rule_invalidation_set_->CollectClass(lists, class_name);
+    for (const auto& layer : layers_) {
+      layer->CollectInvalidationSetsForClass(lists, class_name);
+    }
   }
 }
 
@@ -296,6 +352,9 @@ void SharedCSSFragment::CollectInvalidationSetsForPseudoClass(
     css::InvalidationLists& lists, css::LynxCSSSelector::PseudoType pseudo) {
   if (rule_invalidation_set_) {
     rule_invalidation_set_->CollectPseudoClass(lists, pseudo);
+    for (const auto& layer : layers_) {
+      layer->CollectInvalidationSetsForPseudoClass(lists, pseudo);
+    }
   }
 }
 
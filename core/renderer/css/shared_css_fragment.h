@@ -5,6 +5,7 @@
 #ifndef CORE_RENDERER_CSS_SHARED_CSS_FRAGMENT_H_
 #define CORE_RENDERER_CSS_SHARED_CSS_FRAGMENT_H_
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <utility>
@@ -39,7 +40,7 @@ class SharedCSSFragment : public CSSFragment {
   ~SharedCSSFragment() override;
 
   inline int32_t id() const { return id_; }
-  inline bool is_baked() { return is_baked_; }
+  inline bool is_baked() { return is_baked_.load(std::memory_order_acquire); }
   inline bool enable_class_merge() { return enable_class_merge_; }
   inline bool enable_css_selector() override { return enable_css_selector_; }
   inline bool enable_css_invalidation() override {
@@ -58,8 +59,18 @@ class SharedCSSFragment : public CSSFragment {
     return *pseudo_not_style_;
   }
 
-  void MarkBaked() { is_baked_ = true; }
+  void MarkBaked() { is_baked_.store(true, std::memory_order_release); }
   void ImportOtherFragment(const SharedCSSFragment* fragment);
+  // Imports |fragments| in the given order with the same precedence as
+  // calling ImportOtherFragment() for each of them, but keeps references to
+  // them instead of copying their rule sets. The legacy lookup maps of the
+  // layers are merged into the own ones once, so that a lookup is a single
+  // find. Not supported with class merge.
+  void ImportFragmentLayers(
+      std::vector<std::shared_ptr<SharedCSSFragment>> fragments);
+  const std::vector<std::shared_ptr<SharedCSSFragment>>& layers() const {
+    return layers_;
+  }
   void SetEnableClassMerge(bool class_merge) {
     enable_class_merge_ = class_merge;
   }
@@ -115,7 +126,7 @@ class SharedCSSFragment : public CSSFragment {
   friend class LynxBinaryBaseCSSReader;
 
   int32_t id_;
-  bool is_baked_;
+  std::atomic<bool> is_baked_;
   bool enable_class_merge_ = false;
   bool enable_css_selector_ = false;
   bool enable_css_invalidation_ = false;
@@ -138,6 +149,14 @@ class SharedCSSFragment : public CSSFragment {
   // Initialize the RuleInvalidationSet only when the CSS invalidation is
   // enabled
   std::unique_ptr<css::RuleInvalidationSet> rule_invalidation_set_;
+
+ private:
+  // Merges the legacy lookup maps of layer into the own ones, its entries
+  // take precedence.
+  void MergeLayerMaps(const SharedCSSFragment& layer);
+
+  // Imported fragments in import order, the last one takes precedence.
+  std::vector<std::shared_ptr<SharedCSSFragment>> layers_;
 };
 
 }  // namespace tasm
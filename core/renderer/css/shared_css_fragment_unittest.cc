@@ -333,6 +333,61 @@ TEST(SharedCSSFragment, CheckHasID) {
   EXPECT_TRUE(hasIdSelector);
 }
 
+TEST(SharedCSSFragment, ImportFragmentLayers) {
+  CSSParserConfigs configs;
+  auto theme_a = fml::MakeRefCounted<CSSParseToken>(configs);
+  auto theme_id = fml::MakeRefCounted<CSSParseToken>(configs);
+  theme_id->sheets().emplace_back(std::make_shared<CSSSheet>("#theme"));
+  auto own_a = fml::MakeRefCounted<CSSParseToken>(configs);
+  auto own_b = fml::MakeRefCounted<CSSParseToken>(configs);
+  CSSKeyframesTokenMap theme_keyframes;
+  theme_keyframes[base::String("fade")] =
+      fml::MakeRefCounted<CSSKeyframesToken>(configs);
+
+  auto theme = std::make_shared<SharedCSSFragment>(
+      1, std::vector<int32_t>{},
+      CSSParserTokenMap{{".a", theme_a}, {"#theme", theme_id}},
+      theme_keyframes, CSSFontFaceRuleMap{});
+  theme->FindSpecificMapAndAdd("#theme", theme_id);
+  theme->MarkHasTouchPseudoToken();
+
+  auto make_component = [&]() {
+    return std::make_shared<SharedCSSFragment>(
+        2, std::vector<int32_t>{1},
+        CSSParserTokenMap{{".a", own_a}, {".b", own_b}},
+        CSSKeyframesTokenMap{}, CSSFontFaceRuleMap{});
+  };
+  auto copied = make_component();
+  copied->ImportOtherFragment(theme.get());
+  auto layered = make_component();
+  layered->ImportFragmentLayers({theme, nullptr});
+  // The layer shares the ownership of the imported fragment.
+  theme.reset();
+
+  EXPECT_EQ(layered->layers().size(), static_cast<size_t>(1));
+  EXPECT_TRUE(copied->layers().empty());
+  for (const auto* key : {".a", ".b", "#theme", ".c"}) {
+    EXPECT_EQ(layered->GetCSSStyle(key), copied->GetCSSStyle(key));
+    EXPECT_EQ(layered->GetSharedCSSStyle(key), copied->GetSharedCSSStyle(key));
+  }
+  EXPECT_EQ(layered->GetCSSStyle(".a"), theme_a.get());
+  EXPECT_EQ(layered->GetIdStyle("#theme"), theme_id.get());
+  EXPECT_TRUE(layered->HasIdSelector());
+  EXPECT_TRUE(layered->HasCSSStyle());
+  EXPECT_TRUE(layered->HasTouchPseudoToken());
+  EXPECT_EQ(layered->GetKeyframesRule(base::String("fade")),
+            copied->GetKeyframesRule(base::String("fade")));
+  EXPECT_EQ(layered->GetKeyframesRuleMap().size(), static_cast<size_t>(1));
+  EXPECT_EQ(layered->css().size(), copied->css().size());
+
+  // A fragment importing the layered one sees the rules of its layers.
+  SharedCSSFragment page(3, {}, {}, {}, {});
+  page.ImportFragmentLayers({layered});
+  EXPECT_EQ(page.GetCSSStyle(".a"), theme_a.get());
+  EXPECT_EQ(page.GetCSSStyle(".b"), own_b.get());
+  EXPECT_TRUE(page.HasIdSelector());
+  EXPECT_EQ(page.GetKeyframesRuleMap().size(), static_cast<size_t>(1));
+}
 }  // namespace testing
 
 }  // namespace css
@@ -12,6 +12,7 @@
 #include "base/include/auto_create_optional.h"
 #include "base/include/value/base_value.h"
 #include "base/include/vector.h"
+#include "core/event/event_type_atom.h"
 #include "core/renderer/css/css_fragment.h"
 #include "core/renderer/css/css_property.h"
 #include "core/renderer/css/style_node.h"
@@ -156,11 +157,13 @@ class AttributeHolder : public fml::RefCountedThreadSafeStorage,
   // For Element Api
   void MergeWithCSSVariables(lepus::Value& css_variable_updated);
 
+  // Event maps are keyed by the canonical string of the event type atom so
+  // that dispatch can match handlers by pointer, see TouchEventHandler.
   void SetStaticEvent(const base::String& type, const base::String& name,
                       const base::String& value) {
     (type == kGlobalBind ? events_->global_bind_events_
                          : events_->static_events())
-        .insert_or_assign(name,
+        .insert_or_assign(event::EventTypeAtomTable::CanonicalName(name),
                           std::make_unique<EventHandler>(type, name, value));
   }
 
@@ -194,7 +197,8 @@ class AttributeHolder : public fml::RefCountedThreadSafeStorage,
     (type == kGlobalBind ? events_->global_bind_events_
                          : events_->static_events())
         .insert_or_assign(
-            name, std::make_unique<EventHandler>(type, name, piper_event_vec));
+            event::EventTypeAtomTable::CanonicalName(name),
+            std::make_unique<EventHandler>(type, name, piper_event_vec));
   }
 
   void SetLepusEvent(const base::String& type, const base::String& name,
@@ -202,7 +206,8 @@ class AttributeHolder : public fml::RefCountedThreadSafeStorage,
     (type == kGlobalBind ? events_->global_bind_events_
                          : events_->static_events())
         .insert_or_assign(
-            name, std::make_unique<EventHandler>(type, name, script, func));
+            event::EventTypeAtomTable::CanonicalName(name),
+            std::make_unique<EventHandler>(type, name, script, func));
   }
 
   void SetWorkletEvent(const base::String& type, const base::String& name,
@@ -210,8 +215,9 @@ class AttributeHolder : public fml::RefCountedThreadSafeStorage,
     // TODO(luochangan.adrian): Add UI Worklet Event
     (type == kGlobalBind ? events_->global_bind_events_
                          : events_->lepus_events_)
-        .insert_or_assign(name, std::make_unique<EventHandler>(
-                                    type, name, worklet_info, ctx));
+        .insert_or_assign(event::EventTypeAtomTable::CanonicalName(name),
+                          std::make_unique<EventHandler>(type, name,
+                                                         worklet_info, ctx));
   }
 
   void RemoveEvent(const base::String& name, const base::String& type);
@@ -37,6 +37,7 @@
 #include "core/runtime/bindings/jsi/java_script_element.h"
 #include "core/services/feature_count/feature_counter.h"
 #include "core/services/feature_count/global_feature_counter.h"
+#include "core/services/timing_handler/timing.h"
 #include "core/services/timing_handler/timing_constants_deprecated.h"
 #include "core/value_wrapper/value_impl_lepus.h"
 
@@ -68,6 +69,7 @@ Element::Element(const base::String& tag, ElementManager* manager,
   if (manager == nullptr) {
     return;
   }
+  TimingCollector::Instance()->Count(FrameCounter::kElementsCreated);
   arch_type_ = manager->GetEnableFiberArch() ? FiberArch : RadonArch;
   enable_new_animator_ = IsFiberArch()
                              ? manager->GetEnableNewAnimatorForFiber()
@@ -151,6 +153,7 @@ Element::Element(const Element& element, bool clone_resolved_props)
       record_parent_font_size_(element.record_parent_font_size_),
       global_bind_target_set_(element.global_bind_target_set_),
       animation_previous_styles_(element.animation_previous_styles_) {
+  TimingCollector::Instance()->Count(FrameCounter::kElementsCreated);
   platform_css_style_ = std::make_unique<starlight::ComputedCSSStyle>(
       *(element.computed_css_style()));
 }
@@ -1642,6 +1645,11 @@ void Element::EnqueueLayoutTask(base::MoveOnlyClosure<void> operation) {
   operation();
 }
 
+void Element::CollectMemoryUsage(ElementMemoryReport& report) const {
+  report.BeginElement(tag_.str());
+  report.Add(ElementMemoryReport::kElement, GetMemoryUsage());
+}
+
 bool Element::IsExtendedLayoutOnlyProps(CSSPropertyID css_id) {
   static const base::NoDestructor<std::array<bool, kPropertyEnd>>
       kWantedProperty([]() {
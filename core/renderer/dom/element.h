@@ -29,6 +29,7 @@
 #include "core/renderer/css/dynamic_css_styles_manager.h"
 #include "core/renderer/dom/attribute_holder.h"
 #include "core/renderer/dom/element_container.h"
+#include "core/renderer/dom/element_memory_report.h"
 #include "core/renderer/dom/style_resolver.h"
 #include "core/renderer/events/events.h"
 #include "core/renderer/events/gesture.h"
@@ -678,6 +679,9 @@ class Element : public lepus::RefCounted {
   virtual void MergeInlineStyles(StyleMap& merged_styles) = 0;
 
   virtual int32_t GetMemoryUsage() const { return sizeof(*this); }
+  // Adds the memory retained by this element to report, broken down by
+  // subsystem.
+  virtual void CollectMemoryUsage(ElementMemoryReport& report) const;
 
   virtual bool is_page() const { return false; }
 
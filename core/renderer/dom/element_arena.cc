@@ -0,0 +1,114 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/element_arena.h"
+
+#include "core/services/timing_handler/timing.h"
+
+namespace lynx {
+namespace tasm {
+
+ElementArena::~ElementArena() = default;
+
+void* ElementArena::TryAllocate(ElementArena* arena, size_t size) {
+  const size_t block_size = size + kHeaderSize;
+  if (arena == nullptr || block_size > kMaxBlockSize ||
+      !arena->IsOwnedByCurrentThread()) {
+    return nullptr;
+  }
+  const auto size_class =
+      static_cast<uint32_t>((block_size + kGranularity - 1) / kGranularity);
+  BlockHeader* header = arena->AllocateBlock(size_class);
+  header->arena = arena;
+  header->size_class = size_class;
+  // Released by Free(), keeps the slabs alive while the block is in use.
+  arena->AddRef();
+  TimingCollector::Instance()->Count(FrameCounter::kAllocations);
+  return reinterpret_cast<uint8_t*>(header) + kHeaderSize;
+}
+
+void ElementArena::Free(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  auto* header =
+      reinterpret_cast<BlockHeader*>(static_cast<uint8_t*>(ptr) - kHeaderSize);
+  ElementArena* arena = header->arena;
+  arena->allocated_bytes_.fetch_sub(header->size_class * kGranularity,
+                                    std::memory_order_relaxed);
+  if (arena->IsOwnedByCurrentThread()) {
+    arena->FreeBlock(header);
+  } else {
+    void* block = header;
+    void* head = arena->foreign_frees_.load(std::memory_order_relaxed);
+    do {
+      *static_cast<void**>(block) = head;
+    } while (!arena->foreign_frees_.compare_exchange_weak(
+        head, block, std::memory_order_release, std::memory_order_relaxed));
+  }
+  // May destroy the arena and release all its slabs.
+  arena->Release();
+}
+
+bool ElementArena::IsOwnedByCurrentThread() {
+  const std::thread::id current = std::this_thread::get_id();
+  std::thread::id owner = owner_.load(std::memory_order_relaxed);
+  if (owner == std::thread::id() &&
+      owner_.compare_exchange_strong(owner, current,
+                                     std::memory_order_relaxed)) {
+    return true;
+  }
+  return owner == current;
+}
+
+ElementArena::BlockHeader* ElementArena::AllocateBlock(uint32_t size_class) {
+  const size_t block_size = size_class * kGranularity;
+  allocated_bytes_.fetch_add(block_size, std::memory_order_relaxed);
+  if (free_lists_[size_class] == nullptr) {
+    DrainForeignFrees();
+  }
+  if (void* block = free_lists_[size_class]) {
+    free_lists_[size_class] = *static_cast<void**>(block);
+    return static_cast<BlockHeader*>(block);
+  }
+  if (cursor_ == nullptr ||
+      static_cast<size_t>(slab_end_ - cursor_) < block_size) {
+    // The tail of the previous slab is too small for this block and is left
+    // unused.
+    slabs_.emplace_back(new uint8_t[kSlabSize]);
+    cursor_ = slabs_.back().get();
+    slab_end_ = cursor_ + kSlabSize;
+    reserved_bytes_.fetch_add(kSlabSize, std::memory_order_relaxed);
+  }
+  void* block = cursor_;
+  cursor_ += block_size;
+  return static_cast<BlockHeader*>(block);
+}
+
+void ElementArena::FreeBlock(BlockHeader* header) {
+  const uint32_t size_class = header->size_class;
+  void* block = header;
+  *static_cast<void**>(block) = free_lists_[size_class];
+  free_lists_[size_class] = block;
+}
+
+void ElementArena::DrainForeignFrees() {
+  void* block = foreign_frees_.exchange(nullptr, std::memory_order_acquire);
+  while (block != nullptr) {
+    void* next = *static_cast<void**>(block);
+    FreeBlock(static_cast<BlockHeader*>(block));
+    block = next;
+  }
+}
+
+size_t ElementArena::allocated_bytes() const {
+  return allocated_bytes_.load(std::memory_order_relaxed);
+}
+
+size_t ElementArena::reserved_bytes() const {
+  return reserved_bytes_.load(std::memory_order_relaxed);
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,132 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_DOM_ELEMENT_ARENA_H_
+#define CORE_RENDERER_DOM_ELEMENT_ARENA_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <new>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base/include/fml/macros.h"
+#include "base/include/fml/memory/ref_counted.h"
+
+namespace lynx {
+namespace tasm {
+
+// Page scoped slab allocator owned by the ElementManager. Fiber elements and
+// their layout nodes are carved from large slabs instead of being allocated
+// one by one, and freed blocks are recycled through per size class free lists.
+// Every live block keeps a reference to its arena, so the slabs are released
+// together once the element manager and the last object of the page are gone.
+//
+// The arena is bound to the first thread allocating from it, the TASM thread,
+// and is not locked: the other threads get no block from it and fall back to
+// the system allocator. Blocks may be freed from any thread, the foreign frees
+// are pushed to a lock free list that the owner drains when it allocates.
+// Only the arena blocks carry a header, the objects which do not come from an
+// arena are plain system allocations.
+class ElementArena : public fml::RefCountedThreadSafe<ElementArena> {
+ public:
+  static constexpr size_t kSlabSize = 64 * 1024;
+  static constexpr size_t kGranularity = 16;
+  // Bigger objects are allocated from the system allocator.
+  static constexpr size_t kMaxBlockSize = 2048;
+
+  // Allocates size bytes from arena. Returns null if arena is null, if the
+  // block is too big or if the calling thread does not own the arena, in
+  // which case the caller allocates from the system. The result is aligned
+  // like the result of ::operator new and must be released with Free().
+  static void* TryAllocate(ElementArena* arena, size_t size);
+  // Releases a block returned by TryAllocate(), from any thread.
+  static void Free(void* ptr);
+
+  // Deleter of the objects created by MakeUnique().
+  template <typename T>
+  struct Deleter {
+    void operator()(T* ptr) const {
+      if (ptr == nullptr) {
+        return;
+      }
+      if (from_arena) {
+        ptr->~T();
+        Free(ptr);
+      } else {
+        delete ptr;
+      }
+    }
+
+    bool from_arena{false};
+  };
+
+  template <typename T>
+  using UniquePtr = std::unique_ptr<T, Deleter<T>>;
+
+  // Constructs T in memory allocated from arena if possible, or from the
+  // system allocator.
+  template <typename T, typename... Args>
+  static UniquePtr<T> MakeUnique(ElementArena* arena, Args&&... args) {
+    static_assert(alignof(T) <= alignof(std::max_align_t),
+                  "T is over aligned.");
+    void* memory = TryAllocate(arena, sizeof(T));
+    if (memory == nullptr) {
+      return UniquePtr<T>(new T(std::forward<Args>(args)...));
+    }
+    return UniquePtr<T>(new (memory) T(std::forward<Args>(args)...),
+                        Deleter<T>{true});
+  }
+
+  // Bytes handed out to live blocks, including the block headers.
+  size_t allocated_bytes() const;
+  // Bytes reserved by the slabs.
+  size_t reserved_bytes() const;
+
+ private:
+  FML_FRIEND_MAKE_REF_COUNTED(ElementArena);
+  FML_FRIEND_REF_COUNTED_THREAD_SAFE(ElementArena);
+
+  // Stored in the first kHeaderSize bytes of every block. The free lists are
+  // threaded through the first word, the size class survives the free.
+  struct BlockHeader {
+    ElementArena* arena;
+    uint32_t size_class;
+  };
+
+  static constexpr size_t kHeaderSize = kGranularity;
+  static constexpr size_t kSizeClassCount = kMaxBlockSize / kGranularity;
+  static_assert(sizeof(BlockHeader) <= kHeaderSize, "BlockHeader too big.");
+
+  ElementArena() = default;
+  ~ElementArena();
+
+  bool IsOwnedByCurrentThread();
+  BlockHeader* AllocateBlock(uint32_t size_class);
+  void FreeBlock(BlockHeader* header);
+  void DrainForeignFrees();
+
+  // Set by the first allocation, only this thread touches the slabs and the
+  // free lists.
+  std::atomic<std::thread::id> owner_{};
+  std::vector<std::unique_ptr<uint8_t[]>> slabs_;
+  uint8_t* cursor_{nullptr};
+  uint8_t* slab_end_{nullptr};
+  // Singly linked lists threaded through the freed blocks.
+  void* free_lists_[kSizeClassCount + 1] = {};
+  // Blocks freed by the other threads, drained by the owner.
+  std::atomic<void*> foreign_frees_{nullptr};
+  std::atomic<size_t> allocated_bytes_{0};
+  std::atomic<size_t> reserved_bytes_{0};
+
+  BASE_DISALLOW_COPY_AND_ASSIGN(ElementArena);
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_DOM_ELEMENT_ARENA_H_
@@ -0,0 +1,104 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/element_arena.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace testing {
+
+namespace {
+
+struct TrackedObject {
+  explicit TrackedObject(int* destroyed) : destroyed_(destroyed) {}
+  ~TrackedObject() { ++(*destroyed_); }
+
+  int* destroyed_;
+  std::string payload{"payload"};
+};
+
+}  // namespace
+
+TEST(ElementArenaTest, RecyclesFreedBlocks) {
+  auto arena = fml::MakeRefCounted<ElementArena>();
+  void* first = ElementArena::TryAllocate(arena.get(), 100);
+  EXPECT_EQ(arena->reserved_bytes(), ElementArena::kSlabSize);
+  EXPECT_GE(arena->allocated_bytes(), 100u);
+  ElementArena::Free(first);
+  EXPECT_EQ(arena->allocated_bytes(), 0u);
+
+  // A block of the same size class reuses the freed one.
+  void* second = ElementArena::TryAllocate(arena.get(), 104);
+  EXPECT_EQ(first, second);
+  ElementArena::Free(second);
+}
+
+TEST(ElementArenaTest, LargeBlocksUseSystemAllocator) {
+  auto arena = fml::MakeRefCounted<ElementArena>();
+  EXPECT_EQ(ElementArena::TryAllocate(arena.get(), ElementArena::kSlabSize),
+            nullptr);
+  EXPECT_EQ(arena->reserved_bytes(), 0u);
+  EXPECT_EQ(arena->allocated_bytes(), 0u);
+  EXPECT_EQ(ElementArena::TryAllocate(nullptr, 64), nullptr);
+
+  // Objects which do not fit are plain system allocations.
+  int destroyed = 0;
+  auto object = ElementArena::MakeUnique<TrackedObject>(nullptr, &destroyed);
+  EXPECT_FALSE(object.get_deleter().from_arena);
+  object.reset();
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(ElementArenaTest, OnlyOwnerThreadAllocates) {
+  auto arena = fml::MakeRefCounted<ElementArena>();
+  void* block = ElementArena::TryAllocate(arena.get(), 64);
+  ASSERT_NE(block, nullptr);
+  void* foreign = block;
+  std::thread([&arena, &foreign]() {
+    EXPECT_EQ(ElementArena::TryAllocate(arena.get(), 64), nullptr);
+    // Freed from another thread, recycled by the owner later.
+    ElementArena::Free(foreign);
+  }).join();
+  EXPECT_EQ(arena->allocated_bytes(), 0u);
+  EXPECT_EQ(ElementArena::TryAllocate(arena.get(), 64), block);
+  ElementArena::Free(block);
+}
+
+TEST(ElementArenaTest, ObjectsOutliveOwner) {
+  int destroyed = 0;
+  ElementArena::UniquePtr<TrackedObject> object;
+  {
+    auto arena = fml::MakeRefCounted<ElementArena>();
+    object = ElementArena::MakeUnique<TrackedObject>(arena.get(), &destroyed);
+  }
+  EXPECT_TRUE(object.get_deleter().from_arena);
+  // The block keeps the arena alive after the owner released it.
+  EXPECT_EQ(object->payload, "payload");
+  object.reset();
+  EXPECT_EQ(destroyed, 1);
+}
+
+TEST(ElementArenaTest, AllocatesNewSlabWhenFull) {
+  auto arena = fml::MakeRefCounted<ElementArena>();
+  std::vector<void*> blocks;
+  const size_t block_size = ElementArena::kMaxBlockSize / 2;
+  for (size_t i = 0; i < ElementArena::kSlabSize / block_size + 1; ++i) {
+    blocks.push_back(ElementArena::TryAllocate(arena.get(), block_size));
+  }
+  EXPECT_EQ(arena->reserved_bytes(), 2 * ElementArena::kSlabSize);
+  for (void* block : blocks) {
+    ElementArena::Free(block);
+  }
+  EXPECT_EQ(arena->allocated_bytes(), 0u);
+}
+
+}  // namespace testing
+}  // namespace tasm
+}  // namespace lynx
@@ -166,6 +166,9 @@ ElementManager::ElementManager(
           lynx_env_config.LayoutsUnitPerPx(),
           lynx_env_config.PhysicalPixelsPerLayoutUnit())) {
   dom_tree_enabled_ = lynx::tasm::LynxEnv::GetInstance().IsDomTreeEnabled();
+  if (LynxEnv::GetInstance().EnableElementArena()) {
+    element_arena_ = fml::MakeRefCounted<ElementArena>();
+  }
   platform_computed_css_->SetCSSParserConfigs(GetCSSParserConfigs());
   task_runner_ = std::make_shared<tasm::TasmWorkerTaskRunner>();
   enable_new_animator_fiber_ = LynxEnv::GetInstance().EnableNewAnimatorFiber();
@@ -211,6 +214,10 @@ ElementManager::~ElementManager() {
                      static_cast<unsigned int>(layout_only_transition_count));
     });
   }
+  // Tasks on the TASM worker may still queue style invalidations.
+  if (task_runner_) {
+    task_runner_->WaitForCompletion();
+  }
   WillDestroy();
 }
 
@@ -670,6 +677,9 @@ void ElementManager::OnPatchFinishForRadon(
     std::shared_ptr<PipelineOptions> &options,
     base::MoveOnlyClosure<void, bool> patch_finish_callback) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY_VITALS, ELEMENT_MANAGER_ON_PATCH_FINISH);
+  if (will_finish_radon_patch_callback_ != nullptr) {
+    will_finish_radon_patch_callback_();
+  }
   catalyzer_->painting_context()->FinishTasmOperation(options);
 
   if (options->is_reload_template) {
@@ -705,6 +715,37 @@ void ElementManager::OnPatchFinishForRadon(
   need_layout_ = false;
 }
 
+void ElementManager::ScheduleStyleInvalidation(
+    fml::RefPtr<FiberElement> element, css::InvalidationLists lists) {
+  std::lock_guard<std::mutex> lock(pending_style_invalidations_mutex_);
+  pending_style_invalidations_.push_back(
+      {std::move(element), std::move(lists)});
+}
+
+void ElementManager::ApplyPendingStyleInvalidations() {
+  // Class changes of this pipeline may still be collected on the worker.
+  if (task_runner_ && CSSFragmentParsingOnTASMWorkerMTSRender()) {
+    task_runner_->WaitForCompletion();
+  }
+  std::vector<PendingStyleInvalidation> pending_invalidations;
+  {
+    std::lock_guard<std::mutex> lock(pending_style_invalidations_mutex_);
+    if (pending_style_invalidations_.empty()) {
+      return;
+    }
+    pending_invalidations.swap(pending_style_invalidations_);
+  }
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, ELEMENT_MANAGER_APPLY_STYLE_INVALIDATIONS);
+  uint32_t invalidated_count = 0;
+  for (const auto &pending : pending_invalidations) {
+    invalidated_count +=
+        pending.element->ApplyPendingStyleInvalidations(pending.lists);
+  }
+  TRACE_COUNTER(LYNX_TRACE_CATEGORY,
+                ELEMENT_MANAGER_INVALIDATED_ELEMENTS_COUNTER,
+                invalidated_count);
+}
+
 void ElementManager::PatchEventRelatedInfo() {
   if (push_touch_pseudo_flag_) {
     catalyzer_->painting_context()->UpdateEventInfo(true);
@@ -1112,63 +1153,64 @@ fml::RefPtr<FiberElement> ElementManager::CreateFiberElement(
 
 fml::RefPtr<FiberElement> ElementManager::CreateFiberElement(
     ElementBuiltInTagEnum enum_tag, const base::String &raw_tag) {
-  auto result = StaticCreateFiberElement(enum_tag, raw_tag);
+  auto result = StaticCreateFiberElement(enum_tag, raw_tag, element_arena());
   result->AttachToElementManager(this, nullptr, false);
   return result;
 }
 
 fml::RefPtr<FiberElement> ElementManager::StaticCreateFiberElement(
-    ElementBuiltInTagEnum enum_tag, const base::String &raw_tag) {
+    ElementBuiltInTagEnum enum_tag, const base::String &raw_tag,
+    ElementArena *arena) {
   fml::RefPtr<FiberElement> element = nullptr;
   switch (enum_tag) {
     case ELEMENT_VIEW:
-      element = fml::AdoptRef<ViewElement>(new ViewElement(nullptr));
+      element = FiberElement::Create<ViewElement>(arena, nullptr);
       break;
     case ELEMENT_IMAGE:
-      element = fml::AdoptRef<ImageElement>(
-          new ImageElement(nullptr, BASE_STATIC_STRING(kElementImageTag)));
+      element = FiberElement::Create<ImageElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementImageTag));
       break;
     case ELEMENT_TEXT:
-      element = fml::AdoptRef<TextElement>(
-          new TextElement(nullptr, BASE_STATIC_STRING(kElementTextTag)));
+      element = FiberElement::Create<TextElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementTextTag));
       break;
     case ELEMENT_X_TEXT:
-      element = fml::AdoptRef<TextElement>(
-          new TextElement(nullptr, BASE_STATIC_STRING(kElementXTextTag)));
+      element = FiberElement::Create<TextElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementXTextTag));
       break;
     case ELEMENT_INLINE_TEXT:
-      element = fml::AdoptRef<TextElement>(
-          new TextElement(nullptr, BASE_STATIC_STRING(kElementTextTag)));
+      element = FiberElement::Create<TextElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementTextTag));
       break;
     case ELEMENT_X_INLINE_TEXT:
-      element = fml::AdoptRef<TextElement>(
-          new TextElement(nullptr, BASE_STATIC_STRING(kElementXTextTag)));
+      element = FiberElement::Create<TextElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementXTextTag));
       break;
     case ELEMENT_RAW_TEXT:
-      element = fml::AdoptRef<RawTextElement>(new RawTextElement(nullptr));
+      element = FiberElement::Create<RawTextElement>(arena, nullptr);
       break;
     case ELEMENT_SCROLL_VIEW:
-      element = fml::AdoptRef<ScrollElement>(new ScrollElement(
-          nullptr, BASE_STATIC_STRING(kElementScrollViewTag)));
+      element = FiberElement::Create<ScrollElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementScrollViewTag));
       break;
     case ELEMENT_X_SCROLL_VIEW:
-      element = fml::AdoptRef<ScrollElement>(new ScrollElement(
-          nullptr, BASE_STATIC_STRING(kElementXScrollViewTag)));
+      element = FiberElement::Create<ScrollElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementXScrollViewTag));
       break;
     case ELEMENT_X_NESTED_SCROLL_VIEW:
-      element = fml::AdoptRef<ScrollElement>(new ScrollElement(
-          nullptr, BASE_STATIC_STRING(kElementXNestedScrollViewTag)));
+      element = FiberElement::Create<ScrollElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementXNestedScrollViewTag));
       break;
     case ELEMENT_LIST:
-      element = fml::AdoptRef<ListElement>(
-          new ListElement(nullptr, BASE_STATIC_STRING(kElementListTag),
-                          lepus::Value(), lepus::Value(), lepus::Value()));
+      element = FiberElement::Create<ListElement>(
+          arena, nullptr, BASE_STATIC_STRING(kElementListTag), lepus::Value(),
+          lepus::Value(), lepus::Value());
       break;
     case ELEMENT_NONE:
-      element = fml::AdoptRef<NoneElement>(new NoneElement(nullptr));
+      element = FiberElement::Create<NoneElement>(arena, nullptr);
       break;
     case ELEMENT_WRAPPER:
-      element = fml::AdoptRef<WrapperElement>(new WrapperElement(nullptr));
+      element = FiberElement::Create<WrapperElement>(arena, nullptr);
       break;
     case ELEMENT_COMPONENT: {
       base::String empty_string;
@@ -1176,10 +1218,10 @@ fml::RefPtr<FiberElement> ElementManager::StaticCreateFiberElement(
       // and path cannot be obtained yet, so default values are assigned
       // initially. Later, during the decoding of the built-in attribute
       // section, these values within the component element will be updated.
-      element = fml::AdoptRef<ComponentElement>(
-          new ComponentElement(nullptr, empty_string, -1,
-                               BASE_STATIC_STRING(tasm::DEFAULT_ENTRY_NAME),
-                               empty_string, empty_string));
+      element = FiberElement::Create<ComponentElement>(
+          arena, nullptr, empty_string, -1,
+          BASE_STATIC_STRING(tasm::DEFAULT_ENTRY_NAME), empty_string,
+          empty_string);
       break;
     }
     case ELEMENT_PAGE:
@@ -1187,60 +1229,60 @@ fml::RefPtr<FiberElement> ElementManager::StaticCreateFiberElement(
       // cannot be obtained yet, so default values are assigned initially.
       // Later, during the decoding of the built-in attribute section, these
       // values within the page element will be updated.
-      element = fml::AdoptRef<PageElement>(
-          new PageElement(nullptr, base::String(), -1));
+      element = FiberElement::Create<PageElement>(
+          arena, nullptr, base::String(), -1);
       break;
     default:
-      element = fml::AdoptRef<FiberElement>(new FiberElement(nullptr, raw_tag));
+      element = FiberElement::Create<FiberElement>(arena, nullptr, raw_tag);
   }
   return element;
 }
 
 fml::RefPtr<FiberElement> ElementManager::CreateFiberNode(
     const base::String &tag) {
-  auto res = fml::AdoptRef<FiberElement>(new FiberElement(this, tag));
+  auto res = FiberElement::Create<FiberElement>(element_arena(), this, tag);
   return res;
 }
 
 fml::RefPtr<PageElement> ElementManager::CreateFiberPage(
     const base::String &component_id, int32_t css_id) {
-  return fml::AdoptRef<PageElement>(
-      new PageElement(this, component_id, css_id));
+  return FiberElement::Create<PageElement>(
+      element_arena(), this, component_id, css_id);
 }
 
 fml::RefPtr<ComponentElement> ElementManager::CreateFiberComponent(
     const base::String &component_id, int32_t css_id,
     const base::String &entry_name, const base::String &name,
     const base::String &path) {
-  auto res = fml::AdoptRef<ComponentElement>(
-      new ComponentElement(this, component_id, css_id, entry_name, name, path));
+  auto res = FiberElement::Create<ComponentElement>(
+      element_arena(), this, component_id, css_id, entry_name, name, path);
   return res;
 }
 
 fml::RefPtr<ViewElement> ElementManager::CreateFiberView() {
-  auto res = fml::AdoptRef<ViewElement>(new ViewElement(this));
+  auto res = FiberElement::Create<ViewElement>(element_arena(), this);
   return res;
 }
 
 fml::RefPtr<ImageElement> ElementManager::CreateFiberImage(
     const base::String &tag) {
-  auto res = fml::AdoptRef<ImageElement>(new ImageElement(this, tag));
+  auto res = FiberElement::Create<ImageElement>(element_arena(), this, tag);
   return res;
 }
 
 fml::RefPtr<TextElement> ElementManager::CreateFiberText(
     const base::String &tag) {
-  auto res = fml::AdoptRef<TextElement>(new TextElement(this, tag));
+  auto res = FiberElement::Create<TextElement>(element_arena(), this, tag);
   return res;
 }
 
 fml::RefPtr<RawTextElement> ElementManager::CreateFiberRawText() {
-  return fml::AdoptRef<RawTextElement>(new RawTextElement(this));
+  return FiberElement::Create<RawTextElement>(element_arena(), this);
 }
 
 fml::RefPtr<ScrollElement> ElementManager::CreateFiberScrollView(
     const base::String &tag) {
-  auto res = fml::AdoptRef<ScrollElement>(new ScrollElement(this, tag));
+  auto res = FiberElement::Create<ScrollElement>(element_arena(), this, tag);
   return res;
 }
 
@@ -1249,24 +1291,25 @@ fml::RefPtr<ListElement> ElementManager::CreateFiberList(
     const lepus::Value &component_at_index,
     const lepus::Value &enqueue_component,
     const lepus::Value &component_at_indexes) {
-  auto res = fml::AdoptRef<ListElement>(new ListElement(
-      this, tag, component_at_index, enqueue_component, component_at_indexes));
+  auto res = FiberElement::Create<ListElement>(
+      element_arena(), this, tag, component_at_index, enqueue_component,
+      component_at_indexes);
   res->set_tasm(tasm);
   return res;
 }
 
 fml::RefPtr<NoneElement> ElementManager::CreateFiberNoneElement() {
-  auto res = fml::AdoptRef<NoneElement>(new NoneElement(this));
+  auto res = FiberElement::Create<NoneElement>(element_arena(), this);
   return res;
 }
 
 fml::RefPtr<WrapperElement> ElementManager::CreateFiberWrapperElement() {
-  auto res = fml::AdoptRef<WrapperElement>(new WrapperElement(this));
+  auto res = FiberElement::Create<WrapperElement>(element_arena(), this);
   return res;
 }
 
 fml::RefPtr<FrameElement> ElementManager::CreateFiberFrame() {
-  auto res = fml::AdoptRef<FrameElement>(new FrameElement(this));
+  auto res = FiberElement::Create<FrameElement>(element_arena(), this);
   return res;
 }
 
@@ -1380,7 +1423,10 @@ void ElementManager::OnPatchFinishForFiber(
         [](FiberElement *element) { element->onNodeReload(); });
     catalyzer_->painting_context()->UpdateNodeReloadPatching();
   }
+  ApplyPendingStyleInvalidations();
   element->FlushActionsAsRoot();
+  TRACE_COUNTER(LYNX_TRACE_CATEGORY, ELEMENT_MANAGER_RESTYLED_ELEMENTS_COUNTER,
+                restyled_element_count_.exchange(0, std::memory_order_relaxed));
 
   BindTimingFlagToPipelineOptions(options);
 
@@ -1544,6 +1590,11 @@ void ElementManager::RegisterVMUpdateOuterObjSizeCallback(
   vm_update_outer_obj_size_callback_ = std::move(closure);
 }
 
+void ElementManager::RegisterWillFinishRadonPatchCallback(
+    base::MoveOnlyClosure<void> closure) {
+  will_finish_radon_patch_callback_ = std::move(closure);
+}
+
 void ElementManager::UpdateElementMemoryUsage(int size) {
   if (enable_fiber_element_memory_reporter_ &&
       vm_update_outer_obj_size_callback_ != nullptr) {
@@ -10,6 +10,7 @@
 #include <list>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -30,6 +31,7 @@
 #include "core/renderer/css/computed_css_style.h"
 #include "core/renderer/css/css_variable_handler.h"
 #include "core/renderer/dom/element.h"
+#include "core/renderer/dom/element_arena.h"
 #include "core/renderer/dom/element_container.h"
 #include "core/renderer/dom/element_context_delegate.h"
 #include "core/renderer/dom/element_context_task_queue.h"
@@ -131,6 +133,18 @@ class NodeManager {
     return remaining_element_count * element_memory_size;
   }
 
+  // Unlike GetTotalMemoryUsage(), walks every live element and breaks the
+  // usage down by element tag and by subsystem.
+  ElementMemoryReport GetMemoryReport() const {
+    ElementMemoryReport report;
+    for (const auto &pair : node_map_) {
+      if (pair.second) {
+        pair.second->CollectMemoryUsage(report);
+      }
+    }
+    return report;
+  }
+
  private:
   using NodeMap = boost::unordered_flat_map<int, Element *, std::hash<int>,
                                             std::equal_to<int>>;
@@ -557,6 +571,10 @@ class ElementManager : public ElementContextDelegate {
     return true;
   }
 
+  // Arena of the fiber elements and layout nodes of this page, null when the
+  // arena is disabled.
+  ElementArena *element_arena() const { return element_arena_.get(); }
+
   const starlight::LayoutConfigs &GetLayoutConfigs() const {
     return layout_configs_;
   }
@@ -642,6 +660,13 @@ class ElementManager : public ElementContextDelegate {
     return false;
   }
 
+  size_t GetListReusePoolCapacity(const base::String &reuse_identifier) {
+    if (config_) {
+      return config_->GetListReusePoolCapacity(reuse_identifier.str());
+    }
+    return 0;
+  }
+
   bool GetListEnableMoveOperation() {
     if (config_) {
       return config_->GetEnableListMoveOperation();
@@ -708,6 +733,19 @@ class ElementManager : public ElementContextDelegate {
       dirty_stacking_contexts_.erase(it);
   }
 
+  // Queue an element whose invalidation lists are not empty, the lists are
+  // applied before the next flush so that only the elements selected by the
+  // invalidation sets get their style recalculated. The |lists| collected on
+  // the TASM worker are merged into the element's lists when applied. Thread
+  // safe.
+  void ScheduleStyleInvalidation(fml::RefPtr<FiberElement> element,
+                                 css::InvalidationLists lists = {});
+  void ApplyPendingStyleInvalidations();
+
+  inline void IncreaseRestyledElementCount() {
+    restyled_element_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
   std::string GetTargetSdkVersion() {
     return config_ ? config_->GetTargetSDKVersion() : "";
   }
@@ -760,6 +798,10 @@ class ElementManager : public ElementContextDelegate {
     return config_ ? config_->GetEnableReloadLifecycle() : false;
   }
 
+  bool GetEnableComponentMemo() const {
+    return config_ ? config_->GetEnableComponentMemo() : false;
+  }
+
   bool GetEnableMultiTouchParamsCompatible() const {
     return config_ ? config_->GetEnableMultiTouchParamsCompatible() : false;
   }
@@ -844,13 +886,16 @@ class ElementManager : public ElementContextDelegate {
    *
    * @param enum_tag The enum representation of the tag name.
    * @param raw_tag The raw tag name of the Dom Element.
+   * @param arena The arena to allocate the element from, the system allocator
+   * is used if null.
    * @return The refCounted FiberElement.
    * Note: If the enum tag is 'ELEMENT_EMPTY', the Fiber Element will be created
    * using the raw tag name.
    */
   static fml::RefPtr<FiberElement> StaticCreateFiberElement(
       ElementBuiltInTagEnum enum_tag,
-      const base::String &raw_tag = base::String());
+      const base::String &raw_tag = base::String(),
+      ElementArena *arena = nullptr);
 
   /**
    * create common Element via tag name
@@ -1137,6 +1182,11 @@ class ElementManager : public ElementContextDelegate {
   void RegisterVMUpdateOuterObjSizeCallback(
       base::MoveOnlyClosure<void, int> closure);
 
+  // Runs when a radon patch is about to finish, before its element changes
+  // are laid out and flushed, so the callback can add its own.
+  void RegisterWillFinishRadonPatchCallback(
+      base::MoveOnlyClosure<void> closure);
+
   void UpdateElementMemoryUsage(int size);
 
   inline bool EnableFiberElementMemoryReport() {
@@ -1160,6 +1210,7 @@ class ElementManager : public ElementContextDelegate {
   void PrepareComponentNodeForInspector(Element *component);
 
   std::unique_ptr<NodeManager> node_manager_;
+  fml::RefPtr<ElementArena> element_arena_;
   std::unique_ptr<AirNodeManager> air_node_manager_;
   std::unique_ptr<ComponentManager> component_manager_;
   std::unique_ptr<Catalyzer> catalyzer_;
@@ -1282,6 +1333,17 @@ class ElementManager : public ElementContextDelegate {
 
   base::InlineLinearFlatSet<ElementContainer *, 4> dirty_stacking_contexts_;
 
+  struct PendingStyleInvalidation {
+    fml::RefPtr<FiberElement> element;
+    css::InvalidationLists lists;
+  };
+  // Also queued from the TASM worker.
+  std::mutex pending_style_invalidations_mutex_;
+  std::vector<PendingStyleInvalidation> pending_style_invalidations_;
+  // Elements whose style got resolved since the last flush, may be increased
+  // from the threads of the parallel flush.
+  std::atomic<uint32_t> restyled_element_count_{0};
+
   // TODO(yuyang), check this
   // This set holds the unique_id of the already flushed keyframes to ensure
   // that they are not flushed repeatedly.
@@ -1305,6 +1367,8 @@ class ElementManager : public ElementContextDelegate {
 
   base::MoveOnlyClosure<void, int> vm_update_outer_obj_size_callback_{};
 
+  base::MoveOnlyClosure<void> will_finish_radon_patch_callback_{};
+
   ALLOW_UNUSED_TYPE int64_t record_id_{0};
   ALLOW_UNUSED_TYPE std::map<lynx::devtool::DevToolFunction,
                              std::function<void(const base::any &)>>
@@ -89,6 +89,29 @@ TEST_F(ElementManagerTest, TestCalcTotalMemoryDiff) {
   EXPECT_EQ(total_memory_diff, expected_total_memory);
 }
 
+TEST_F(ElementManagerTest, ElementMemoryReport) {
+  manager->config_->SetEnableFiberArch(true);
+  auto view = manager->CreateFiberNode("view");
+  auto text = manager->CreateFiberNode("text");
+  auto part = manager->CreateFiberNode("view");
+  part->MarkPartElement(base::String("part"));
+
+  auto report = manager->node_manager()->GetMemoryReport();
+  EXPECT_EQ(report.element_count(), 3u);
+  EXPECT_EQ(report.tags().at("view").count, 2u);
+  EXPECT_EQ(report.tags().at("text").count, 1u);
+  EXPECT_EQ(report.subsystem_bytes(ElementMemoryReport::kElement),
+            3 * sizeof(FiberElement));
+  // Only the part element allocates its cold data.
+  EXPECT_GT(report.subsystem_bytes(ElementMemoryReport::kColdData), 0u);
+  EXPECT_EQ(part->GetMemoryUsage(),
+            view->GetMemoryUsage() +
+                report.subsystem_bytes(ElementMemoryReport::kColdData));
+  EXPECT_EQ(report.tags().at("view").bytes + report.tags().at("text").bytes,
+            report.total_bytes());
+  EXPECT_FALSE(report.ToString().empty());
+}
+
 TEST_F(ElementManagerTest, CreateFiberComponent) {
   base::String component_id("21");
   int32_t css_id = 100;
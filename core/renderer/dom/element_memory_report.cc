@@ -0,0 +1,68 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/element_memory_report.h"
+
+#include <sstream>
+
+namespace lynx {
+namespace tasm {
+
+const char* ElementMemoryReport::SubsystemName(Subsystem subsystem) {
+  switch (subsystem) {
+    case kElement:
+      return "element";
+    case kColdData:
+      return "cold_data";
+    case kLayoutNode:
+      return "layout_node";
+    case kStyles:
+      return "styles";
+    case kAttributes:
+      return "attributes";
+    case kPseudoElements:
+      return "pseudo_elements";
+    default:
+      return "unknown";
+  }
+}
+
+void ElementMemoryReport::BeginElement(const std::string& tag) {
+  ++element_count_;
+  current_tag_ = &tags_[tag];
+  ++current_tag_->count;
+}
+
+void ElementMemoryReport::Add(Subsystem subsystem, size_t bytes) {
+  if (subsystem < kElement || subsystem >= kSubsystemCount) {
+    return;
+  }
+  subsystem_bytes_[subsystem] += bytes;
+  total_bytes_ += bytes;
+  if (current_tag_ != nullptr) {
+    current_tag_->bytes += bytes;
+  }
+}
+
+size_t ElementMemoryReport::AverageElementBytes() const {
+  return element_count_ == 0 ? 0 : total_bytes_ / element_count_;
+}
+
+std::string ElementMemoryReport::ToString() const {
+  std::ostringstream out;
+  out << "elements: " << element_count_ << ", bytes: " << total_bytes_
+      << ", bytes per element: " << AverageElementBytes() << "\n";
+  for (int i = kElement; i < kSubsystemCount; ++i) {
+    out << "  " << SubsystemName(static_cast<Subsystem>(i)) << ": "
+        << subsystem_bytes_[i] << "\n";
+  }
+  for (const auto& [tag, usage] : tags_) {
+    out << "  <" << tag << "> count: " << usage.count
+        << ", bytes: " << usage.bytes << "\n";
+  }
+  return out.str();
+}
+
+}  // namespace tasm
+}  // namespace lynx
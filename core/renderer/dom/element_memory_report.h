@@ -0,0 +1,73 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_DOM_ELEMENT_MEMORY_REPORT_H_
+#define CORE_RENDERER_DOM_ELEMENT_MEMORY_REPORT_H_
+
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace lynx {
+namespace tasm {
+
+// Memory retained by the elements of a page, broken down by element tag and
+// by subsystem. Container sizes are estimated from their element counts, the
+// report is meant to compare pages and spot regressions rather than to match
+// the allocator statistics exactly.
+class ElementMemoryReport {
+ public:
+  enum Subsystem {
+    // The element object itself.
+    kElement = 0,
+    // Out of line state of rarely used features.
+    kColdData,
+    // Layout node owned by the element.
+    kLayoutNode,
+    // Parsed and inline styles.
+    kStyles,
+    // Attributes and builtin attributes.
+    kAttributes,
+    // Pseudo elements.
+    kPseudoElements,
+    kSubsystemCount,
+  };
+
+  struct TagUsage {
+    size_t count{0};
+    size_t bytes{0};
+  };
+
+  static const char* SubsystemName(Subsystem subsystem);
+
+  // Starts the accounting of one element, the following Add() calls are
+  // attributed to tag.
+  void BeginElement(const std::string& tag);
+  void Add(Subsystem subsystem, size_t bytes);
+
+  size_t element_count() const { return element_count_; }
+  size_t total_bytes() const { return total_bytes_; }
+  size_t subsystem_bytes(Subsystem subsystem) const {
+    return subsystem_bytes_[subsystem];
+  }
+  const std::map<std::string, TagUsage>& tags() const { return tags_; }
+
+  // Bytes per element, or 0 if the report is empty.
+  size_t AverageElementBytes() const;
+
+  // Human readable dump, one line per subsystem and per tag.
+  std::string ToString() const;
+
+ private:
+  size_t element_count_{0};
+  size_t total_bytes_{0};
+  size_t subsystem_bytes_[kSubsystemCount] = {};
+  std::map<std::string, TagUsage> tags_;
+  TagUsage* current_tag_{nullptr};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_DOM_ELEMENT_MEMORY_REPORT_H_
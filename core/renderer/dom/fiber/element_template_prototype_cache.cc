@@ -0,0 +1,132 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/fiber/element_template_prototype_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/trace/native/trace_event.h"
+#include "core/renderer/dom/fiber/fiber_element.h"
+#include "core/renderer/dom/fiber/tree_resolver.h"
+#include "core/renderer/trace/renderer_trace_event_def.h"
+#include "core/renderer/utils/base/element_template_info.h"
+#include "core/renderer/utils/lynx_env.h"
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+// Clones |element| and its subtree. Every clone shares the style snapshot of
+// its source element, which is created first if |create_snapshots|.
+fml::RefPtr<FiberElement> CloneSharingStyleSnapshots(FiberElement* element,
+                                                     bool create_snapshots) {
+  if (create_snapshots) {
+    element->SetPrototypeStyleSnapshot(
+        std::make_shared<PrototypeStyleSnapshot>());
+  }
+  fml::RefPtr<FiberElement> res = element->CloneElement(false);
+  res->SetPrototypeStyleSnapshot(element->prototype_style_snapshot());
+  for (const auto& child : element->children()) {
+    res->InsertNode(CloneSharingStyleSnapshots(child.get(), create_snapshots));
+  }
+  return res;
+}
+
+}  // namespace
+
+bool PrototypeStyleSnapshot::Inputs::operator==(const Inputs& other) const {
+  return style_sheet_manager == other.style_sheet_manager &&
+         css_id == other.css_id && id_selector == other.id_selector &&
+         classes.size() == other.classes.size() &&
+         std::equal(classes.begin(), classes.end(), other.classes.begin());
+}
+
+bool PrototypeStyleSnapshot::Load(const Inputs& inputs,
+                                  StyleMap& styles) const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!inputs_.has_value() || !(*inputs_ == inputs)) {
+    return false;
+  }
+  styles = styles_;
+  return true;
+}
+
+void PrototypeStyleSnapshot::Store(Inputs inputs, const StyleMap& styles) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (inputs_.has_value()) {
+    return;
+  }
+  inputs_ = std::move(inputs);
+  styles_ = styles;
+}
+
+ElementTemplatePrototypeCache::~ElementTemplatePrototypeCache() = default;
+
+ElementTemplatePrototypeCache::Elements
+ElementTemplatePrototypeCache::Instantiate(const std::string& key,
+                                           const ElementTemplateInfo& info) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, ELEMENT_TEMPLATE_PROTOTYPE_INSTANTIATE);
+  if (!LynxEnv::GetInstance().EnableElementTemplatePrototype()) {
+    return TreeResolver::FromTemplateInfo(info);
+  }
+
+  auto prototype = GetOrCreatePrototype(key);
+  // Only instances of the same template wait for each other.
+  std::lock_guard<std::mutex> lock(prototype->mutex);
+  if (!prototype->built) {
+    // The first instance is the one built from the template info, the
+    // prototype is cloned from it before it is handed out.
+    TRACE_EVENT(LYNX_TRACE_CATEGORY, ELEMENT_TEMPLATE_PROTOTYPE_BUILD);
+    auto res = TreeResolver::FromTemplateInfo(info);
+    prototype->elements.reserve(res.size());
+    for (const auto& element : res) {
+      prototype->elements.emplace_back(
+          CloneSharingStyleSnapshots(element.get(), true));
+    }
+    prototype->built = true;
+    return res;
+  }
+
+  Elements res;
+  res.reserve(prototype->elements.size());
+  for (const auto& element : prototype->elements) {
+    res.emplace_back(CloneSharingStyleSnapshots(element.get(), false));
+  }
+  return res;
+}
+
+size_t ElementTemplatePrototypeCache::PrototypeCount() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return prototypes_.size();
+}
+
+void ElementTemplatePrototypeCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  prototypes_.clear();
+}
+
+std::shared_ptr<ElementTemplatePrototypeCache::Prototype>
+ElementTemplatePrototypeCache::GetOrCreatePrototype(const std::string& key) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = prototypes_.find(key);
+  if (it == prototypes_.end()) {
+    if (prototypes_.size() >= kMaxPrototypeCount) {
+      // Instances being created from the evicted prototype keep it alive.
+      auto lru = std::min_element(
+          prototypes_.begin(), prototypes_.end(),
+          [](const auto& lhs, const auto& rhs) {
+            return lhs.second->last_use < rhs.second->last_use;
+          });
+      prototypes_.erase(lru);
+    }
+    it = prototypes_.emplace(key, std::make_shared<Prototype>()).first;
+  }
+  it->second->last_use = ++use_count_;
+  return it->second;
+}
+
+}  // namespace tasm
+}  // namespace lynx
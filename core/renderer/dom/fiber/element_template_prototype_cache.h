@@ -0,0 +1,107 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_DOM_FIBER_ELEMENT_TEMPLATE_PROTOTYPE_CACHE_H_
+#define CORE_RENDERER_DOM_FIBER_ELEMENT_TEMPLATE_PROTOTYPE_CACHE_H_
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+#include "base/include/fml/memory/ref_ptr.h"
+#include "base/include/vector.h"
+#include "core/renderer/css/css_property.h"
+#include "core/renderer/utils/base/base_def.h"
+
+namespace lynx {
+namespace tasm {
+
+class CSSStyleSheetManager;
+class FiberElement;
+struct ElementTemplateInfo;
+
+// The styles resolved for one element of a template prototype. They are
+// stored by the first instance whose resolution depended on nothing but its
+// own selectors, and loaded by the later instances which have the same
+// selectors when they are resolved for the first time, see
+// FiberElement::RefreshStyle().
+// Instances may be resolved concurrently by the parallel flush, the snapshot
+// is thread safe.
+class PrototypeStyleSnapshot {
+ public:
+  struct Inputs {
+    const CSSStyleSheetManager* style_sheet_manager{nullptr};
+    int32_t css_id{0};
+    base::String id_selector;
+    ClassList classes;
+
+    bool operator==(const Inputs& other) const;
+  };
+
+  // Copies the stored styles into |styles| if they were resolved from the
+  // same inputs.
+  bool Load(const Inputs& inputs, StyleMap& styles) const;
+  // Only the first store is kept.
+  void Store(Inputs inputs, const StyleMap& styles);
+
+ private:
+  mutable std::mutex mutex_;
+  std::optional<Inputs> inputs_;
+  StyleMap styles_;
+};
+
+// Keeps a detached prototype of the element templates instantiated so far.
+// The first instantiation of a template builds the instance from its
+// ElementTemplateInfo and clones the prototype from it. Later instances are
+// cloned from the prototype, which copies the selectors, inline and parsed
+// styles, attributes, events and configs in bulk instead of replaying every
+// ElementInfo field through the element setters, and share the styles
+// resolved by the first instance through PrototypeStyleSnapshot.
+// At most kMaxPrototypeCount prototypes are kept, the least recently used
+// one is evicted first.
+// Instances may be created concurrently by the main thread and the parallel
+// parse tasks, the cache is thread safe.
+class ElementTemplatePrototypeCache {
+ public:
+  using Elements = base::Vector<fml::RefPtr<FiberElement>>;
+
+  static constexpr size_t kMaxPrototypeCount = 64;
+
+  ElementTemplatePrototypeCache() = default;
+  ~ElementTemplatePrototypeCache();
+
+  ElementTemplatePrototypeCache(const ElementTemplatePrototypeCache&) = delete;
+  ElementTemplatePrototypeCache& operator=(
+      const ElementTemplatePrototypeCache&) = delete;
+
+  // Returns a new detached instance of the template. Falls back to
+  // TreeResolver::FromTemplateInfo() when prototypes are disabled by
+  // LynxEnv.
+  Elements Instantiate(const std::string& key,
+                       const ElementTemplateInfo& info);
+
+  size_t PrototypeCount();
+  void Clear();
+
+ private:
+  struct Prototype {
+    std::mutex mutex;
+    bool built{false};
+    Elements elements;
+    uint64_t last_use{0};
+  };
+
+  std::shared_ptr<Prototype> GetOrCreatePrototype(const std::string& key);
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<Prototype>> prototypes_;
+  uint64_t use_count_{0};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_DOM_FIBER_ELEMENT_TEMPLATE_PROTOTYPE_CACHE_H_
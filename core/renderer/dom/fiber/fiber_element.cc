@@ -52,6 +52,7 @@
 #include "core/services/event_report/event_tracker.h"
 #include "core/services/feature_count/feature_counter.h"
 #include "core/services/feature_count/global_feature_counter.h"
+#include "core/services/timing_handler/timing.h"
 #include "core/value_wrapper/value_impl_lepus.h"
 
 namespace lynx {
@@ -112,8 +113,7 @@ FiberElement::FiberElement(const FiberElement &element,
       reset_inherited_ids_(element.reset_inherited_ids_),
       updated_attr_map_(element.updated_attr_map_),
       builtin_attr_map_(element.builtin_attr_map_),
-      reset_attr_vec_(element.reset_attr_vec_),
-      part_id_(element.part_id_) {
+      reset_attr_vec_(element.reset_attr_vec_) {
   SetAttributeHolder(
       fml::MakeRefCounted<AttributeHolder>(*element.data_model()));
   data_model_->SetCSSVariableBundle(*element.data_model());
@@ -134,10 +134,16 @@ FiberElement::FiberElement(const FiberElement &element,
     }
   }
 
+  if (element.IsPartElement()) {
+    EnsureColdData().part_id = element.cold_data_->part_id;
+  }
+
   if (element.config().IsTable() && element.config().GetLength() > 0) {
-    config_ = lepus::Value::ShallowCopy(element.config()).Table();
+    EnsureColdData().config =
+        lepus::Value::ShallowCopy(element.config()).Table();
   }
 
+  is_async_flush_root_ = element.is_async_flush_root_;
   element_context_delegate_ = element.element_context_delegate_;
   // TODO(wujintian): Clone animation-related objects.
 }
@@ -471,6 +477,7 @@ void FiberElement::AsyncPostResolveTaskToThreadPool() {
   if ((dirty_ & ~kDirtyTree) != 0) {
     UpdateResolveStatus(AsyncResolveStatus::kPrepareTriggered);
     element_manager()->GetTasmWorkerTaskRunner()->PostTask([this]() mutable {
+      CSSStyleSheetManager::ReadScope css_read_scope;
       UpdateResolveStatus(AsyncResolveStatus::kPreparing);
       ResolveParentComponentElement();
       if (parent()) {
@@ -522,7 +529,7 @@ void FiberElement::InsertNode(const fml::RefPtr<Element> &raw_child,
   if (element_manager() && element_manager()->IsAirModeFiberEnabled() &&
       child->is_block()) {
     child->set_parent(this);
-    scoped_virtual_children_->push_back(child);
+    EnsureColdData().scoped_virtual_children.push_back(child);
     return;
   }
   // ref_node: nullptr: means to append this node to the end
@@ -795,9 +802,9 @@ void FiberElement::SetBuiltinAttribute(ElementBuiltInAttributeEnum key,
       break;
     case ElementBuiltInAttributeEnum::CONFIG:
       if (value.IsTable()) {
-        config_ = value.Table();
+        EnsureColdData().config = value.Table();
       } else if (value.IsJSTable()) {
-        config_ = value.ToLepusValue().Table();
+        EnsureColdData().config = value.ToLepusValue().Table();
       } else {
         DCHECK(false);
       }
@@ -848,10 +855,18 @@ void FiberElement::SetIdSelector(const base::String &idSelector) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, FIBER_ELEMENT_SET_ID_SELECTOR);
   if (element_manager() && element_manager()->GetEnableStandardCSSSelector()) {
     if (element_manager()->CSSFragmentParsingOnTASMWorkerMTSRender()) {
+      // Same as the class changes, only the invalidation sets are collected
+      // on the worker.
       element_manager()->GetTasmWorkerTaskRunner()->PostTask(
-          [this, old_id = data_model_->idSelector().str(),
-           new_id = idSelector.str()]() {
-            CheckHasInvalidationForId(old_id, new_id);
+          [element = fml::RefPtr<FiberElement>(this),
+           old_id = data_model_->idSelector().str(),
+           new_id = idSelector.str()]() mutable {
+            CSSStyleSheetManager::ReadScope css_read_scope;
+            css::InvalidationLists lists;
+            element->CollectInvalidationForId(old_id, new_id, lists);
+            auto *manager = element->element_manager();
+            manager->ScheduleStyleInvalidation(std::move(element),
+                                               std::move(lists));
           });
     } else {
       CheckHasInvalidationForId(data_model_->idSelector().str(),
@@ -942,7 +957,7 @@ void FiberElement::ResetDirectionAwareProperty(const CSSPropertyID &id,
                            ? direction_mapping.rtl_property_
                            : direction_mapping.ltr_property_;
     ResetCSSValue(tran_css_id);
-    (*pending_updated_direction_related_styles_)[css_id] = {
+    EnsureColdData().pending_updated_direction_related_styles[css_id] = {
         value, direction_mapping.is_logic_};
   }
 }
@@ -989,6 +1004,9 @@ void FiberElement::ResolveCSSStyles(
 
     RefreshStyle(parsed_styles, reset_style_ids,
                  force_use_current_parsed_style_map);
+    if (element_manager()) {
+      element_manager()->IncreaseRestyledElementCount();
+    }
 
     dirty_ &= ~kDirtyStyle;
   } else if (dirty_ & kDirtyRefreshCSSVariables) {
@@ -1241,13 +1259,14 @@ void FiberElement::ResolveCSSStyles(
 
   // direction change: we always handle direction change after all styles
   // resolved
-  if (pending_updated_direction_related_styles_.has_value()) {
-    for (const auto &style_pair : *pending_updated_direction_related_styles_) {
+  if (HasPendingDirectionRelatedStyles()) {
+    for (const auto &style_pair :
+         cold_data_->pending_updated_direction_related_styles) {
       TryDoDirectionRelatedCSSChange(style_pair.first, style_pair.second.first,
                                      style_pair.second.second);
     }
     if (!element_manager_->FixFontSizeOverrideDirectionChangeBug()) {
-      pending_updated_direction_related_styles_.reset();
+      cold_data_->pending_updated_direction_related_styles.clear();
     }
   }
 
@@ -1313,15 +1332,17 @@ void FiberElement::ResolveCSSStyles(
       for (const auto &style : parsed_styles_map_) {
         bool need_handle_pending_updated_direction_related_style =
             element_manager_->FixFontSizeOverrideDirectionChangeBug() &&
-            pending_updated_direction_related_styles_.has_value() &&
-            pending_updated_direction_related_styles_->find(style.first) !=
-                pending_updated_direction_related_styles_->end();
+            HasPendingDirectionRelatedStyles() &&
+            cold_data_->pending_updated_direction_related_styles.find(
+                style.first) !=
+                cold_data_->pending_updated_direction_related_styles.end();
         if (style.first != CSSPropertyID::kPropertyIDFontSize &&
             should_update_em_rem_style(style, root_font_size_changed) &&
             update_map.find(style.first) == update_map.end()) {
           if (need_handle_pending_updated_direction_related_style) {
             auto style_pair =
-                *pending_updated_direction_related_styles_->find(style.first);
+                *cold_data_->pending_updated_direction_related_styles.find(
+                    style.first);
             TryDoDirectionRelatedCSSChange(style.first, style_pair.second.first,
                                            style_pair.second.second);
           } else {
@@ -1335,9 +1356,9 @@ void FiberElement::ResolveCSSStyles(
   }
 
   if (element_manager_->FixFontSizeOverrideDirectionChangeBug() &&
-      pending_updated_direction_related_styles_.has_value()) {
+      HasPendingDirectionRelatedStyles()) {
     // reset cached style map impacted by direction
-    pending_updated_direction_related_styles_.reset();
+    cold_data_->pending_updated_direction_related_styles.clear();
   }
 
   // Report when enableNewAnimator is the default value.
@@ -1592,10 +1613,12 @@ void FiberElement::FlushActions() {
   // Throw exception on purpose to catch logic flaw
   DCHECK(dirty_ == 0);
 
-  for (auto *invalidation_set : invalidation_lists_.descendants) {
-    InvalidateChildren(invalidation_set);
+  // Invalidations which were not applied by the element manager before the
+  // flush, e.g. when flushing a list item.
+  if (!invalidation_lists_.IsEmpty()) {
+    ApplyInvalidationLists(invalidation_lists_, false);
+    invalidation_lists_.Clear();
   }
-  invalidation_lists_.descendants.clear_and_shrink();
 
   // Step III: recursively call FlushActions for each child
   for (const auto &child : scoped_children_) {
@@ -1716,6 +1739,7 @@ void FiberElement::PostResolveTaskToThreadPool(
               }
             });
 
+        CSSStyleSheetManager::ReadScope css_read_scope;
         target->UpdateResolveStatus(AsyncResolveStatus::kResolving);
         target->parallel_flush_ = true;
         promise.set_value(target->PrepareForCreateOrUpdate());
@@ -2028,18 +2052,16 @@ void FiberElement::MarkPlatformNodeDestroyed() {
       child->render_parent_ = nullptr;
     }
   }
-  if (scoped_virtual_children_.has_value()) {
-    for (size_t i = 0; i < scoped_virtual_children_->size(); ++i) {
-      auto *virtual_child =
-          static_cast<FiberElement *>((*scoped_virtual_children_)[i].get());
+  if (cold_data_) {
+    for (const auto &virtual_child : cold_data_->scoped_virtual_children) {
       if (virtual_child->parent_ == this) {
         virtual_child->parent_ = nullptr;
       }
     }
+    cold_data_->scoped_virtual_children.clear();
   }
   // clear element's children only in radon or radon compatible mode.
   scoped_children_.clear();
-  scoped_virtual_children_.reset();
 }
 
 bool FiberElement::InComponent() const {
@@ -2257,6 +2279,7 @@ void FiberElement::PerformElementContainerCreateOrUpdate(bool need_update) {
     FlushProps();
     dirty_ &= ~kDirtyCreated;
   } else if (need_update || dirty_ & kDirtyForceUpdate) {
+    TimingCollector::Instance()->Count(FrameCounter::kElementsUpdated);
     if (prop_bundle_) {
       TriggerElementUpdate();
     }
@@ -2543,12 +2566,13 @@ void FiberElement::SetParsedStyles(StyleMap &&parsed_styles,
 void FiberElement::AddConfig(const base::String &key,
                              const lepus::Value &value) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, FIBER_ELEMENT_ADD_CONFIG);
-  if (config_ == nullptr) {
-    config_ = lepus::Dictionary::Create();
-  } else if (config_->IsConst()) {
-    config_ = lepus::Value::ShallowCopy(lepus::Value(config_)).Table();
+  auto &config = EnsureColdData().config;
+  if (config == nullptr) {
+    config = lepus::Dictionary::Create();
+  } else if (config->IsConst()) {
+    config = lepus::Value::ShallowCopy(lepus::Value(config)).Table();
   }
-  config_->SetValue(key, value);
+  config->SetValue(key, value);
 }
 
 void FiberElement::SetConfig(const lepus::Value &config) {
@@ -2558,9 +2582,9 @@ void FiberElement::SetConfig(const lepus::Value &config) {
   // calling SetConfig, and the check and LOGW in SetConfig are no longer
   // performed.
   if (config.IsTable()) {
-    config_ = config.Table();
+    EnsureColdData().config = config.Table();
   } else if (config.IsJSTable()) {
-    config_ = config.ToLepusValue().Table();
+    EnsureColdData().config = config.ToLepusValue().Table();
   } else {
     DCHECK(false);
   }
@@ -2662,7 +2686,8 @@ void FiberElement::RecursivelyMarkChildrenCSSVariableDirty(
 
 void FiberElement::EnsureSLNode() {
   if (EnableLayoutInElementMode() && sl_node_ == nullptr) {
-    sl_node_ = std::make_unique<SLNode>(
+    sl_node_ = ElementArena::MakeUnique<SLNode>(
+        element_manager()->element_arena(),
         element_manager()->GetLayoutConfigs(),
         computed_css_style()->GetLayoutComputedStyle());
     if (is_page()) {
@@ -2672,6 +2697,33 @@ void FiberElement::EnsureSLNode() {
   }
 }
 
+void FiberElement::CollectMemoryUsage(ElementMemoryReport &report) const {
+  report.BeginElement(tag_.str());
+  report.Add(ElementMemoryReport::kElement, sizeof(*this));
+  if (cold_data_) {
+    report.Add(ElementMemoryReport::kColdData, sizeof(ColdData));
+    report.Add(ElementMemoryReport::kPseudoElements,
+               cold_data_->pseudo_elements.size() * sizeof(PseudoElement));
+  }
+  if (sl_node_) {
+    report.Add(ElementMemoryReport::kLayoutNode, sizeof(SLNode));
+  }
+  size_t style_bytes =
+      parsed_styles_map_.size() * sizeof(StyleMap::value_type);
+  if (current_raw_inline_styles_.has_value()) {
+    style_bytes += current_raw_inline_styles_->size() *
+                   sizeof(RawLepusStyleMap::value_type);
+  }
+  report.Add(ElementMemoryReport::kStyles, style_bytes);
+  size_t attribute_bytes =
+      updated_attr_map_.size() * sizeof(AttrUMap::value_type);
+  if (builtin_attr_map_.has_value()) {
+    attribute_bytes +=
+        builtin_attr_map_->size() * sizeof(BuiltinAttrMap::value_type);
+  }
+  report.Add(ElementMemoryReport::kAttributes, attribute_bytes);
+}
+
 void FiberElement::EnsureLayoutBundle() {
   if (EnableLayoutInElementMode()) {
     return;
@@ -3150,6 +3202,30 @@ void FiberElement::DoFullCSSResolving() {
   }
 }
 
+bool FiberElement::CollectStyleSnapshotInputs(
+    PrototypeStyleSnapshot::Inputs &inputs) {
+  if (css_id_ == kInvalidCssId || !full_raw_inline_style_.empty() ||
+      (current_raw_inline_styles_.has_value() &&
+       !current_raw_inline_styles_->empty()) ||
+      !data_model()->css_variables_map().empty()) {
+    return false;
+  }
+  auto *fragment = GetRelatedCSSFragment();
+  if (fragment == nullptr || fragment->enable_css_selector() ||
+      fragment->HasCascadeStyle() || fragment->HasPseudoStyle()) {
+    return false;
+  }
+  fragment->InitPseudoNotStyle();
+  if (fragment->HasPseudoNotStyle()) {
+    return false;
+  }
+  inputs.style_sheet_manager = css_style_sheet_manager_.get();
+  inputs.css_id = css_id_;
+  inputs.id_selector = data_model()->idSelector();
+  inputs.classes = data_model()->classes();
+  return true;
+}
+
 const tasm::CSSValue &FiberElement::ResolveCurrentStyleValue(
     const CSSPropertyID &key, const tasm::CSSValue &default_value) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, FIBER_ELEMENT_RESOLVE_CURRENT_STYLE);
@@ -3181,7 +3257,21 @@ bool FiberElement::RefreshStyle(StyleMap &parsed_styles,
     pre_parsed_styles_map = std::move(parsed_styles_map_);
   }
   if (!has_extreme_parsed_styles_) {
-    DoFullCSSResolving();
+    // Instances of an element template prototype load the styles resolved
+    // by the first of them, the snapshot is only used once.
+    auto snapshot =
+        cold_data_ ? std::move(cold_data_->style_snapshot) : nullptr;
+    PrototypeStyleSnapshot::Inputs inputs;
+    const bool use_snapshot =
+        snapshot != nullptr && CollectStyleSnapshotInputs(inputs);
+    if (!use_snapshot || !snapshot->Load(inputs, parsed_styles_map_)) {
+      DoFullCSSResolving();
+      TimingCollector::Instance()->Count(FrameCounter::kElementsRestyled);
+      if (use_snapshot && data_model()->css_variables_map().empty() &&
+          data_model()->css_variable_related().empty()) {
+        snapshot->Store(std::move(inputs), parsed_styles_map_);
+      }
+    }
   } else {
     // if extreme_parsed_styles_ has set, we should ignore any class&inline
     // styles
@@ -3217,9 +3307,19 @@ void FiberElement::OnClassChanged(const ClassList &old_classes,
                                   const ClassList &new_classes) {
   if (element_manager() && element_manager()->GetEnableStandardCSSSelector()) {
     if (element_manager()->CSSFragmentParsingOnTASMWorkerMTSRender()) {
+      // Only the invalidation sets are collected on the worker. The element
+      // is always handed back to the element manager, so that it is applied
+      // and released on the TASM thread.
       element_manager()->GetTasmWorkerTaskRunner()->PostTask(
-          [this, old_classes_ = old_classes, new_classes_ = new_classes]() {
-            CheckHasInvalidationForClass(old_classes_, new_classes_);
+          [element = fml::RefPtr<FiberElement>(this),
+           old_classes_ = old_classes, new_classes_ = new_classes]() mutable {
+            CSSStyleSheetManager::ReadScope css_read_scope;
+            css::InvalidationLists lists;
+            element->CollectInvalidationForClass(old_classes_, new_classes_,
+                                                 lists);
+            auto *manager = element->element_manager();
+            manager->ScheduleStyleInvalidation(std::move(element),
+                                               std::move(lists));
           });
     } else {
       CheckHasInvalidationForClass(old_classes, new_classes);
@@ -3252,11 +3352,8 @@ void FiberElement::OnPseudoStatusChanged(PseudoState prev_status,
     CSSFragment::CollectPseudoChangedInvalidation(
         css_fragment, invalidation_lists, prev_status, current_status);
     data_model_->SetPseudoState(current_status);
-    for (auto *invalidation_set : invalidation_lists.descendants) {
-      if (invalidation_set->InvalidatesSelf()) {
-        MarkStyleDirty(false);
-      }
-      InvalidateChildren(invalidation_set);
+    if (!invalidation_lists.IsEmpty()) {
+      ApplyInvalidationLists(invalidation_lists, true);
       auto pipeline_options = std::make_shared<PipelineOptions>();
       element_manager_->OnPatchFinish(pipeline_options, this);
     }
@@ -3498,39 +3595,159 @@ void FiberElement::CheckDynamicUnit(CSSPropertyID id, const CSSValue &value,
 
 bool FiberElement::CheckHasInvalidationForId(const std::string &old_id,
                                              const std::string &new_id) {
+  auto old_size = invalidation_lists_.Size();
+  CollectInvalidationForId(old_id, new_id, invalidation_lists_);
+  if (invalidation_lists_.Size() == old_size) {
+    return false;
+  }
+  ScheduleStyleInvalidation();
+  return true;
+}
+
+void FiberElement::CollectInvalidationForId(const std::string &old_id,
+                                            const std::string &new_id,
+                                            css::InvalidationLists &lists) {
   auto *css_fragment = GetRelatedCSSFragment();
   // resolve styles from css fragment
   if (!css_fragment || !css_fragment->enable_css_invalidation()) {
-    return false;
+    return;
   }
-  auto old_size = invalidation_lists_.descendants.size();
-  CSSFragment::CollectIdChangedInvalidation(css_fragment, invalidation_lists_,
-                                            old_id, new_id);
-  return invalidation_lists_.descendants.size() != old_size;
+  CSSFragment::CollectIdChangedInvalidation(css_fragment, lists, old_id,
+                                            new_id);
 }
 
 bool FiberElement::CheckHasInvalidationForClass(const ClassList &old_classes,
                                                 const ClassList &new_classes) {
+  auto old_size = invalidation_lists_.Size();
+  CollectInvalidationForClass(old_classes, new_classes, invalidation_lists_);
+  if (invalidation_lists_.Size() == old_size) {
+    return false;
+  }
+  ScheduleStyleInvalidation();
+  return true;
+}
+
+void FiberElement::CollectInvalidationForClass(const ClassList &old_classes,
+                                               const ClassList &new_classes,
+                                               css::InvalidationLists &lists) {
   auto *css_fragment = GetRelatedCSSFragment();
   // resolve styles from css fragment
   if (!css_fragment || !css_fragment->enable_css_invalidation()) {
-    return false;
+    return;
   }
-  auto old_size = invalidation_lists_.descendants.size();
-  CSSFragment::CollectClassChangedInvalidation(
-      css_fragment, invalidation_lists_, old_classes, new_classes);
-  return invalidation_lists_.descendants.size() != old_size;
+  CSSFragment::CollectClassChangedInvalidation(css_fragment, lists,
+                                               old_classes, new_classes);
 }
 
-void FiberElement::InvalidateChildren(css::InvalidationSet *invalidation_set) {
-  if (invalidation_set->WholeSubtreeInvalid() || !invalidation_set->IsEmpty()) {
-    VisitChildren([invalidation_set](FiberElement *child) {
-      if (!child->StyleDirty() && !child->is_raw_text() &&
-          invalidation_set->InvalidatesElement(*child->data_model())) {
+void FiberElement::ScheduleStyleInvalidation() {
+  if (style_invalidation_scheduled_ || !element_manager()) {
+    return;
+  }
+  style_invalidation_scheduled_ = true;
+  element_manager()->ScheduleStyleInvalidation(fml::RefPtr<FiberElement>(this));
+}
+
+uint32_t FiberElement::ApplyPendingStyleInvalidations(
+    const css::InvalidationLists &lists) {
+  style_invalidation_scheduled_ = false;
+  for (auto *invalidation_set : lists.descendants) {
+    invalidation_lists_.descendants.push_back(invalidation_set);
+  }
+  for (auto *invalidation_set : lists.siblings) {
+    invalidation_lists_.siblings.push_back(invalidation_set);
+  }
+  // Detached elements keep their invalidations until they are flushed.
+  if (invalidation_lists_.IsEmpty() || IsDetached()) {
+    return 0;
+  }
+  auto invalidated_count = ApplyInvalidationLists(invalidation_lists_, false);
+  invalidation_lists_.Clear();
+  return invalidated_count;
+}
+
+uint32_t FiberElement::ApplyInvalidationLists(
+    const css::InvalidationLists &lists, bool invalidate_self) {
+  uint32_t invalidated_count = 0;
+  base::InlineVector<css::InvalidationSet *, 4> descendant_sets;
+  for (auto *invalidation_set : lists.descendants) {
+    if (invalidate_self && invalidation_set->InvalidatesSelf() &&
+        !StyleDirty()) {
+      MarkStyleDirty(false);
+      ++invalidated_count;
+    }
+    if (invalidation_set->WholeSubtreeInvalid() ||
+        !invalidation_set->IsEmpty()) {
+      descendant_sets.push_back(invalidation_set);
+    }
+  }
+  // Visit the subtree only once for all the descendant sets.
+  invalidated_count += InvalidateChildren(descendant_sets);
+
+  for (auto *invalidation_set : lists.siblings) {
+    invalidated_count += InvalidateSiblings(
+        *static_cast<css::SiblingInvalidationSet *>(invalidation_set));
+  }
+  return invalidated_count;
+}
+
+uint32_t FiberElement::InvalidateChildren(
+    const css::InvalidationSetVector &invalidation_sets) {
+  if (invalidation_sets.empty()) {
+    return 0;
+  }
+  uint32_t invalidated_count = 0;
+  VisitChildren([&invalidation_sets, &invalidated_count](FiberElement *child) {
+    if (child->StyleDirty() || child->is_raw_text()) {
+      return;
+    }
+    for (auto *invalidation_set : invalidation_sets) {
+      if (invalidation_set->InvalidatesElement(*child->data_model())) {
         child->MarkStyleDirty(false);
+        ++invalidated_count;
+        return;
       }
-    });
+    }
+  });
+  return invalidated_count;
+}
+
+uint32_t FiberElement::InvalidateSiblings(
+    const css::SiblingInvalidationSet &invalidation_set) {
+  auto *parent = static_cast<FiberElement *>(parent_);
+  if (!parent) {
+    return 0;
+  }
+  const auto &siblings = parent->children();
+  auto it = std::find_if(
+      siblings.begin(), siblings.end(),
+      [this](const auto &sibling) { return sibling.get() == this; });
+  if (it == siblings.end()) {
+    return 0;
+  }
+
+  uint32_t invalidated_count = 0;
+  unsigned remaining = invalidation_set.MaxDirectAdjacentSelectors();
+  for (++it; it != siblings.end() && remaining > 0; ++it) {
+    auto *sibling = it->get();
+    if (sibling->is_raw_text()) {
+      continue;
+    }
+    if (remaining != css::SiblingInvalidationSet::kDirectAdjacentMax) {
+      --remaining;
+    }
+    if (!invalidation_set.InvalidatesElement(*sibling->data_model())) {
+      continue;
+    }
+    if (!sibling->StyleDirty()) {
+      sibling->MarkStyleDirty(false);
+      ++invalidated_count;
+    }
+    if (auto *descendants = invalidation_set.SiblingDescendants()) {
+      invalidated_count += sibling->InvalidateChildren(
+          base::InlineVector<css::InvalidationSet *, 1>{descendants});
+    }
   }
+  return invalidated_count;
 }
 
 void FiberElement::VisitChildren(
@@ -3710,7 +3927,7 @@ void FiberElement::SetCSSID(int32_t id) {
 }
 
 FiberElement *FiberElement::root_virtual_parent() {
-  FiberElement *root_virtual = virtual_parent_;
+  FiberElement *root_virtual = virtual_parent();
   while (root_virtual && root_virtual->virtual_parent() != nullptr) {
     root_virtual = root_virtual->virtual_parent();
   }
@@ -3733,8 +3950,8 @@ void FiberElement::ResetSheetRecursively(
 void FiberElement::PrepareOrUpdatePseudoElement(PseudoState state,
                                                 StyleMap &style_map) {
   if (style_map.empty() &&
-      (!pseudo_elements_.has_value() ||
-       pseudo_elements_->find(state) == pseudo_elements_->end())) {
+      (cold_data_ == nullptr || cold_data_->pseudo_elements.find(state) ==
+                                    cold_data_->pseudo_elements.end())) {
     return;
   }
 
@@ -3743,16 +3960,15 @@ void FiberElement::PrepareOrUpdatePseudoElement(PseudoState state,
 }
 
 PseudoElement *FiberElement::CreatePseudoElementIfNeed(PseudoState state) {
-  if (pseudo_elements_.has_value()) {
-    auto it = pseudo_elements_->find(state);
-    if (it != pseudo_elements_->end()) {
-      return it->second.get();
-    }
+  auto &pseudo_elements = EnsureColdData().pseudo_elements;
+  auto it = pseudo_elements.find(state);
+  if (it != pseudo_elements.end()) {
+    return it->second.get();
   }
 
   auto new_pseudo_element = std::make_unique<PseudoElement>(state, this);
   auto result = new_pseudo_element.get();
-  (*pseudo_elements_)[state] = std::move(new_pseudo_element);
+  pseudo_elements[state] = std::move(new_pseudo_element);
   return result;
 }
 
@@ -3798,8 +4014,8 @@ void FiberElement::SetFontSizeForAllElement(double cur_node_font_size,
                                             double root_node_font_size) {
   computed_css_style()->SetFontSize(cur_node_font_size, root_node_font_size);
 
-  if (pseudo_elements_.has_value()) {
-    for (const auto &[key, pseudo_element] : *pseudo_elements_) {
+  if (cold_data_) {
+    for (const auto &[key, pseudo_element] : cold_data_->pseudo_elements) {
       pseudo_element->SetFontSize(cur_node_font_size, root_node_font_size);
     }
   }
@@ -3812,8 +4028,8 @@ void FiberElement::UpdateLengthContextValueForAllElement(
   computed_css_style()->SetViewportHeight(env_config.ViewportHeight());
   computed_css_style()->SetScreenWidth(env_config.ScreenWidth());
 
-  if (pseudo_elements_.has_value()) {
-    for (const auto &[key, pseudo_element] : *pseudo_elements_) {
+  if (cold_data_) {
+    for (const auto &[key, pseudo_element] : cold_data_->pseudo_elements) {
       pseudo_element.get()->ComputedCSSStyle()->SetFontScale(
           env_config.FontScale());
       pseudo_element.get()->ComputedCSSStyle()->SetViewportWidth(
@@ -3834,6 +4050,7 @@ void FiberElement::AsyncResolveSubtreeProperty() {
         ((dirty_ & ~kDirtyTree) != 0) && element_context_delegate_ &&
         element_context_delegate_->IsListItemElementContext()) {
       element_manager()->GetTasmWorkerTaskRunner()->PostTask([this]() mutable {
+        CSSStyleSheetManager::ReadScope css_read_scope;
         auto list_item_context_ptr =
             static_cast<ListItemSchedulerAdapter *>(element_context_delegate_);
         list_item_context_ptr->ResolveSubtreeProperty();
@@ -3856,16 +4073,17 @@ void FiberElement::AsyncResolveSubtreeProperty() {
     // TODO(ZHOUZHITAO): remove this branch once
     // ENABLE_BATCH_LAYOUT_TASK_WITH_SYNC_LAYOUT is fully rolled out
     if (element_manager()->GetEnableParallelElement() &&
-        ((dirty_ & ~kDirtyTree) != 0) && scheduler_adapter_.get()) {
+        ((dirty_ & ~kDirtyTree) != 0) && GetSchedulerAdapter()) {
       element_manager()->GetTasmWorkerTaskRunner()->PostTask([this]() mutable {
-        scheduler_adapter_->ResolveSubtreeProperty();
+        CSSStyleSheetManager::ReadScope css_read_scope;
+        GetSchedulerAdapter()->ResolveSubtreeProperty();
 
         std::promise<ParallelFlushReturn> promise;
         std::future<ParallelFlushReturn> future = promise.get_future();
         auto task_info_ptr =
             fml::MakeRefCounted<base::OnceTask<ParallelFlushReturn>>(
                 [promise = std::move(promise),
-                 scheduler = scheduler_adapter_.get()]() mutable {
+                 scheduler = GetSchedulerAdapter()]() mutable {
                   promise.set_value(
                       scheduler->GenerateReduceTaskForResolveProperty());
                 },
@@ -3888,8 +4106,10 @@ void FiberElement::CreateListItemScheduler(
     element_context_delegate_ = element_context_delegate_ptr.get();
     parent_context->OnChildElementContextAdded(element_context_delegate_ptr);
   } else {
-    scheduler_adapter_ = std::make_unique<ListItemSchedulerAdapter>(
-        this, batch_render_strategy, parent_context, continuous_resolve_tree);
+    EnsureColdData().scheduler_adapter =
+        std::make_unique<ListItemSchedulerAdapter>(this, batch_render_strategy,
+                                                   parent_context,
+                                                   continuous_resolve_tree);
   }
 }
 
@@ -3898,6 +4118,7 @@ void FiberElement::DispatchAsyncResolveSubtreeProperty() {
       ((dirty_ & ~kDirtyTree) != 0) && this->IsAttached()) {
     UpdateResolveStatus(AsyncResolveStatus::kPrepareTriggered);
     element_manager()->GetTasmWorkerTaskRunner()->PostTask([this]() mutable {
+      CSSStyleSheetManager::ReadScope css_read_scope;
       std::deque<FiberElement *> queue;
       auto root = this;
       queue.emplace_back(root);
@@ -20,8 +20,10 @@
 #include "core/renderer/css/css_style_sheet_manager.h"
 #include "core/renderer/dom/attribute_holder.h"
 #include "core/renderer/dom/element.h"
+#include "core/renderer/dom/element_arena.h"
 #include "core/renderer/dom/element_context_delegate.h"
 #include "core/renderer/dom/element_context_task_queue.h"
+#include "core/renderer/dom/fiber/element_template_prototype_cache.h"
 #include "core/renderer/dom/fiber/list_item_scheduler_adapter.h"
 #include "core/renderer/dom/fiber/pseudo_element.h"
 #include "core/renderer/dom/layout_bundle.h"
@@ -45,6 +47,19 @@ class FiberElement : public Element,
   FiberElement(ElementManager* manager, const base::String& tag,
                int32_t css_id);
 
+  // Constructs T from the page arena when possible, or from the system
+  // allocator. Elements created by the element manager come from here.
+  template <typename T, typename... Args>
+  static fml::RefPtr<T> Create(ElementArena* arena, Args&&... args) {
+    void* memory = ElementArena::TryAllocate(arena, sizeof(T));
+    if (memory == nullptr) {
+      return fml::AdoptRef<T>(new T(std::forward<Args>(args)...));
+    }
+    T* element = new (memory) T(std::forward<Args>(args)...);
+    static_cast<FiberElement*>(element)->from_arena_ = true;
+    return fml::AdoptRef<T>(element);
+  }
+
   // This function will clone an incomplete fiber element that is not attached
   // to the element manager. Before using this fiber element, it needs to be
   // attached to the element manager first.
@@ -61,7 +76,16 @@ class FiberElement : public Element,
 
   ~FiberElement() override;
 
-  void ReleaseSelf() const override { delete this; }
+  void ReleaseSelf() const override {
+    if (!from_arena_) {
+      delete this;
+      return;
+    }
+    // The block starts at the most derived object, see Create().
+    void* memory = const_cast<void*>(dynamic_cast<const void*>(this));
+    const_cast<FiberElement*>(this)->~FiberElement();
+    ElementArena::Free(memory);
+  }
 
   // Element state, used to indicate whether the current Element is on the root
   // Dom tree.
@@ -518,8 +542,10 @@ class FiberElement : public Element,
    * guarantee this element creates a writable config table.
    */
   const lepus::Value config() const {
-    return lepus::Value(
-        config_ ?: fml::RefPtr<lepus::Dictionary>(lepus::Value::DummyTable()));
+    return lepus::Value(cold_data_ && cold_data_->config
+                            ? cold_data_->config
+                            : fml::RefPtr<lepus::Dictionary>(
+                                  lepus::Value::DummyTable()));
   }
 
   virtual StyleMap GetStylesForWorklet() override;
@@ -751,9 +777,13 @@ class FiberElement : public Element,
 
   // set/get virtual parent node in AirModeFiber
   void set_virtual_parent(FiberElement* virtual_parent) {
-    virtual_parent_ = virtual_parent;
+    if (virtual_parent != nullptr || cold_data_ != nullptr) {
+      EnsureColdData().virtual_parent = virtual_parent;
+    }
+  }
+  FiberElement* virtual_parent() {
+    return cold_data_ ? cold_data_->virtual_parent : nullptr;
   }
-  FiberElement* virtual_parent() { return virtual_parent_; }
   FiberElement* root_virtual_parent();
 
   const ClassList& classes() { return data_model_->classes(); }
@@ -790,6 +820,11 @@ class FiberElement : public Element,
   void OnClassChanged(const ClassList& old_classes,
                       const ClassList& new_classes);
 
+  // Applies the invalidation sets collected by the class and id changes,
+  // together with the |lists| collected on the TASM worker. Returns the
+  // number of elements marked style dirty.
+  uint32_t ApplyPendingStyleInvalidations(const css::InvalidationLists& lists);
+
   void OnPatchFinish(std::shared_ptr<PipelineOptions>& option) override;
 
   void FlushAnimatedStyleInternal(tasm::CSSPropertyID,
@@ -835,12 +870,16 @@ class FiberElement : public Element,
   bool IsTemplateElement() const { return is_template_; }
 
   void MarkPartElement(base::String&& part_id) {
-    part_id_ = std::move(part_id);
+    EnsureColdData().part_id = std::move(part_id);
   }
 
-  bool IsPartElement() const { return !part_id_.empty(); }
+  bool IsPartElement() const {
+    return cold_data_ != nullptr && !cold_data_->part_id.empty();
+  }
 
-  const base::String& GetPartID() const { return part_id_; }
+  base::String GetPartID() const {
+    return cold_data_ ? cold_data_->part_id : base::String();
+  }
 
   // current element is inserted to DOM tree
   virtual void InsertedInto(FiberElement* insertion_point);
@@ -892,14 +931,24 @@ class FiberElement : public Element,
     }
   }
 
+  // The styles shared with the other instances of the element template
+  // prototype this element was instantiated from, consumed by the first
+  // style resolution.
+  void SetPrototypeStyleSnapshot(
+      std::shared_ptr<PrototypeStyleSnapshot> snapshot) {
+    if (snapshot != nullptr || cold_data_ != nullptr) {
+      EnsureColdData().style_snapshot = std::move(snapshot);
+    }
+  }
+  std::shared_ptr<PrototypeStyleSnapshot> prototype_style_snapshot() const {
+    return cold_data_ ? cold_data_->style_snapshot : nullptr;
+  }
+
   // Exported for accessing private field from Element Manager to handle legacy
   // logic
   inline FiberElement* GetRenderRootElement() { return render_root_element_; }
   ListItemSchedulerAdapter* GetSchedulerAdapter() {
-    if (scheduler_adapter_) {
-      return scheduler_adapter_.get();
-    }
-    return nullptr;
+    return cold_data_ ? cold_data_->scheduler_adapter.get() : nullptr;
   }
 
   inline bool ShouldProcessParallelTasks() {
@@ -911,7 +960,10 @@ class FiberElement : public Element,
     parallel_reduce_tasks_->emplace_back(std::move(operation));
   }
 
-  virtual int32_t GetMemoryUsage() const override { return sizeof(*this); }
+  virtual int32_t GetMemoryUsage() const override {
+    return sizeof(*this) + (cold_data_ ? sizeof(ColdData) : 0);
+  }
+  virtual void CollectMemoryUsage(ElementMemoryReport& report) const override;
 
   inline SLNode* slnode() const {
     if (sl_node_ != nullptr) {
@@ -1024,10 +1076,24 @@ class FiberElement : public Element,
 
   bool CheckHasInvalidationForId(const std::string& old_id,
                                  const std::string& new_id);
+  // Only reads the CSS fragment, may run on the TASM worker.
+  void CollectInvalidationForId(const std::string& old_id,
+                                const std::string& new_id,
+                                css::InvalidationLists& lists);
 
   bool CheckHasInvalidationForClass(const ClassList& old_classes,
                                     const ClassList& new_classes);
-  void InvalidateChildren(css::InvalidationSet* invalidation_set);
+  // Only reads the CSS fragment, may run on the TASM worker.
+  void CollectInvalidationForClass(const ClassList& old_classes,
+                                   const ClassList& new_classes,
+                                   css::InvalidationLists& lists);
+  void ScheduleStyleInvalidation();
+  uint32_t ApplyInvalidationLists(const css::InvalidationLists& lists,
+                                  bool invalidate_self);
+  uint32_t InvalidateChildren(
+      const css::InvalidationSetVector& invalidation_sets);
+  uint32_t InvalidateSiblings(
+      const css::SiblingInvalidationSet& invalidation_set);
   void VisitChildren(const base::MoveOnlyClosure<void, FiberElement*>& visitor);
 
   void LogNodeInfo();
@@ -1046,6 +1112,9 @@ class FiberElement : public Element,
   void PrepareRootCSSVariables(AttributeHolder* holder);
   void ParseRawInlineStyles(StyleMap* parsed_styles);
   void DoFullCSSResolving();
+  // Returns false if the styles may depend on anything but the element's own
+  // selectors, such as its ancestors, CSS variables or inline styles.
+  bool CollectStyleSnapshotInputs(PrototypeStyleSnapshot::Inputs& inputs);
   const tasm::CSSValue& ResolveCurrentStyleValue(
       const CSSPropertyID& key, const tasm::CSSValue& default_value);
 
@@ -1061,11 +1130,6 @@ class FiberElement : public Element,
   base::InlineVector<fml::RefPtr<FiberElement>, kChildrenInlineVectorSize>
       scoped_children_;
 
-  // for air virtual node
-  base::auto_create_optional<base::InlineVector<fml::RefPtr<FiberElement>, 2>>
-      scoped_virtual_children_;
-  FiberElement* virtual_parent_{nullptr};
-
   // layout_parent/child to indicate current real tree hierarchy after
   // flushActions, it's different from dom tree.
   // dom tree is updated when the Element APIs called immediately
@@ -1113,6 +1177,10 @@ class FiberElement : public Element,
 
   bool children_propagate_inherited_styles_flag_{false};
 
+  // Whether the element is in the pending style invalidations of the element
+  // manager.
+  bool style_invalidation_scheduled_{false};
+
   // indicates the node's layout node has been inserted to parent layout node
   // yet
   bool attached_to_layout_parent_{false};
@@ -1156,21 +1224,55 @@ class FiberElement : public Element,
   base::auto_create_optional<base::Vector<tasm::CSSPropertyID>>
       reset_inherited_ids_;
 
-  //{origin_css_id, {css_value, is_logic_style}}
-  base::auto_create_optional<
-      base::LinearFlatMap<tasm::CSSPropertyID, std::pair<CSSValue, IsLogic>>>
-      pending_updated_direction_related_styles_;
-
   base::Vector<ActionParam> action_param_list_;
 
   AttrUMap updated_attr_map_;
   base::auto_create_optional<BuiltinAttrMap> builtin_attr_map_;
   base::auto_create_optional<base::Vector<base::String>> reset_attr_vec_;
 
-  // Configuration set for elements through the LepusRuntime will be stored in
-  // the config variable
-  fml::RefPtr<lepus::Dictionary> config_;
+  std::unique_ptr<LayoutBundle> layout_bundle_;
+
+  // State that only a small part of the elements ever uses. It is kept out of
+  // line and allocated on first use, see EnsureColdData().
+  struct ColdData {
+    // for air virtual node
+    base::InlineVector<fml::RefPtr<FiberElement>, 2> scoped_virtual_children;
+    FiberElement* virtual_parent{nullptr};
+
+    //{origin_css_id, {css_value, is_logic_style}}
+    base::LinearFlatMap<tasm::CSSPropertyID, std::pair<CSSValue, IsLogic>>
+        pending_updated_direction_related_styles;
+
+    // Configuration set for elements through the LepusRuntime will be stored
+    // in the config variable
+    fml::RefPtr<lepus::Dictionary> config;
+
+    base::String part_id;
+
+    base::LinearFlatMap<PseudoState, std::unique_ptr<PseudoElement>>
+        pseudo_elements;
+
+    std::unique_ptr<ListItemSchedulerAdapter> scheduler_adapter;
 
+    std::shared_ptr<PrototypeStyleSnapshot> style_snapshot;
+  };
+
+  bool HasPendingDirectionRelatedStyles() const {
+    return cold_data_ != nullptr &&
+           !cold_data_->pending_updated_direction_related_styles.empty();
+  }
+
+  ColdData& EnsureColdData() {
+    if (cold_data_ == nullptr) {
+      cold_data_ = std::make_unique<ColdData>();
+    }
+    return *cold_data_;
+  }
+
+  std::unique_ptr<ColdData> cold_data_;
+
+  // Filled during the parallel flush, possibly on a worker thread, so they
+  // are not part of ColdData.
   base::auto_create_optional<std::list<base::closure>> parallel_reduce_tasks_;
 
   // Need extra list to record tasks that need to be invoked before flush
@@ -1178,16 +1280,6 @@ class FiberElement : public Element,
   base::auto_create_optional<std::list<base::closure>>
       parallel_before_flush_action_tasks_;
 
-  std::unique_ptr<LayoutBundle> layout_bundle_;
-
-  base::String part_id_;
-
-  base::auto_create_optional<
-      base::LinearFlatMap<PseudoState, std::unique_ptr<PseudoElement>>>
-      pseudo_elements_;
-
-  std::unique_ptr<ListItemSchedulerAdapter> scheduler_adapter_;
-
   // nullptr ended array for storing style objects.
   std::unique_ptr<style::StyleObject*, style::StyleObjectArrayDeleter>
       style_objects_{nullptr};
@@ -1199,7 +1291,12 @@ class FiberElement : public Element,
  protected:
   ElementContextDelegate* element_context_delegate_{nullptr};
 
-  std::unique_ptr<SLNode> sl_node_{nullptr};
+  ElementArena::UniquePtr<SLNode> sl_node_{nullptr};
+
+ private:
+  // Set by Create() when the element lives in an arena block. Not copied by
+  // CloneElement(), the clones are system allocations.
+  bool from_arena_{false};
 };
 
 }  // namespace tasm
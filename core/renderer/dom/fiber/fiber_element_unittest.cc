@@ -22,6 +22,7 @@
 #include "core/renderer/css/ng/selector/css_selector_parser.h"
 #include "core/renderer/dom/element_manager.h"
 #include "core/renderer/dom/fiber/component_element.h"
+#include "core/renderer/dom/fiber/element_template_prototype_cache.h"
 #include "core/renderer/dom/fiber/for_element.h"
 #include "core/renderer/dom/fiber/if_element.h"
 #include "core/renderer/dom/fiber/image_element.h"
@@ -7935,6 +7936,133 @@ TEST_P(FiberElementTest, FromTemplateInfoTest) {
   EXPECT_EQ(ref_0_0_0 && ref_0_0_0->IsRefCounted(), true);
 }
 
+TEST_P(FiberElementTest, ElementTemplatePrototypeTest) {
+  LynxEnv::GetInstance()
+      .external_env_map_[LynxEnv::Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE] =
+      "true";
+
+  ElementTemplateInfo template_info;
+  template_info.exist_ = true;
+  template_info.key_ = "key";
+
+  auto info_0 = ElementInfo();
+  info_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_VIEW;
+  info_0.id_selector_ = "#0";
+  info_0.class_selector_.emplace_back("item");
+  info_0.attrs_[base::String("index")] = lepus::Value(1);
+  info_0.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value("0");
+
+  auto info_0_0 = ElementInfo();
+  info_0_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_TEXT;
+  info_0_0.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value("0_0");
+  info_0.children_.emplace_back(std::move(info_0_0));
+  template_info.elements_.emplace_back(std::move(info_0));
+
+  ElementTemplatePrototypeCache cache;
+  auto first = cache.Instantiate(template_info.key_, template_info);
+  auto second = cache.Instantiate(template_info.key_, template_info);
+  EXPECT_EQ(cache.PrototypeCount(), 1u);
+  ASSERT_EQ(first.size(), 1u);
+  ASSERT_EQ(second.size(), 1u);
+  EXPECT_NE(first[0].get(), second[0].get());
+
+  for (const auto* elements : {&first, &second}) {
+    const auto& root = (*elements)[0];
+    EXPECT_TRUE(root->IsTemplateElement());
+    EXPECT_EQ(root->GetPartID().str(), "0");
+    EXPECT_EQ(root->data_model()->idSelector().str(), "#0");
+    EXPECT_EQ(root->data_model()->classes().size(), 1u);
+    auto attr = root->data_model()->attributes().find(base::String("index"));
+    ASSERT_NE(attr, root->data_model()->attributes().end());
+    EXPECT_EQ(attr->second.Number(), 1);
+    ASSERT_EQ(root->children().size(), 1u);
+    EXPECT_TRUE(root->children()[0]->is_text());
+    EXPECT_EQ(root->children()[0]->GetPartID().str(), "0_0");
+  }
+  // Instances do not share children.
+  EXPECT_NE(first[0]->children()[0].get(), second[0]->children()[0].get());
+  // The clones are not resolved yet, the instances share the style snapshots
+  // of the first instance, element by element.
+  EXPECT_TRUE(second[0]->StyleDirty());
+  ASSERT_NE(first[0]->prototype_style_snapshot(), nullptr);
+  EXPECT_EQ(first[0]->prototype_style_snapshot(),
+            second[0]->prototype_style_snapshot());
+  EXPECT_EQ(first[0]->children()[0]->prototype_style_snapshot(),
+            second[0]->children()[0]->prototype_style_snapshot());
+  EXPECT_NE(first[0]->prototype_style_snapshot(),
+            first[0]->children()[0]->prototype_style_snapshot());
+
+  auto res = TreeResolver::InitElementTree(
+      std::move(second), 0, manager,
+      tasm->style_sheet_manager(DEFAULT_ENTRY_NAME));
+  auto root_element = fml::static_ref_ptr_cast<FiberElement>(
+      res.GetProperty(0).RefCounted());
+  auto parts = TreeResolver::GetTemplateParts(root_element);
+  EXPECT_TRUE(parts->GetValueOrNull("0_0").has_value());
+
+  LynxEnv::GetInstance()
+      .external_env_map_[LynxEnv::Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE] =
+      "false";
+}
+
+TEST_P(FiberElementTest, ElementTemplatePrototypeBoundTest) {
+  LynxEnv::GetInstance()
+      .external_env_map_[LynxEnv::Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE] =
+      "true";
+
+  ElementTemplateInfo template_info;
+  template_info.exist_ = true;
+  auto info_0 = ElementInfo();
+  info_0.tag_enum_ = ElementBuiltInTagEnum::ELEMENT_VIEW;
+  template_info.elements_.emplace_back(std::move(info_0));
+
+  ElementTemplatePrototypeCache cache;
+  constexpr size_t kMax = ElementTemplatePrototypeCache::kMaxPrototypeCount;
+  for (size_t i = 0; i <= kMax; ++i) {
+    cache.Instantiate(std::to_string(i), template_info);
+    // Keeps the first prototype the most recently used one.
+    cache.Instantiate("0", template_info);
+  }
+  EXPECT_EQ(cache.PrototypeCount(), kMax);
+
+  cache.Clear();
+  EXPECT_EQ(cache.PrototypeCount(), 0u);
+
+  LynxEnv::GetInstance()
+      .external_env_map_[LynxEnv::Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE] =
+      "false";
+}
+
+TEST_P(FiberElementTest, PrototypeStyleSnapshotTest) {
+  PrototypeStyleSnapshot snapshot;
+  PrototypeStyleSnapshot::Inputs inputs;
+  inputs.css_id = 1;
+  inputs.classes.emplace_back("item");
+
+  StyleMap styles;
+  EXPECT_FALSE(snapshot.Load(inputs, styles));
+
+  StyleMap resolved;
+  resolved.insert_or_assign(kPropertyIDWidth,
+                            CSSValue(lepus::Value(10), CSSValuePattern::PX));
+  snapshot.Store(inputs, resolved);
+  // Only the first store is kept.
+  snapshot.Store(inputs, StyleMap());
+
+  ASSERT_TRUE(snapshot.Load(inputs, styles));
+  EXPECT_EQ(styles.size(), 1u);
+
+  // Instances with other selectors resolve their own styles.
+  auto other = inputs;
+  other.classes.emplace_back("selected");
+  EXPECT_FALSE(snapshot.Load(other, styles));
+  other = inputs;
+  other.css_id = 2;
+  EXPECT_FALSE(snapshot.Load(other, styles));
+}
+
 // CSSVariable Demo Structure
 TEST_P(FiberElementTest, CSSVariableOrderTest) {
   // construct css fragment.
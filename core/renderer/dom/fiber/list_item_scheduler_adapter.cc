@@ -124,6 +124,7 @@ void ListItemSchedulerAdapter::ResolveElementTree(
                     ctx.event()->add_debug_annotations("list_item",
                                                        std::to_string(impl_id));
                   });
+              CSSStyleSheetManager::ReadScope css_read_scope;
               batch_resolving_tree_ = true;
               render_root_->FlushActions();
               batch_resolving_tree_ = false;
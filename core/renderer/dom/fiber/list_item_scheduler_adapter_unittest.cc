@@ -241,27 +241,27 @@ TEST_P(ListItemSchedulerAdapterTest, ListItemResolveSubtreePropertyTest) {
   EXPECT_TRUE(manager->ParallelTasks().size() == 0);
   EXPECT_TRUE(manager->ParallelResolveTreeTasks().size() == 0);
   if (!enable_batch_layout_operation) {
-    EXPECT_TRUE(wrapper_0->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(wrapper_1->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(wrapper_2->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(wrapper_3->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
     EXPECT_TRUE(
-        wrapper_0->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        wrapper_0->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
     EXPECT_TRUE(
-        wrapper_1->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        wrapper_1->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
     EXPECT_TRUE(
-        wrapper_2->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        wrapper_2->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
     EXPECT_TRUE(
-        wrapper_3->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        wrapper_3->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
+    EXPECT_TRUE(wrapper_0->GetSchedulerAdapter()
+                    ->resolve_element_tree_queue_.size() == 0);
+    EXPECT_TRUE(wrapper_1->GetSchedulerAdapter()
+                    ->resolve_element_tree_queue_.size() == 0);
+    EXPECT_TRUE(wrapper_2->GetSchedulerAdapter()
+                    ->resolve_element_tree_queue_.size() == 0);
+    EXPECT_TRUE(wrapper_3->GetSchedulerAdapter()
+                    ->resolve_element_tree_queue_.size() == 0);
   } else {
-    EXPECT_TRUE(wrapper_0->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(wrapper_1->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(wrapper_2->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(wrapper_3->scheduler_adapter_ == nullptr);
+    EXPECT_TRUE(wrapper_0->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(wrapper_1->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(wrapper_2->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(wrapper_3->GetSchedulerAdapter() == nullptr);
     EXPECT_TRUE(wrapper_0->element_context_delegate_ != nullptr);
     EXPECT_TRUE(wrapper_1->element_context_delegate_ != nullptr);
     EXPECT_TRUE(wrapper_2->element_context_delegate_ != nullptr);
@@ -396,32 +396,32 @@ TEST_P(ListItemSchedulerAdapterTest, RecordingRenderRootComponentElementTest) {
   EXPECT_TRUE(manager->ParallelTasks().size() == 0);
   EXPECT_TRUE(manager->ParallelResolveTreeTasks().size() == 0);
   if (!enable_batch_layout_operation) {
-    EXPECT_TRUE(comp_1->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(comp_2->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(comp_3->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
-    EXPECT_TRUE(comp_4->scheduler_adapter_->resolve_property_queue_.size() ==
-                0);
     EXPECT_TRUE(
-        comp_1->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        comp_1->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
+    EXPECT_TRUE(
+        comp_2->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
+    EXPECT_TRUE(
+        comp_3->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
+    EXPECT_TRUE(
+        comp_4->GetSchedulerAdapter()->resolve_property_queue_.size() == 0);
+    EXPECT_TRUE(
+        comp_1->GetSchedulerAdapter()->resolve_element_tree_queue_.size() == 0);
     EXPECT_TRUE(
-        comp_2->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        comp_2->GetSchedulerAdapter()->resolve_element_tree_queue_.size() == 0);
     EXPECT_TRUE(
-        comp_3->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        comp_3->GetSchedulerAdapter()->resolve_element_tree_queue_.size() == 0);
     EXPECT_TRUE(
-        comp_4->scheduler_adapter_->resolve_element_tree_queue_.size() == 0);
+        comp_4->GetSchedulerAdapter()->resolve_element_tree_queue_.size() == 0);
 
-    EXPECT_TRUE(comp_1->scheduler_adapter_ != nullptr);
-    EXPECT_TRUE(comp_2->scheduler_adapter_ != nullptr);
-    EXPECT_TRUE(comp_3->scheduler_adapter_ != nullptr);
-    EXPECT_TRUE(comp_4->scheduler_adapter_ != nullptr);
+    EXPECT_TRUE(comp_1->GetSchedulerAdapter() != nullptr);
+    EXPECT_TRUE(comp_2->GetSchedulerAdapter() != nullptr);
+    EXPECT_TRUE(comp_3->GetSchedulerAdapter() != nullptr);
+    EXPECT_TRUE(comp_4->GetSchedulerAdapter() != nullptr);
   } else {
-    EXPECT_TRUE(comp_1->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(comp_2->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(comp_3->scheduler_adapter_ == nullptr);
-    EXPECT_TRUE(comp_4->scheduler_adapter_ == nullptr);
+    EXPECT_TRUE(comp_1->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(comp_2->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(comp_3->GetSchedulerAdapter() == nullptr);
+    EXPECT_TRUE(comp_4->GetSchedulerAdapter() == nullptr);
     EXPECT_TRUE(comp_1->element_context_delegate_ != nullptr);
     EXPECT_TRUE(comp_2->element_context_delegate_ != nullptr);
     EXPECT_TRUE(comp_3->element_context_delegate_ != nullptr);
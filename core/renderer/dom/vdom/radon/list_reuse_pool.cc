@@ -4,14 +4,24 @@
 
 #include "core/renderer/dom/vdom/radon/list_reuse_pool.h"
 
+#include "core/renderer/dom/vdom/radon/list_reuse_pool_manager.h"
 #include "core/renderer/dom/vdom/radon/radon_component.h"
 
 namespace lynx {
 namespace tasm {
 
+ListReusePool::~ListReusePool() {
+  if (manager_) {
+    manager_->OnPoolDestroyed(this);
+  }
+}
+
 void ListReusePool::Enqueue(const base::String& item_key,
                             const base::String& reuse_identifier) {
   pool_[reuse_identifier][item_key] = base::String();
+  if (manager_) {
+    manager_->OnEnqueue(this, item_key, reuse_identifier);
+  }
 }
 
 ListReusePool::Action ListReusePool::Dequeue(
@@ -53,6 +63,9 @@ void ListReusePool::Invalidate(const base::String& reuse_identifier,
   if (pool_.count(reuse_identifier)) {
     pool_[reuse_identifier].erase(item_key);
   }
+  if (manager_) {
+    manager_->OnInvalidate(this, item_key);
+  }
 }
 
 void ListReusePool::Remove(const base::String& item_key,
@@ -66,9 +79,7 @@ void ListReusePool::Remove(const base::String& item_key,
       component->set_list_need_remove_after_reused(true);
     } else {
       // remove component immediately
-      if (pool_.count(reuse_identifier)) {
-        pool_[reuse_identifier].erase(item_key);
-      }
+      Invalidate(reuse_identifier, item_key);
       key_component_map_.erase(item_key);
       // mark component to be removed, so that it will not be added to this new
       // list_node
@@ -77,5 +88,26 @@ void ListReusePool::Remove(const base::String& item_key,
   }
 }
 
+void ListReusePool::Evict(const base::String& item_key,
+                          const base::String& reuse_identifier) {
+  Invalidate(reuse_identifier, item_key);
+  RadonComponent* component = GetComponentFromListKeyComponentMap(item_key);
+  if (component == nullptr) {
+    return;
+  }
+  key_component_map_.erase(item_key);
+  component->OnComponentRemovedInPostOrder();
+  component->RemoveElementFromParent();
+  auto* parent = component->Parent();
+  if (parent != nullptr) {
+    // dtor its radon subtree in post order, and the component itself
+    component->ClearChildrenRecursivelyInPostOrder();
+    parent->RemoveChild(component);
+  } else {
+    component->ResetElementRecursively();
+    component->set_list_need_remove(true);
+  }
+}
+
 }  // namespace tasm
 }  // namespace lynx
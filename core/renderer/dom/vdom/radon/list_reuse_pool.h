@@ -13,6 +13,7 @@
 namespace lynx {
 namespace tasm {
 
+class ListReusePoolManager;
 class RadonComponent;
 
 using ListKeyComponentMap = std::unordered_map<base::String, RadonComponent*>;
@@ -28,6 +29,12 @@ class ListReusePool {
     Type type_;
     base::String key_to_reuse_;
   };
+  explicit ListReusePool(ListReusePoolManager* manager = nullptr)
+      : manager_(manager) {}
+  ~ListReusePool();
+  ListReusePool(const ListReusePool&) = delete;
+  ListReusePool& operator=(const ListReusePool&) = delete;
+
   void Enqueue(const base::String& item_key,
                const base::String& reuse_identifier);
 
@@ -43,6 +50,22 @@ class ListReusePool {
   void Remove(const base::String& item_key,
               const base::String& reuse_identifier);
 
+  // Drops the recycled component of item_key and releases its element tree,
+  // invoked by the manager within a patch once the type went over capacity.
+  // A new component is created if the item is shown again.
+  void Evict(const base::String& item_key,
+             const base::String& reuse_identifier);
+
+  // Whether the platform list keeps the views of its recycled cells to reuse
+  // them. The element trees of the recycled components are then still held
+  // by the platform, so the manager does not evict them.
+  bool recycled_items_held_by_platform() const {
+    return recycled_items_held_by_platform_;
+  }
+  void set_recycled_items_held_by_platform(bool held) {
+    recycled_items_held_by_platform_ = held;
+  }
+
  private:
   using Pool =
       std::unordered_map<base::String,
@@ -55,6 +78,10 @@ class ListReusePool {
   // this map includes all of the component which has been created before.
   ListKeyComponentMap key_component_map_;
 
+  // The page-level manager bounding the recycled components, may be null.
+  ListReusePoolManager* manager_{nullptr};
+  bool recycled_items_held_by_platform_{false};
+
   void Invalidate(const base::String& reuse_identifier,
                   const base::String& item_key);
 };
@@ -0,0 +1,119 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/dom/vdom/radon/list_reuse_pool_manager.h"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "core/renderer/dom/vdom/radon/list_reuse_pool.h"
+
+namespace lynx {
+namespace tasm {
+
+void ListReusePoolManager::OnEnqueue(ListReusePool* pool,
+                                     const base::String& item_key,
+                                     const base::String& reuse_identifier) {
+  // Recycled again, it becomes the most recently recycled one.
+  OnInvalidate(pool, item_key);
+  EntryList& entries = entries_[reuse_identifier];
+  index_[pool].emplace(
+      item_key,
+      entries.insert(entries.end(), Entry{pool, item_key, reuse_identifier}));
+  const size_t capacity = GetCapacity(reuse_identifier);
+  if (capacity > 0 && entries.size() > capacity) {
+    over_capacity_ = true;
+  }
+}
+
+void ListReusePoolManager::OnInvalidate(ListReusePool* pool,
+                                        const base::String& item_key) {
+  auto pool_it = index_.find(pool);
+  if (pool_it == index_.end()) {
+    return;
+  }
+  auto it = pool_it->second.find(item_key);
+  if (it == pool_it->second.end()) {
+    return;
+  }
+  entries_[it->second->reuse_identifier].erase(it->second);
+  pool_it->second.erase(it);
+}
+
+void ListReusePoolManager::OnPoolDestroyed(ListReusePool* pool) {
+  auto pool_it = index_.find(pool);
+  if (pool_it == index_.end()) {
+    return;
+  }
+  for (auto& [reuse_identifier, entries] : entries_) {
+    entries.remove_if(
+        [pool](const Entry& entry) { return entry.pool == pool; });
+  }
+  index_.erase(pool_it);
+}
+
+void ListReusePoolManager::Trim(size_t max_count_per_type) {
+  pending_trim_ = pending_trim_
+                      ? std::min(*pending_trim_, max_count_per_type)
+                      : max_count_per_type;
+}
+
+size_t ListReusePoolManager::FlushPendingEvictions() {
+  if (!HasPendingEvictions()) {
+    return 0;
+  }
+  const size_t evicted_count = evicted_count_;
+  auto pending_trim = pending_trim_;
+  pending_trim_.reset();
+  over_capacity_ = false;
+
+  for (auto& [reuse_identifier, entries] : entries_) {
+    size_t max_count = GetCapacity(reuse_identifier);
+    if (pending_trim && (max_count == 0 || *pending_trim < max_count)) {
+      max_count = *pending_trim;
+    } else if (max_count == 0) {
+      continue;
+    }
+    TrimType(entries, max_count);
+  }
+  return evicted_count_ - evicted_count;
+}
+
+size_t ListReusePoolManager::GetCount(
+    const base::String& reuse_identifier) const {
+  auto it = entries_.find(reuse_identifier);
+  return it != entries_.end() ? it->second.size() : 0;
+}
+
+void ListReusePoolManager::TrimType(EntryList& entries, size_t max_count) {
+  // Components the platform still holds stay in their pool and keep counting
+  // against the capacity, the next ones are evicted instead. Evicting a
+  // component may destroy the lists it contains and drop their entries, so
+  // no iterator is kept across an eviction.
+  size_t held_count = 0;
+  while (entries.size() > max_count && held_count < entries.size()) {
+    auto it = std::next(entries.begin(), held_count);
+    if (it->pool->recycled_items_held_by_platform()) {
+      ++held_count;
+    } else {
+      Evict(entries, it);
+    }
+  }
+}
+
+void ListReusePoolManager::Evict(EntryList& entries, EntryList::iterator it) {
+  Entry entry = std::move(*it);
+  entries.erase(it);
+  auto pool_it = index_.find(entry.pool);
+  if (pool_it != index_.end()) {
+    pool_it->second.erase(entry.item_key);
+  }
+  // The entry is dropped first, so the pool invalidating it is a no-op here.
+  entry.pool->Evict(entry.item_key, entry.reuse_identifier);
+  ++evicted_count_;
+}
+
+}  // namespace tasm
+}  // namespace lynx
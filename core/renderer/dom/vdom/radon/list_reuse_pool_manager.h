@@ -0,0 +1,102 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_DOM_VDOM_RADON_LIST_REUSE_POOL_MANAGER_H_
+#define CORE_RENDERER_DOM_VDOM_RADON_LIST_REUSE_POOL_MANAGER_H_
+
+#include <functional>
+#include <list>
+#include <optional>
+#include <unordered_map>
+
+#include "base/include/value/base_string.h"
+
+namespace lynx {
+namespace tasm {
+
+class ListReusePool;
+
+// Bounds the recycled components kept by all the lists of a page. Each list
+// keeps its own ListReusePool, since a component can only be reused by the
+// list which rendered it, but the components waiting in those pools are
+// counted per reuse identifier (i.e. item component type) for the whole page.
+// Once a type exceeds its capacity, the component of that type recycled the
+// longest time ago is evicted from its pool and its element tree released,
+// whichever list it belongs to. Several carousels of the same card type thus
+// share one budget instead of each holding a full screen of cards.
+//
+// Components are recycled while the platform list lays out its cells, so the
+// evictions are only recorded then and carried out by
+// FlushPendingEvictions() at the next patch, whose element removals are
+// flushed with it. Components of lists whose platform keeps the views of
+// recycled cells are never evicted.
+class ListReusePoolManager {
+ public:
+  // Returns the max number of recycled components of a type, 0 for no limit.
+  using CapacityGetter = std::function<size_t(const base::String&)>;
+
+  ListReusePoolManager() = default;
+  ListReusePoolManager(const ListReusePoolManager&) = delete;
+  ListReusePoolManager& operator=(const ListReusePoolManager&) = delete;
+
+  void SetCapacityGetter(CapacityGetter getter) {
+    capacity_getter_ = std::move(getter);
+  }
+  size_t GetCapacity(const base::String& reuse_identifier) const {
+    return capacity_getter_ ? capacity_getter_(reuse_identifier) : 0;
+  }
+
+  // The pool recycled the component of item_key. If the type is over
+  // capacity, its least recently recycled components are evicted by the next
+  // FlushPendingEvictions().
+  void OnEnqueue(ListReusePool* pool, const base::String& item_key,
+                 const base::String& reuse_identifier);
+  // The component of item_key left the pool, reused or removed.
+  void OnInvalidate(ListReusePool* pool, const base::String& item_key);
+  void OnPoolDestroyed(ListReusePool* pool);
+
+  // The next FlushPendingEvictions() evicts the least recently recycled
+  // components until each type keeps at most max_count_per_type of them,
+  // e.g. on memory pressure.
+  void Trim(size_t max_count_per_type);
+
+  bool HasPendingEvictions() const {
+    return over_capacity_ || pending_trim_.has_value();
+  }
+  // Carries out the evictions recorded since the last call. Returns the
+  // number of components evicted.
+  size_t FlushPendingEvictions();
+
+  size_t GetCount(const base::String& reuse_identifier) const;
+  size_t evicted_count() const { return evicted_count_; }
+
+ private:
+  struct Entry {
+    ListReusePool* pool;
+    base::String item_key;
+    base::String reuse_identifier;
+  };
+  using EntryList = std::list<Entry>;
+  using EntryIndex =
+      std::unordered_map<ListReusePool*,
+                         std::unordered_map<base::String, EntryList::iterator>>;
+
+  void Evict(EntryList& entries, EntryList::iterator it);
+  void TrimType(EntryList& entries, size_t max_count);
+
+  CapacityGetter capacity_getter_;
+  // Recycled components of each type, the least recently recycled first.
+  std::unordered_map<base::String, EntryList> entries_;
+  EntryIndex index_;
+  // Whether a type went over capacity, and the pending Trim(), since the last
+  // FlushPendingEvictions().
+  bool over_capacity_{false};
+  std::optional<size_t> pending_trim_;
+  size_t evicted_count_{0};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_DOM_VDOM_RADON_LIST_REUSE_POOL_MANAGER_H_
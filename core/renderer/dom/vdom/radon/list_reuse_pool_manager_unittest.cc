@@ -0,0 +1,153 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#define protected public
+#define private public
+
+#include "core/renderer/dom/vdom/radon/list_reuse_pool_manager.h"
+
+#include <memory>
+
+#include "base/include/value/base_string.h"
+#include "core/renderer/dom/vdom/radon/list_reuse_pool.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace testing {
+
+namespace {
+
+bool IsReusable(ListReusePool& pool, const char* item_key,
+                const char* reuse_identifier) {
+  auto it = pool.pool_.find(base::String(reuse_identifier));
+  return it != pool.pool_.end() &&
+         it->second.find(base::String(item_key)) != it->second.end();
+}
+
+}  // namespace
+
+class ListReusePoolManagerTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    manager_.SetCapacityGetter([](const base::String& reuse_identifier) {
+      return reuse_identifier.IsEqual("card") ? 2 : 0;
+    });
+  }
+
+  ListReusePoolManager manager_;
+  base::String card_{"card"};
+  base::String banner_{"banner"};
+};
+
+TEST_F(ListReusePoolManagerTest, EvictsLeastRecentlyRecycledAcrossPools) {
+  ListReusePool carousel_a(&manager_);
+  ListReusePool carousel_b(&manager_);
+  carousel_a.Enqueue(base::String("a0"), card_);
+  carousel_b.Enqueue(base::String("b0"), card_);
+  EXPECT_EQ(manager_.GetCount(card_), 2u);
+
+  // Recycling a0 again makes b0 the least recently recycled card.
+  carousel_a.Enqueue(base::String("a0"), card_);
+  carousel_a.Enqueue(base::String("a1"), card_);
+  EXPECT_TRUE(manager_.HasPendingEvictions());
+  EXPECT_EQ(manager_.FlushPendingEvictions(), 1u);
+  EXPECT_EQ(manager_.GetCount(card_), 2u);
+  EXPECT_EQ(manager_.evicted_count(), 1u);
+  EXPECT_FALSE(IsReusable(carousel_b, "b0", "card"));
+  EXPECT_TRUE(IsReusable(carousel_a, "a0", "card"));
+  EXPECT_TRUE(IsReusable(carousel_a, "a1", "card"));
+
+  // Types without a capacity are not bounded.
+  for (int i = 0; i < 10; ++i) {
+    carousel_b.Enqueue(base::String(std::to_string(i)), banner_);
+  }
+  EXPECT_FALSE(manager_.HasPendingEvictions());
+  EXPECT_EQ(manager_.GetCount(banner_), 10u);
+  EXPECT_EQ(manager_.evicted_count(), 1u);
+}
+
+TEST_F(ListReusePoolManagerTest, ReusedComponentsLeaveTheBudget) {
+  ListReusePool pool(&manager_);
+  pool.Enqueue(base::String("a0"), card_);
+  pool.Enqueue(base::String("a1"), card_);
+  pool.Invalidate(card_, base::String("a0"));
+  EXPECT_EQ(manager_.GetCount(card_), 1u);
+
+  pool.Enqueue(base::String("a2"), card_);
+  EXPECT_FALSE(manager_.HasPendingEvictions());
+  EXPECT_EQ(manager_.evicted_count(), 0u);
+  EXPECT_TRUE(IsReusable(pool, "a1", "card"));
+  EXPECT_TRUE(IsReusable(pool, "a2", "card"));
+}
+
+TEST_F(ListReusePoolManagerTest, TrimKeepsMostRecentlyRecycled) {
+  ListReusePool pool(&manager_);
+  for (int i = 0; i < 5; ++i) {
+    pool.Enqueue(base::String(std::to_string(i)), banner_);
+  }
+  pool.Enqueue(base::String("a0"), card_);
+  manager_.Trim(1);
+  EXPECT_EQ(manager_.GetCount(banner_), 5u);
+  EXPECT_EQ(manager_.FlushPendingEvictions(), 4u);
+  EXPECT_EQ(manager_.GetCount(banner_), 1u);
+  EXPECT_EQ(manager_.GetCount(card_), 1u);
+  EXPECT_TRUE(IsReusable(pool, "4", "banner"));
+  EXPECT_FALSE(IsReusable(pool, "3", "banner"));
+  EXPECT_EQ(manager_.evicted_count(), 4u);
+}
+
+TEST_F(ListReusePoolManagerTest, DestroyedPoolLeavesTheBudget) {
+  ListReusePool pool(&manager_);
+  {
+    auto removed_list_pool = std::make_unique<ListReusePool>(&manager_);
+    removed_list_pool->Enqueue(base::String("b0"), card_);
+    removed_list_pool->Enqueue(base::String("b1"), card_);
+  }
+  EXPECT_EQ(manager_.GetCount(card_), 0u);
+  pool.Enqueue(base::String("a0"), card_);
+  pool.Enqueue(base::String("a1"), card_);
+  EXPECT_EQ(manager_.FlushPendingEvictions(), 0u);
+}
+
+TEST_F(ListReusePoolManagerTest, EvictionIsDeferredToTheNextFlush) {
+  ListReusePool pool(&manager_);
+  for (int i = 0; i < 4; ++i) {
+    pool.Enqueue(base::String(std::to_string(i)), card_);
+  }
+  // Nothing is evicted while the list recycles its cells.
+  EXPECT_EQ(manager_.evicted_count(), 0u);
+  EXPECT_TRUE(IsReusable(pool, "0", "card"));
+
+  // Reused before the flush, 0 is not evicted.
+  pool.Invalidate(card_, base::String("0"));
+  EXPECT_EQ(manager_.FlushPendingEvictions(), 1u);
+  EXPECT_FALSE(IsReusable(pool, "1", "card"));
+  EXPECT_TRUE(IsReusable(pool, "2", "card"));
+  EXPECT_TRUE(IsReusable(pool, "3", "card"));
+  EXPECT_FALSE(manager_.HasPendingEvictions());
+}
+
+TEST_F(ListReusePoolManagerTest, SkipsComponentsHeldByPlatform) {
+  ListReusePool platform_list(&manager_);
+  platform_list.set_recycled_items_held_by_platform(true);
+  ListReusePool native_list(&manager_);
+  platform_list.Enqueue(base::String("p0"), card_);
+  platform_list.Enqueue(base::String("p1"), card_);
+  native_list.Enqueue(base::String("n0"), card_);
+  native_list.Enqueue(base::String("n1"), card_);
+
+  // The cards of the platform list are the least recently recycled, but its
+  // platform still holds them.
+  EXPECT_EQ(manager_.FlushPendingEvictions(), 2u);
+  EXPECT_TRUE(IsReusable(platform_list, "p0", "card"));
+  EXPECT_TRUE(IsReusable(platform_list, "p1", "card"));
+  EXPECT_FALSE(IsReusable(native_list, "n0", "card"));
+  EXPECT_FALSE(IsReusable(native_list, "n1", "card"));
+  EXPECT_EQ(manager_.GetCount(card_), 2u);
+}
+
+}  // namespace testing
+}  // namespace tasm
+}  // namespace lynx
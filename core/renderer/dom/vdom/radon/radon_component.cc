@@ -531,6 +531,32 @@ bool RadonComponent::ShouldComponentUpdate() {
   return true;
 }
 
+bool RadonComponent::IsPropertiesMemoized(
+    RadonComponent* old_radon_component) const {
+  const auto& rendered = old_radon_component->memoized_properties_;
+  const auto& properties = properties_;
+  const auto& old_properties = old_radon_component->properties_;
+  if (!rendered.recorded() || !properties.IsTable() ||
+      !old_properties.IsTable()) {
+    return false;
+  }
+  auto table_ref = properties.Table();
+  const lepus::Dictionary& table = *table_ref;
+  auto old_table_ref = old_properties.Table();
+  const lepus::Dictionary& old_table = *old_table_ref;
+  if (table.size() != old_table.size()) {
+    return false;
+  }
+  for (const auto& [key, value] : table) {
+    auto old_it = old_table.find(key);
+    if (old_it == old_table.end() ||
+        CheckTableValueNotEqual(old_it->second, value, key, &rendered)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 bool RadonComponent::CheckReactShouldAbortUpdating(const lepus::Value& table) {
   auto REACT_NATIVE_STATE_VERSION_KEY_str =
       BASE_STATIC_STRING(REACT_NATIVE_STATE_VERSION_KEY);
@@ -786,7 +812,8 @@ bool RadonComponent::UpdateRadonComponentWithoutDispatch(
   }
 
   if (incoming_data.IsObject() && incoming_data.GetLength() > 0) {
-    if ((data_.IsObject() && CheckTableShadowUpdated(data_, incoming_data)) ||
+    if ((data_.IsObject() && CheckTableShadowUpdated(data_, incoming_data,
+                                                     &rendered_data_)) ||
         data_.IsNil()) {
       UpdateTable(data_, incoming_data);
       data_dirty_ = true;
@@ -795,7 +822,8 @@ bool RadonComponent::UpdateRadonComponentWithoutDispatch(
 
   if (incoming_property.IsObject() && incoming_property.GetLength() > 0) {
     if ((properties_.IsObject() &&
-         CheckTableShadowUpdated(properties_, incoming_property)) ||
+         CheckTableShadowUpdated(properties_, incoming_property,
+                                 &rendered_properties_)) ||
         properties_.IsNil()) {
       properties_dirty_ = true;
       ForEachLepusValue(incoming_property, [this](const lepus::Value& key,
@@ -947,6 +975,13 @@ void RadonComponent::RenderRadonComponentIfNeeded(RenderOption& option) {
 
 void RadonComponent::RenderRadonComponent(RenderOption& option) {
   if (context_) {
+    // Only the keys written since the last render are recorded again.
+    rendered_data_.Record(data_);
+    rendered_properties_.Record(properties_);
+    memoized_properties_.Clear();
+    if (page_proxy_->GetEnableComponentMemo()) {
+      memoized_properties_.RecordReferences(properties_);
+    }
     lepus::Value p1(this);
     context_->CallInPauseSuppressionMode(
         "$renderComponent" + std::to_string(tid_), p1, data_, properties_,
@@ -1473,9 +1508,16 @@ void RadonComponent::RadonDiffChildren(
 
   bool force_update_all = option.ShouldForceUpdate();
 
+  // With component memo, properties passed again as the same values are
+  // matched by reference instead of by the deep comparison below. Unchanged
+  // properties skip the render and diff of the subtree either way.
+  const bool memoized = !force_update_all && !option.refresh_lifecycle_ &&
+                        page_proxy_->GetEnableComponentMemo() &&
+                        IsPropertiesMemoized(old_radon_component);
+
   // check the properties of the component
   bool should_update_properties =
-      GetProperties() != old_radon_component->GetProperties();
+      !memoized && GetProperties() != old_radon_component->GetProperties();
   if (should_update_properties) {
     properties_dirty_ = true;
   }
@@ -1523,6 +1565,12 @@ void RadonComponent::RadonDiffChildren(
 
   // no need to re-render, just reuse everything from the old component, expect
   // plugs
+  rendered_data_ = old_radon_component->rendered_data_;
+  rendered_properties_ = old_radon_component->rendered_properties_;
+  memoized_properties_ = old_radon_component->memoized_properties_;
+  if (memoized) {
+    page_proxy_->OnComponentPropsMemoized();
+  }
   if (!page_proxy_->GetEnableGlobalComponentMap()) {
     component_info_map_ = old_radon_component->component_info_map_;
     component_path_map_ = old_radon_component->component_path_map_;
@@ -18,6 +18,7 @@
 #include "core/renderer/dom/vdom/radon/radon_node.h"
 #include "core/renderer/dom/vdom/radon/radon_slot.h"
 #include "core/renderer/dom/vdom/radon/set_css_variable_op.h"
+#include "core/renderer/utils/value_utils.h"
 #include "core/runtime/vm/lepus/context.h"
 #include "core/runtime/vm/lepus/vm_context.h"
 #include "core/template_bundle/template_codec/ttml_constant.h"
@@ -357,6 +358,10 @@ class RadonComponent : public RadonNode, public BaseComponent {
   void UpdateLepusTopLevelVariableToData();
   void AdoptPlugToSlot(RadonSlot* slot, std::unique_ptr<RadonBase> plug);
 
+  // Returns true if properties_ hold the same primitives and the same tables
+  // or arrays, not written since, as the last render of old_radon_component.
+  // Only the top level is checked, one lookup per property.
+  bool IsPropertiesMemoized(RadonComponent* old_radon_component) const;
   bool CheckReactShouldAbortUpdating(const lepus::Value& table);
   bool CheckReactShouldComponentUpdateKey(const lepus::Value& table);
   bool CheckReactShouldAbortRenderError(const lepus::Value& table);
@@ -374,6 +379,15 @@ class RadonComponent : public RadonNode, public BaseComponent {
 
   bool need_reset_data_{false};
 
+  // Containers of data_ and properties_ recorded when they were last rendered.
+  // Used to skip the unchanged tables and arrays passed again by setData or by
+  // the parent component.
+  RenderedContainers rendered_data_;
+  RenderedContainers rendered_properties_;
+  // Every container of properties_ by reference, recorded with component memo
+  // so that a shared table is matched without walking it.
+  RenderedContainers memoized_properties_;
+
   // component should be removed from parent in list
   bool list_need_remove_{false};
 
@@ -34,7 +34,8 @@ RadonDiffListNode2::RadonDiffListNode2(lepus::Context* context,
                                        TemplateAssembler* tasm,
                                        uint32_t node_index)
     : RadonListBase(context, page_proxy, tasm, node_index),
-      reuse_pool_{std::make_unique<ListReusePool>()} {
+      reuse_pool_{std::make_unique<ListReusePool>(
+          page_proxy ? page_proxy->list_reuse_pool_manager() : nullptr)} {
   platform_info_.new_arch_list_ = true;
 }
 
@@ -575,6 +576,8 @@ void RadonDiffListNode2::EnqueueComponent(int32_t sign) {
        << component->name().str()
        << ", component item_key_: " << component->GetListItemKey().str());
   tasm_->page_proxy()->EraseFromEmptyComponentMap(component);
+  reuse_pool_->set_recycled_items_held_by_platform(
+      !DisablePlatformImplementation());
   reuse_pool_->Enqueue(component->GetListItemKey(), component->name());
 }
 
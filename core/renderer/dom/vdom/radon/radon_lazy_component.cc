@@ -123,6 +123,9 @@ void RadonLazyComponent::DeriveFromMould(ComponentMould* data) {
 
     data_ = init_data_;
     properties_ = init_properties_;
+    rendered_data_.Clear();
+    rendered_properties_.Clear();
+    memoized_properties_.Clear();
     ExtractExternalClass(data);
   }
 
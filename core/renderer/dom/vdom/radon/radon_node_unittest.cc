@@ -280,6 +280,88 @@ TEST_F(RadonNodeTest,
   EXPECT_TRUE(static_cast<ComponentElement*>(element.get())->CanBeLayoutOnly());
 }
 
+TEST_F(RadonNodeTest, ComponentPropertiesMemoized) {
+  auto old_component =
+      std::make_unique<RadonComponent>(page_proxy.get(), 0, nullptr, nullptr,
+                                       nullptr, nullptr, 123, "component");
+  auto new_component =
+      std::make_unique<RadonComponent>(page_proxy.get(), 0, nullptr, nullptr,
+                                       nullptr, nullptr, 123, "component");
+  auto item = lepus::Dictionary::Create();
+  item->SetValue("id", 1);
+  lepus::Value item_value(item);
+  auto old_properties = lepus::Dictionary::Create();
+  old_properties->SetValue("title", "card");
+  old_properties->SetValue("item", item_value);
+  old_component->properties_ = lepus::Value(old_properties);
+
+  auto new_properties = lepus::Dictionary::Create();
+  new_properties->SetValue("title", "card");
+  new_properties->SetValue("item", item_value);
+  new_component->properties_ = lepus::Value(new_properties);
+
+  // Not rendered yet.
+  EXPECT_FALSE(new_component->IsPropertiesMemoized(old_component.get()));
+
+  old_component->memoized_properties_.RecordReferences(
+      old_component->properties_);
+  EXPECT_TRUE(new_component->IsPropertiesMemoized(old_component.get()));
+
+  // A copy of the item is not the same object.
+  auto copied_properties = lepus::Dictionary::Create();
+  copied_properties->SetValue("title", "card");
+  copied_properties->SetValue("item", lepus::Value::ShallowCopy(item_value));
+  new_component->properties_ = lepus::Value(copied_properties);
+  EXPECT_FALSE(new_component->IsPropertiesMemoized(old_component.get()));
+
+  // The item was mutated after the last render.
+  new_component->properties_ = lepus::Value(new_properties);
+  item->SetValue("id", 2);
+  EXPECT_FALSE(new_component->IsPropertiesMemoized(old_component.get()));
+
+  old_component->memoized_properties_.RecordReferences(
+      old_component->properties_);
+  new_properties->SetValue("title", "banner");
+  EXPECT_FALSE(new_component->IsPropertiesMemoized(old_component.get()));
+}
+
+TEST_F(RadonNodeTest, ComponentPropertiesMemoizedWithSharedNestedTable) {
+  auto old_component =
+      std::make_unique<RadonComponent>(page_proxy.get(), 0, nullptr, nullptr,
+                                       nullptr, nullptr, 123, "component");
+  auto new_component =
+      std::make_unique<RadonComponent>(page_proxy.get(), 0, nullptr, nullptr,
+                                       nullptr, nullptr, 123, "component");
+  // A feed holding tables, which the leaf-only shadow record does not keep.
+  auto feed = lepus::CArray::Create();
+  for (int i = 0; i < 100; ++i) {
+    auto item = lepus::Dictionary::Create();
+    item->SetValue("id", i);
+    feed->emplace_back(lepus::Value(item));
+  }
+  lepus::Value feed_value(feed);
+  auto old_properties = lepus::Dictionary::Create();
+  old_properties->SetValue("feed", feed_value);
+  old_component->properties_ = lepus::Value(old_properties);
+  auto new_properties = lepus::Dictionary::Create();
+  new_properties->SetValue("feed", feed_value);
+  new_component->properties_ = lepus::Value(new_properties);
+
+  old_component->rendered_properties_.Record(old_component->properties_);
+  EXPECT_FALSE(old_component->rendered_properties_.IsUnchanged(
+      base::String("feed"), feed_value));
+
+  // The shared feed is matched by reference, so RadonDiffChildren skips the
+  // deep comparison of the properties.
+  old_component->memoized_properties_.RecordReferences(
+      old_component->properties_);
+  EXPECT_TRUE(new_component->IsPropertiesMemoized(old_component.get()));
+
+  // Writing the feed itself since the render is seen.
+  feed->emplace_back(lepus::Value(1));
+  EXPECT_FALSE(new_component->IsPropertiesMemoized(old_component.get()));
+}
+
 TEST_F(RadonNodeTest, SetInlineStyleForFiber) {
   page_proxy->element_manager()->SetEnableFiberElementForRadonDiff(
       TernaryBool::TRUE_VALUE);
@@ -283,11 +283,13 @@ bool RadonPage::UpdatePage(const lepus::Value &table,
     bool update_data_is_equal = false;
     if (ShouldKeepPageData()) {
       if (data_.IsObject()) {
-        update_data_is_equal = !CheckTableShadowUpdated(data_, table);
+        update_data_is_equal =
+            !CheckTableShadowUpdated(data_, table, &rendered_data_);
       }
     } else {
       update_data_is_equal =
-          !context_->CheckTableShadowUpdatedWithTopLevelVariable(table);
+          !context_->CheckTableShadowUpdatedWithTopLevelVariable(
+              table, &rendered_data_);
     }
     if (update_data_is_equal) {
       if (page_proxy_->GetPrePaintingStage() ==
@@ -323,6 +325,12 @@ bool RadonPage::UpdatePage(const lepus::Value &table,
   if (!should_component_render) {
     return need_update;
   }
+  // The keys of the top level variables are the keys of the update.
+  if (ShouldKeepPageData()) {
+    rendered_data_.Record(data_);
+  } else {
+    rendered_data_.Record(table);
+  }
   ResetComponentDispatchOrder();
   bool should_component_update = PrePageRender(table, update_page_option);
   DispatchOption option(page_proxy_);
@@ -681,6 +689,7 @@ bool RadonPage::UpdatePageData(const std::string &name,
 }
 
 bool RadonPage::ResetPageData() {
+  rendered_data_.Clear();
   bool need_update = false;
   if (ShouldKeepPageData()) {
     // enableKeepPageData: true
@@ -9,6 +9,7 @@
 #include "base/include/value/array.h"
 #include "base/include/vector.h"
 #include "base/trace/native/trace_event.h"
+#include "core/event/event_type_atom.h"
 #include "core/renderer/dom/element_manager.h"
 #include "core/renderer/dom/vdom/radon/radon_component.h"
 #include "core/renderer/dom/vdom/radon/radon_node.h"
@@ -1070,6 +1071,10 @@ bool TouchEventHandler::HandleEventInternal(
     }
   }
 
+  // Resolve the event name once, handler lookups along the chain then only
+  // compare the interned key.
+  const base::String &event_key =
+      event::EventTypeAtomTable::CanonicalName(event_name);
   ElementManager *manager = target->element_manager();
   if (manager->GetGlobalBindElementIds(event_name).size() > 0) {
     for (const auto &id : manager->GetGlobalBindElementIds(event_name)) {
@@ -1086,18 +1091,18 @@ bool TouchEventHandler::HandleEventInternal(
         // if set is empty, means the target is all other elements
         operation.append(
             std::move(TouchEventHandler::push_global_bind_operation_f_(
-                event_name, cur_target, target)));
+                event_key, cur_target, target)));
       } else {
         if (option.bubbles_) {
           for (const auto &target : response_chain) {
             operation.append(
                 std::move(TouchEventHandler::get_global_bind_operations_f_(
-                    event_name, cur_target, target, *set)));
+                    event_key, cur_target, target, *set)));
           }
         } else {
           operation.append(
               std::move(TouchEventHandler::get_global_bind_operations_f_(
-                  event_name, cur_target, target, *set)));
+                  event_key, cur_target, target, *set)));
         }
       }
     }
@@ -1112,7 +1117,7 @@ bool TouchEventHandler::HandleEventInternal(
       cur_target = *iter;
       if (cur_target == nullptr) break;
       auto handlers =
-          TouchEventHandler::get_handlers_f_(cur_target, event_name, false);
+          TouchEventHandler::get_handlers_f_(cur_target, event_key, false);
       bool need_break = false;
       for (auto handler : handlers) {
         // Need to copy rather than ref because the handler may be a null
@@ -1142,7 +1147,7 @@ bool TouchEventHandler::HandleEventInternal(
     for (auto *cur_target : response_chain) {
       if (cur_target == nullptr) break;
       auto handlers =
-          TouchEventHandler::get_handlers_f_(cur_target, event_name, false);
+          TouchEventHandler::get_handlers_f_(cur_target, event_key, false);
       bool need_break = false;
       for (auto handler : handlers) {
         // Need to copy rather than ref because the handler may be a null
@@ -1495,6 +1500,8 @@ void TouchEventHandler::HandleGlobalBindAndTriggerEvent(TemplateAssembler *tasm,
   }
 
   EventContext &event_context = item->second;
+  const base::String &event_key =
+      event::EventTypeAtomTable::CanonicalName(event_context.event_name);
   for (const auto &pair : event_context.event_chain_map) {
     const std::string &event_name = event_context.event_name;
     const EventOption &event_option = event_context.option;
@@ -1523,18 +1530,18 @@ void TouchEventHandler::HandleGlobalBindAndTriggerEvent(TemplateAssembler *tasm,
           // if set is empty, means the target is all other elements
           event_ops.append(
               std::move(TouchEventHandler::push_global_bind_operation_f_(
-                  event_name, cur_target, target)));
+                  event_key, cur_target, target)));
         } else {
           if (event_option.bubbles_) {
             for (const auto &target : event_chain) {
               event_ops.append(
                   std::move(TouchEventHandler::get_global_bind_operations_f_(
-                      event_name, cur_target, target, *set)));
+                      event_key, cur_target, target, *set)));
             }
           } else {
             event_ops.append(
                 std::move(TouchEventHandler::get_global_bind_operations_f_(
-                    event_name, cur_target, target, *set)));
+                    event_key, cur_target, target, *set)));
           }
         }
       }
@@ -1556,7 +1563,8 @@ void TouchEventHandler::StartEventCapture(TemplateAssembler *tasm,
   }
 
   EventContext &event_context = item->second;
-  const std::string &event_name = event_context.event_name;
+  const base::String &event_key =
+      event::EventTypeAtomTable::CanonicalName(event_context.event_name);
   const EventOption &event_option = event_context.option;
   base::InlineVector<std::pair<int64_t, bool>, 2> target_catch_vec;
   for (const auto &pair : event_context.event_chain_map) {
@@ -1579,7 +1587,7 @@ void TouchEventHandler::StartEventCapture(TemplateAssembler *tasm,
         }
 
         auto handlers =
-            TouchEventHandler::get_handlers_f_(cur_target, event_name, false);
+            TouchEventHandler::get_handlers_f_(cur_target, event_key, false);
         bool need_break = false;
         for (auto handler : handlers) {
           // Need to copy rather than ref because the handler may be a null
@@ -1627,7 +1635,8 @@ void TouchEventHandler::StartEventBubble(TemplateAssembler *tasm,
   }
 
   EventContext &event_context = item->second;
-  const std::string &event_name = event_context.event_name;
+  const base::String &event_key =
+      event::EventTypeAtomTable::CanonicalName(event_context.event_name);
   const EventOption &event_option = event_context.option;
   base::InlineVector<std::pair<int64_t, bool>, 2> target_catch_vec;
   for (const auto &pair : event_context.event_chain_map) {
@@ -1647,7 +1656,7 @@ void TouchEventHandler::StartEventBubble(TemplateAssembler *tasm,
         }
 
         auto handlers =
-            TouchEventHandler::get_handlers_f_(cur_target, event_name, false);
+            TouchEventHandler::get_handlers_f_(cur_target, event_key, false);
         bool need_break = false;
         for (auto handler : handlers) {
           // Need to copy rather than ref because the handler may be a null
@@ -1785,7 +1794,7 @@ void TouchEventHandler::StartEventFire(TemplateAssembler *tasm, bool is_stop,
 
 FindEventHandler TouchEventHandler::find_event_f_ =
     [](const EventMap &event_map,
-       const std::string &event_name) -> EventHandler * {
+       const base::String &event_name) -> EventHandler * {
   auto it = event_map.find(event_name);
   if (it == event_map.end()) {
     return nullptr;
@@ -1794,7 +1803,7 @@ FindEventHandler TouchEventHandler::find_event_f_ =
 };
 
 GetEventHandlers TouchEventHandler::get_handlers_f_ =
-    [](Element *cur_target, const std::string &event_name,
+    [](Element *cur_target, const base::String &event_name,
        bool global_bind_event) -> base::InlineVector<EventHandler *, 4> {
   base::InlineVector<EventHandler *, 4> res;
   if (global_bind_event) {
@@ -1822,7 +1831,7 @@ GetEventHandlers TouchEventHandler::get_handlers_f_ =
 };
 
 PushGlobalBindOperation TouchEventHandler::push_global_bind_operation_f_ =
-    [](const std::string &event_name, Element *cur_target,
+    [](const base::String &event_name, Element *cur_target,
        Element *target) -> EventOpsVector {
   auto handlers =
       TouchEventHandler::get_handlers_f_(cur_target, event_name, true);
@@ -1838,7 +1847,7 @@ PushGlobalBindOperation TouchEventHandler::push_global_bind_operation_f_ =
 };
 
 GetGlobalBindOperations TouchEventHandler::get_global_bind_operations_f_ =
-    [](const std::string &event_name, Element *cur_target, Element *target,
+    [](const base::String &event_name, Element *cur_target, Element *target,
        const base::LinearFlatSet<std::string> &global_bind_targets)
     -> EventOpsVector {
   EventOpsVector res;
@@ -100,18 +100,22 @@ enum class EventResult : int {
 using ResponseChainVector = base::InlineVector<Element *, 16>;
 using EventOpsVector = base::InlineVector<EventOperation, 2>;
 
+// The event name passed to the following functions is the canonical string of
+// the event type atom, see core/event/event_type_atom.h. Event maps are keyed
+// by the same interned strings, so lookups compare impl pointers instead of
+// string contents.
 typedef EventHandler *(*FindEventHandler)(const EventMap &map,
-                                          const std::string &event_name);
+                                          const base::String &event_name);
 
 typedef base::InlineVector<EventHandler *, 4> (*GetEventHandlers)(
-    Element *cur_target, const std::string &event_name, bool global_bind_event);
+    Element *cur_target, const base::String &event_name,
+    bool global_bind_event);
 
-typedef EventOpsVector (*PushGlobalBindOperation)(const std::string &event_name,
-                                                  Element *cur_target,
-                                                  Element *target);
+typedef EventOpsVector (*PushGlobalBindOperation)(
+    const base::String &event_name, Element *cur_target, Element *target);
 
 typedef EventOpsVector (*GetGlobalBindOperations)(
-    const std::string &event_name, Element *cur_target, Element *target,
+    const base::String &event_name, Element *cur_target, Element *target,
     const base::LinearFlatSet<std::string> &global_bind_targets);
 
 class TouchEventHandler {
@@ -8,6 +8,7 @@
 #include "core/renderer/events/touch_event_handler.h"
 
 #include "base/include/value/base_value.h"
+#include "core/event/event_type_atom.h"
 #include "core/renderer/dom/vdom/radon/radon_dispatch_option.h"
 #include "core/renderer/tasm/react/testing/mock_painting_context.h"
 #include "core/shell/testing/mock_tasm_delegate.h"
@@ -190,6 +191,36 @@ TEST_F(TouchEventHandlerTest, TestHandlerTriggerGestureEvent) {
   touch_event_handler_->HandleGestureEvent(tasm_.get(), "xxxx", 10, 1, obj);
 }
 
+TEST_F(TouchEventHandlerTest, TestGetGlobalBindOperations) {
+  auto& manager = tasm_->page_proxy()->element_manager();
+  auto cur_target = manager->CreateFiberNode("view");
+  cur_target->SetJSEventHandler("tap", "global-bindEvent", "onGlobalTap");
+  auto target = manager->CreateFiberNode("view");
+  const auto& event_name = event::EventTypeAtomTable::CanonicalName("tap");
+
+  base::LinearFlatSet<std::string> global_bind_targets;
+  global_bind_targets.insert("target");
+  // The target without an id is not reached by the global bind.
+  EXPECT_TRUE(TouchEventHandler::get_global_bind_operations_f_(
+                  event_name, cur_target.get(), target.get(),
+                  global_bind_targets)
+                  .empty());
+
+  target->SetIdSelector("target");
+  auto operations = TouchEventHandler::get_global_bind_operations_f_(
+      event_name, cur_target.get(), target.get(), global_bind_targets);
+  ASSERT_EQ(operations.size(), 1u);
+  EXPECT_EQ(operations[0].target_, target.get());
+  EXPECT_EQ(operations[0].current_target_, cur_target.get());
+  EXPECT_EQ(operations[0].handler_->function().str(), "onGlobalTap");
+
+  base::LinearFlatSet<std::string> other_targets;
+  other_targets.insert("other");
+  EXPECT_TRUE(TouchEventHandler::get_global_bind_operations_f_(
+                  event_name, cur_target.get(), target.get(), other_targets)
+                  .empty());
+}
+
 }  // namespace test
 }  // namespace tasm
 }  // namespace lynx
@@ -427,6 +427,34 @@ PageProxy::PageProxy(PageProxy::TasmDelegate *tasm_delegate,
   // so we get once here and use for multi times.
   enable_feature_report_ =
       LynxEnv::GetInstance().EnableGlobalFeatureSwitchStatistic();
+  list_reuse_pool_manager_.SetCapacityGetter(
+      [this](const base::String &reuse_identifier) -> size_t {
+        return client_ ? client_->GetListReusePoolCapacity(reuse_identifier)
+                       : 0;
+      });
+  if (client_) {
+    // Evict recycled list item components within a patch, so that the
+    // removal of their elements is laid out and flushed with it.
+    client_->RegisterWillFinishRadonPatchCallback([this]() {
+      if (list_reuse_pool_manager_.FlushPendingEvictions() > 0) {
+        client_->SetNeedsLayout();
+      }
+    });
+  }
+}
+
+void PageProxy::TrimListReusePools() {
+  // Keep one recycled component of each type to render the next item shown.
+  static constexpr size_t kMaxCountPerTypeAfterTrim = 1;
+  list_reuse_pool_manager_.Trim(kMaxCountPerTypeAfterTrim);
+  if (!HasRadonPage() || !list_reuse_pool_manager_.HasPendingEvictions()) {
+    return;
+  }
+  // Not waiting for the next patch, which may be long after the app entered
+  // background.
+  auto pipeline_options = std::make_shared<PipelineOptions>();
+  element_manager()->OnPatchFinish(pipeline_options);
+  element_manager()->painting_context()->Flush();
 }
 
 void PageProxy::SetRadonPage(RadonPage *page) {
@@ -444,6 +472,11 @@ void PageProxy::SetRadonPage(RadonPage *page) {
 // used for unified pipeline;
 void PageProxy::RequestResolve(
     std::shared_ptr<PipelineOptions> &pipeline_options) {
+  if (GetEnableComponentMemo()) {
+    TRACE_COUNTER(LYNX_TRACE_CATEGORY, RADON_COMPONENT_MEMOIZED_PROPS_COUNTER,
+                  memoized_props_count_);
+    memoized_props_count_ = 0;
+  }
   if (pipeline_options->enable_unified_pixel_pipeline) {
     // TODO(nihao.royal): modify pipeline_option here directly here because
     // only loadTemplate is supported now, current pipeline context won't be
@@ -12,6 +12,7 @@
 
 #include "core/renderer/dom/element_manager.h"
 #include "core/renderer/dom/vdom/radon/base_component.h"
+#include "core/renderer/dom/vdom/radon/list_reuse_pool_manager.h"
 #include "core/renderer/template_themed.h"
 #include "core/runtime/bindings/common/event/context_proxy.h"
 #include "core/services/ssr/client/ssr_data_update_manager.h"
@@ -243,10 +244,23 @@ class PageProxy {
 
   bool GetListRemoveComponent() { return client_->GetListRemoveComponent(); }
 
+  // Bounds the recycled list item components of all lists on the page.
+  ListReusePoolManager *list_reuse_pool_manager() {
+    return &list_reuse_pool_manager_;
+  }
+  // Releases the recycled list item components not reused recently, e.g.
+  // when the app enters background.
+  void TrimListReusePools();
+
   bool GetEnableReloadLifecycle() {
     return client_->GetEnableReloadLifecycle();
   }
 
+  bool GetEnableComponentMemo() { return client_->GetEnableComponentMemo(); }
+  // Called when the props of a component are matched by reference instead of
+  // by the deep comparison, reported as a trace counter on the next resolve.
+  void OnComponentPropsMemoized() { ++memoized_props_count_; }
+
   // get if enable new gesture
   bool GetEnableNewGesture() { return client_->GetEnableNewGesture(); }
 
@@ -423,7 +437,11 @@ class PageProxy {
    *
    * Differentiator will use raw pointer of ElementManager, so `differentiator_`
    * should be released before `client_`.
+   *
+   * The reuse pools of the list nodes in `radon_page_` unregister themselves
+   * from `list_reuse_pool_manager_`, so it is released after them.
    */
+  ListReusePoolManager list_reuse_pool_manager_;
   std::unique_ptr<ElementManager> client_;
 
   // Hold component's element, use component id as key
@@ -435,6 +453,7 @@ class PageProxy {
   bool is_updating_config_ = false;
   bool remove_css_scope_enabled_{false};
   bool page_element_enable_{false};
+  uint32_t memoized_props_count_{0};
   // In pre painting stage, we will not trigger any lifecycle.
   PrePaintingStage pre_painting_stage_{PrePaintingStage::kPrePaintingOFF};
 
@@ -33,5 +33,15 @@ void FlexInfo::Reset() {
 
   line_info_.clear();
 }
+
+void FlexInfo::Clear() {
+  flex_base_size_.clear();
+  hypothetical_main_size_.clear();
+  hypothetical_cross_size_.clear();
+  flex_main_size_.clear();
+  flex_cross_size_.clear();
+  apply_stretch_later_.clear();
+  line_info_.clear();
+}
 }  // namespace starlight
 }  // namespace lynx
@@ -34,6 +34,8 @@ class FlexInfo {
 
   void Initialize(size_t flex_count);
   void Reset();
+  // Empties all arrays, keeping their capacity.
+  void Clear();
 
   InlineFloatArray flex_base_size_;
   InlineFloatArray hypothetical_main_size_;
@@ -30,6 +30,11 @@ void FlexLayoutAlgorithm::InitializeAlgorithmEnv() {
 
 void FlexLayoutAlgorithm::Reset() { flex_info_.Reset(); }
 
+void FlexLayoutAlgorithm::Recycle() {
+  LayoutAlgorithm::Recycle();
+  flex_info_.Clear();
+}
+
 void FlexLayoutAlgorithm::SizeDeterminationByAlgorithm() {
   /*Algorithm-3
    * Determine the flex base size and hypothetical main size of each item:*/
@@ -29,6 +29,7 @@ class FlexLayoutAlgorithm : public LayoutAlgorithm {
 
   void InitializeAlgorithmEnv() override;
   void Reset() override;
+  void Recycle() override;
   void SetContainerBaseline() override;
 
  private:
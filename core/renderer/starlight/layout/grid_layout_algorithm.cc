@@ -4,6 +4,7 @@
 
 #include "core/renderer/starlight/layout/grid_layout_algorithm.h"
 
+#include <memory>
 #include <utility>
 
 #include "core/renderer/starlight/layout/layout_object.h"
@@ -36,6 +37,14 @@ void GridLayoutAlgorithm::InitializeAlgorithmEnv() {
     auto_placement_main_axis_ = BlockAxis();
     auto_placement_cross_axis_ = InlineAxis();
   }
+
+  track_sizing_cache_ = static_cast<GridTrackSizingCache*>(
+      container_->GetAlgorithmCache(LayoutAlgorithmKind::kGrid));
+  if (!track_sizing_cache_) {
+    auto cache = std::make_unique<GridTrackSizingCache>();
+    track_sizing_cache_ = cache.get();
+    container_->SetAlgorithmCache(std::move(cache));
+  }
 }
 
 void GridLayoutAlgorithm::Reset() {
@@ -56,6 +65,38 @@ void GridLayoutAlgorithm::Reset() {
   grid_column_line_offset_from_container_padding_bound_.clear();
 }
 
+void GridLayoutAlgorithm::Recycle() {
+  LayoutAlgorithm::Recycle();
+  is_dense_ = false;
+  has_placement_ = false;
+  auto_placement_main_axis_ = kHorizontal;
+  auto_placement_cross_axis_ = kVertical;
+  row_offset_ = 0;
+  column_offset_ = 0;
+  inline_track_count_ = 0;
+  block_track_count_ = 0;
+  inline_axis_interval_ = 0;
+  block_axis_interval_ = 0;
+  inline_axis_start_ = 0;
+  block_axis_start_ = 0;
+  inline_gap_size_ = 0;
+  block_gap_size_ = 0;
+
+  grid_item_infos_.clear();
+  grid_absolutely_positioned_item_infos_.clear();
+  grid_row_min_track_sizing_function_.clear();
+  grid_row_max_track_sizing_function_.clear();
+  grid_column_min_track_sizing_function_.clear();
+  grid_column_max_track_sizing_function_.clear();
+  grid_row_line_offset_from_container_padding_bound_.clear();
+  grid_column_line_offset_from_container_padding_bound_.clear();
+  // The scratch buffers hold pointers into grid_item_infos_.
+  place_items_cache_.clear();
+  size_infos_.clear();
+  track_sizing_cache_ = nullptr;
+  track_sizing_snapshot_.Clear();
+}
+
 void GridLayoutAlgorithm::AlignInFlowItems() {
   for (const auto& item_info : grid_item_infos_) {
     LayoutObject* item = item_info.Item();
@@ -271,7 +312,8 @@ void GridLayoutAlgorithm::SizeDeterminationByAlgorithm() {
 }
 
 void GridLayoutAlgorithm::PlaceGridItems() {
-  PlaceItemCache place_items_cache;
+  PlaceItemCache& place_items_cache = place_items_cache_;
+  place_items_cache.clear();
   place_items_cache.reserve(inflow_items_.size());
   // 0. Generate anonymous grid items.
   // 1. Position anything that's not auto-positioned.
@@ -571,13 +613,14 @@ void GridLayoutAlgorithm::PlaceGridItemsWithBothAxesAuto(
 }
 
 void GridLayoutAlgorithm::GridItemSizing() {
-  std::vector<float> inline_axis_base_size;
-  std::vector<float> block_axis_base_size;
-  std::vector<LayoutUnit> inline_axis_grow_limit;
-  std::vector<LayoutUnit> block_axis_grow_limit;
+  auto& inline_axis_base_size = inline_axis_base_size_;
+  auto& block_axis_base_size = block_axis_base_size_;
+  auto& inline_axis_grow_limit = inline_axis_grow_limit_;
+  auto& block_axis_grow_limit = block_axis_grow_limit_;
   InitTrackSize(InlineAxis(), inline_axis_base_size, inline_axis_grow_limit);
   InitTrackSize(BlockAxis(), block_axis_base_size, block_axis_grow_limit);
-  MeasureItemCache size_infos;
+  MeasureItemCache& size_infos = size_infos_;
+  size_infos.clear();
   const auto& ResolveTrackGridSize = [this, &size_infos](
                                          Dimension dimension,
                                          std::vector<float>& base_size,
@@ -689,8 +732,8 @@ void GridLayoutAlgorithm::InitTrackSize(Dimension dimension,
 
   // Initialize each track's base size and growth limit.
   const size_t tracks_size = GridTrackCount(dimension);
-  base_size.resize(tracks_size);
-  grow_limit.resize(tracks_size);
+  base_size.assign(tracks_size, 0.f);
+  grow_limit.assign(tracks_size, LayoutUnit());
   for (size_t idx = 0; idx < tracks_size; ++idx) {
     switch (min_track_sizing_function[idx].GetType()) {
       case NLengthType::kNLengthUnit:
@@ -975,13 +1018,26 @@ void GridLayoutAlgorithm::ResolveIntrinsicTrackSizes(
                             return !a.item_info->IsCrossFlexibleTrack(dis);
                           });
     // collect various size contributions track index and resolve fit-content.
-    std::vector<size_t> intrinsic_minimums_tracks_index_vec;
-    std::vector<size_t> content_based_minimums_tracks_index_vec;
-    std::vector<size_t> max_content_minimums_tracks_index_vec;
-    std::vector<size_t> max_content_or_auto_minimums_tracks_index_vec;
-    std::vector<size_t> max_content_maximums_tracks_index_vec;
-    std::vector<size_t> intrinsic_maximums_tracks_index_vec;
-    std::vector<float> fit_content_argument_value(grid_track_count, -1.f);
+    auto& intrinsic_minimums_tracks_index_vec =
+        intrinsic_minimums_tracks_index_;
+    auto& content_based_minimums_tracks_index_vec =
+        content_based_minimums_tracks_index_;
+    auto& max_content_minimums_tracks_index_vec =
+        max_content_minimums_tracks_index_;
+    auto& max_content_or_auto_minimums_tracks_index_vec =
+        max_content_or_auto_minimums_tracks_index_;
+    auto& max_content_maximums_tracks_index_vec =
+        max_content_maximums_tracks_index_;
+    auto& intrinsic_maximums_tracks_index_vec =
+        intrinsic_maximums_tracks_index_;
+    intrinsic_minimums_tracks_index_vec.clear();
+    content_based_minimums_tracks_index_vec.clear();
+    max_content_minimums_tracks_index_vec.clear();
+    max_content_or_auto_minimums_tracks_index_vec.clear();
+    max_content_maximums_tracks_index_vec.clear();
+    intrinsic_maximums_tracks_index_vec.clear();
+    auto& fit_content_argument_value = fit_content_argument_value_;
+    fit_content_argument_value.assign(grid_track_count, -1.f);
     for (int32_t idx = 0; idx < grid_track_count; ++idx) {
       switch (min_track_sizing_function[idx].GetType()) {
           // If the track was sized with a <flex> value or fit-content()
@@ -1126,6 +1182,38 @@ void GridLayoutAlgorithm::ResolveIntrinsicTrackSizes(
               : minimum_contributions[item_index];
     }
 
+    // The track sizes only depend on the inputs collected so far, so they may
+    // be taken from the previous pass.
+    if (track_sizing_cache_) {
+      auto& snapshot = track_sizing_snapshot_;
+      snapshot.Clear();
+      snapshot.is_indefinite =
+          IsSLIndefiniteMode(container_constraints_[dimension].Mode());
+      snapshot.gap_size = GridGapSize(dimension);
+      snapshot.min_track_sizing_function = min_track_sizing_function;
+      snapshot.max_track_sizing_function = max_track_sizing_function;
+      snapshot.fit_content_argument_value = fit_content_argument_value;
+      snapshot.initial_base_size = base_size;
+      snapshot.initial_grow_limit = grow_limit;
+      for (size_t item_index = 0; item_index < items_count; ++item_index) {
+        const GridItemInfo& item_info = *item_size_infos[item_index].item_info;
+        snapshot.item_start_lines.emplace_back(item_info.StartLine(dimension));
+        snapshot.item_end_lines.emplace_back(item_info.EndLine(dimension));
+        snapshot.item_crosses_flexible_track.emplace_back(
+            item_info.IsCrossFlexibleTrack(dimension));
+        snapshot.contributions.insert(
+            snapshot.contributions.end(),
+            {minimum_contributions[item_index],
+             min_content_contributions[item_index],
+             limited_min_content_contributions[item_index],
+             max_content_contributions[item_index],
+             limited_max_content_contributions[item_index]});
+      }
+      if (ReuseIntrinsicTrackSizes(dimension, base_size, grow_limit)) {
+        return;
+      }
+    }
+
     // size tracks to fit non-spanning items: For each track with an intrinsic
     // track sizing function and not a flexible sizing function, consider the
     // items in it with a span of 1:
@@ -1136,77 +1224,12 @@ void GridLayoutAlgorithm::ResolveIntrinsicTrackSizes(
           item_info.IsCrossFlexibleTrack(dimension)) {
         break;
       }
-      const size_t track_index = item_info.StartLine(dimension) - 1;
-      // For min-content minimums: Lynx does not support min-content yet.
-
-      // For max-content minimums:
-      if (min_track_sizing_function[track_index].IsMaxContent()) {
-        base_size[track_index] =
-            base::FloatsLarger(max_content_contributions[item_index],
-                               base_size[track_index])
-                ? max_content_contributions[item_index]
-                : base_size[track_index];
-      } else if (min_track_sizing_function[track_index].IsAuto() ||
-                 min_track_sizing_function[track_index].IsFitContent() ||
-                 min_track_sizing_function[track_index].IsFr()) {
-        // For auto minimums:
-        // if the grid container is being sized under a min-/max-content
-        // constraint,
-        if (IsSLIndefiniteMode(container_constraints_[dimension].Mode())) {
-          base_size[track_index] =
-              base::FloatsLarger(base_size[track_index],
-                                 limited_max_content_contributions[item_index])
-                  ? base_size[track_index]
-                  : limited_max_content_contributions[item_index];
-        }
-        // Otherwise, set the track's base size to the maximum of its items'
-        // minimum contributions, floored at zero.
-        else {
-          base_size[track_index] =
-              base::FloatsLarger(base_size[track_index],
-                                 minimum_contributions[item_index])
-                  ? base_size[track_index]
-                  : minimum_contributions[item_index];
-        }
-      }
-
-      // For min-content maximums: Lynx does not support min-content yet.
-
-      // For max-content maximums:
-      // In all cases, treat auto and fit-content() as max-content
-      if (max_track_sizing_function[track_index].IsAuto() ||
-          max_track_sizing_function[track_index].IsMaxContent() ||
-          max_track_sizing_function[track_index].IsFitContent()) {
-        if (grow_limit[track_index].IsDefinite()) {
-          grow_limit[track_index] =
-              base::FloatsLarger(max_content_contributions[item_index],
-                                 grow_limit[track_index].ToFloat())
-                  ? LayoutUnit(max_content_contributions[item_index])
-                  : grow_limit[track_index];
-        } else {
-          grow_limit[track_index] =
-              LayoutUnit(max_content_contributions[item_index]);
-        }
-      }
-      // For fit-content() maximums, furthermore clamp this growth limit by
-      // the fit-content() argument.
-      if (max_track_sizing_function[track_index].IsFitContent() &&
-          base::FloatsLargerOrEqual(fit_content_argument_value[track_index],
-                                    0.f)) {
-        grow_limit[track_index] =
-            base::FloatsLarger(grow_limit[track_index].ToFloat(),
-                               fit_content_argument_value[track_index])
-                ? LayoutUnit(fit_content_argument_value[track_index])
-                : grow_limit[track_index];
-      }
-
-      // In all cases, if a track's growth limit is now less than its base
-      // size, increase the growth limit to match the base size.
-      if (grow_limit[track_index].IsDefinite() &&
-          base::FloatsLarger(base_size[track_index],
-                             grow_limit[track_index].ToFloat())) {
-        grow_limit[track_index] = LayoutUnit(base_size[track_index]);
-      }
+      SizeTrackToFitNonSpanningItem(
+          dimension, item_info.StartLine(dimension) - 1,
+          minimum_contributions[item_index],
+          limited_max_content_contributions[item_index],
+          max_content_contributions[item_index], fit_content_argument_value,
+          base_size, grow_limit);
     }
 
     // Increase sizes to accommodate spanning items crossing content-sized
@@ -1327,7 +1350,147 @@ void GridLayoutAlgorithm::ResolveIntrinsicTrackSizes(
         grow_limit[idx] = LayoutUnit(base_size[idx]);
       }
     }
+
+    if (track_sizing_cache_) {
+      track_sizing_snapshot_.base_size = base_size;
+      track_sizing_snapshot_.grow_limit = grow_limit;
+      track_sizing_cache_->Store(dimension, track_sizing_snapshot_);
+    }
+  }
+}
+
+void GridLayoutAlgorithm::SizeTrackToFitNonSpanningItem(
+    Dimension dimension, size_t track_index, float minimum_contribution,
+    float limited_max_content_contribution, float max_content_contribution,
+    const std::vector<float>& fit_content_argument_value,
+    std::vector<float>& base_size, std::vector<LayoutUnit>& grow_limit) {
+  const auto& min_track_sizing_function = MinTrackSizingFunction(dimension);
+  const auto& max_track_sizing_function = MaxTrackSizingFunction(dimension);
+  // For min-content minimums: Lynx does not support min-content yet.
+
+  // For max-content minimums:
+  if (min_track_sizing_function[track_index].IsMaxContent()) {
+    base_size[track_index] =
+        base::FloatsLarger(max_content_contribution, base_size[track_index])
+            ? max_content_contribution
+            : base_size[track_index];
+  } else if (min_track_sizing_function[track_index].IsAuto() ||
+             min_track_sizing_function[track_index].IsFitContent() ||
+             min_track_sizing_function[track_index].IsFr()) {
+    // For auto minimums:
+    // if the grid container is being sized under a min-/max-content
+    // constraint,
+    if (IsSLIndefiniteMode(container_constraints_[dimension].Mode())) {
+      base_size[track_index] =
+          base::FloatsLarger(base_size[track_index],
+                             limited_max_content_contribution)
+              ? base_size[track_index]
+              : limited_max_content_contribution;
+    }
+    // Otherwise, set the track's base size to the maximum of its items'
+    // minimum contributions, floored at zero.
+    else {
+      base_size[track_index] =
+          base::FloatsLarger(base_size[track_index], minimum_contribution)
+              ? base_size[track_index]
+              : minimum_contribution;
+    }
+  }
+
+  // For min-content maximums: Lynx does not support min-content yet.
+
+  // For max-content maximums:
+  // In all cases, treat auto and fit-content() as max-content
+  if (max_track_sizing_function[track_index].IsAuto() ||
+      max_track_sizing_function[track_index].IsMaxContent() ||
+      max_track_sizing_function[track_index].IsFitContent()) {
+    if (grow_limit[track_index].IsDefinite()) {
+      grow_limit[track_index] =
+          base::FloatsLarger(max_content_contribution,
+                             grow_limit[track_index].ToFloat())
+              ? LayoutUnit(max_content_contribution)
+              : grow_limit[track_index];
+    } else {
+      grow_limit[track_index] = LayoutUnit(max_content_contribution);
+    }
+  }
+  // For fit-content() maximums, furthermore clamp this growth limit by
+  // the fit-content() argument.
+  if (max_track_sizing_function[track_index].IsFitContent() &&
+      base::FloatsLargerOrEqual(fit_content_argument_value[track_index],
+                                0.f)) {
+    grow_limit[track_index] =
+        base::FloatsLarger(grow_limit[track_index].ToFloat(),
+                           fit_content_argument_value[track_index])
+            ? LayoutUnit(fit_content_argument_value[track_index])
+            : grow_limit[track_index];
+  }
+
+  // In all cases, if a track's growth limit is now less than its base
+  // size, increase the growth limit to match the base size.
+  if (grow_limit[track_index].IsDefinite() &&
+      base::FloatsLarger(base_size[track_index],
+                         grow_limit[track_index].ToFloat())) {
+    grow_limit[track_index] = LayoutUnit(base_size[track_index]);
+  }
+}
+
+bool GridLayoutAlgorithm::ReuseIntrinsicTrackSizes(
+    Dimension dimension, std::vector<float>& base_size,
+    std::vector<LayoutUnit>& grow_limit) {
+  const GridTrackSizingSnapshot& snapshot = track_sizing_snapshot_;
+  const auto reuse =
+      track_sizing_cache_->Compare(dimension, snapshot, dirty_tracks_);
+  track_sizing_cache_->RecordReuse(reuse);
+  if (reuse == GridTrackSizingCache::Reuse::kNone) {
+    return false;
+  }
+  const GridTrackSizingSnapshot& last = track_sizing_cache_->Last(dimension);
+  if (reuse == GridTrackSizingCache::Reuse::kAll) {
+    base_size = last.base_size;
+    grow_limit = last.grow_limit;
+    return true;
+  }
+
+  // Every item spans a single track, so only the tracks holding a changed item
+  // are sized again, starting from their initial sizes.
+  const size_t track_count = base_size.size();
+  is_dirty_track_.assign(track_count, false);
+  for (const size_t track_index : dirty_tracks_) {
+    is_dirty_track_[track_index] = true;
+  }
+  for (size_t idx = 0; idx < track_count; ++idx) {
+    if (!is_dirty_track_[idx]) {
+      base_size[idx] = last.base_size[idx];
+      grow_limit[idx] = last.grow_limit[idx];
+    }
+  }
+  for (size_t item_index = 0; item_index < snapshot.item_start_lines.size();
+       ++item_index) {
+    const size_t track_index = snapshot.item_start_lines[item_index] - 1;
+    if (!is_dirty_track_[track_index]) {
+      continue;
+    }
+    SizeTrackToFitNonSpanningItem(
+        dimension, track_index,
+        snapshot.ItemContribution(item_index,
+                                  GridTrackSizingSnapshot::kMinimum),
+        snapshot.ItemContribution(item_index,
+                                  GridTrackSizingSnapshot::kLimitedMaxContent),
+        snapshot.ItemContribution(item_index,
+                                  GridTrackSizingSnapshot::kMaxContent),
+        snapshot.fit_content_argument_value, base_size, grow_limit);
+  }
+  for (const size_t track_index : dirty_tracks_) {
+    if (grow_limit[track_index].IsIndefinite()) {
+      grow_limit[track_index] = LayoutUnit(base_size[track_index]);
+    }
   }
+
+  track_sizing_snapshot_.base_size = base_size;
+  track_sizing_snapshot_.grow_limit = grow_limit;
+  track_sizing_cache_->Store(dimension, track_sizing_snapshot_);
+  return true;
 }
 
 // To distribute extra space by increasing the affected sizes of a set of
@@ -1361,15 +1524,27 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
   const bool if_resolve_item_crossing_flexible_track =
       item_size_infos[considered_items_index_vec[0]]
           .item_info->IsCrossFlexibleTrack(dimension);
+  std::vector<bool> is_affected_track(grid_track_count, false);
+  for (const size_t track_index : affected_track_index_vec) {
+    is_affected_track[track_index] = true;
+  }
+
+  // The per-track state of an item is only read for the tracks it crosses,
+  // so it is allocated once and those entries are reset for each item.
+  std::vector<float> item_incurred_increase(grid_track_count, 0.f);
+  std::vector<bool> frozen(grid_track_count, false);
+  std::vector<float> flex_factor(grid_track_count, 0.f);
+  std::vector<bool> frozen_beyond_limits(grid_track_count, false);
+  std::vector<size_t> affected_track_index_vec_item_cross;
+  std::vector<size_t> track_index_vec_to_distribute;
 
   // For each considered item:
   for (size_t idx = 0; idx < considered_items_index_vec.size(); ++idx) {
-    std::vector<float> item_incurred_increase(grid_track_count, 0.f);
     const size_t item_index = considered_items_index_vec[idx];
     const GridItemInfo& item_info = *item_size_infos[item_index].item_info;
     const size_t start_line = item_info.StartLine(dimension);
     const size_t end_line = item_info.EndLine(dimension);
-    std::vector<size_t> affected_track_index_vec_item_cross;
+    affected_track_index_vec_item_cross.clear();
 
     // 1. Find the space to distribute:
     float extra_space =
@@ -1390,9 +1565,7 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
       }
 
       // collect the affected tracks index which the item actually crossed.
-      if (std::find(affected_track_index_vec.begin(),
-                    affected_track_index_vec.end(),
-                    track_index) != affected_track_index_vec.end()) {
+      if (is_affected_track[track_index]) {
         // when resolve items crossing flexible track, distributing
         // space only to flexible tracks (i.e. treating all other tracks
         // as having a fixed sizing function), so only collect the
@@ -1411,11 +1584,15 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
     }
 
     extra_space = base::FloatsLarger(extra_space, 0.f) ? extra_space : 0.f;
+    for (const size_t track_index : affected_track_index_vec_item_cross) {
+      item_incurred_increase[track_index] = 0.f;
+      frozen[track_index] = false;
+      flex_factor[track_index] = 0.f;
+      frozen_beyond_limits[track_index] = false;
+    }
 
     // 2. Distribute space up to limits:
     bool all_tracks_frozen = false;
-    std::vector<bool> frozen(grid_track_count, false);
-    std::vector<float> flex_factor(grid_track_count, 0.f);
     while (true) {
       int32_t unfrozen_count = 0;
       float flex_factor_sum = 0.f;
@@ -1540,7 +1717,7 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
 
     // 3. Distribute space beyond limits:
     if (all_tracks_frozen && base::FloatsLarger(extra_space, 0.f)) {
-      std::vector<size_t> track_index_vec_to_distribute;
+      track_index_vec_to_distribute.clear();
       for (size_t idx = 0; idx < affected_track_index_vec_item_cross.size();
            ++idx) {
         const size_t track_index = affected_track_index_vec_item_cross[idx];
@@ -1576,7 +1753,6 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
 
       if (track_index_vec_to_distribute.size() != 0) {
         int32_t unfrozen_count = 0;
-        std::vector<bool> frozen(grid_track_count, false);
         for (size_t idx = 0; idx < track_index_vec_to_distribute.size();
              ++idx) {
           const size_t track_index = track_index_vec_to_distribute[idx];
@@ -1603,7 +1779,7 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
                                    affected_track_hypothetical_size)) {
               ++unfrozen_count;
             } else {
-              frozen[track_index] = true;
+              frozen_beyond_limits[track_index] = true;
             }
           } else {
             ++unfrozen_count;
@@ -1615,7 +1791,7 @@ void GridLayoutAlgorithm::DistributeExtraSpace(
           for (size_t idx = 0; idx < track_index_vec_to_distribute.size();
                ++idx) {
             const size_t track_index = track_index_vec_to_distribute[idx];
-            if (!frozen[track_index]) {
+            if (!frozen_beyond_limits[track_index]) {
               item_incurred_increase[track_index] += hypothetical_distribution;
             }
           }
@@ -9,6 +9,7 @@
 #include <vector>
 
 #include "core/renderer/starlight/layout/grid_item_info.h"
+#include "core/renderer/starlight/layout/grid_track_sizing_cache.h"
 #include "core/renderer/starlight/layout/layout_algorithm.h"
 
 namespace lynx {
@@ -27,6 +28,9 @@ class GridLayoutAlgorithm : public LayoutAlgorithm {
   void SizeDeterminationByAlgorithm() override;
   void SetContainerBaseline() override{};
 
+ protected:
+  void Recycle() override;
+
  private:
   // The auto-placement cursor defines the current “insertion point” in the
   // grid, specified as a pair of row and column grid lines.
@@ -68,6 +72,19 @@ class GridLayoutAlgorithm : public LayoutAlgorithm {
                                   MeasureItemCache& item_size_infos,
                                   std::vector<float>& base_size,
                                   std::vector<LayoutUnit>& grow_limit);
+  // Sizes the track to fit one item of span 1 which does not cross a flexible
+  // track.
+  void SizeTrackToFitNonSpanningItem(
+      Dimension dimension, size_t track_index, float minimum_contribution,
+      float limited_max_content_contribution, float max_content_contribution,
+      const std::vector<float>& fit_content_argument_value,
+      std::vector<float>& base_size, std::vector<LayoutUnit>& grow_limit);
+  // Tries to take the track sizes from track_sizing_cache_ instead of running
+  // the span 1 and the spanning item steps. Returns false if they have to be
+  // resolved in full.
+  bool ReuseIntrinsicTrackSizes(Dimension dimension,
+                                std::vector<float>& base_size,
+                                std::vector<LayoutUnit>& grow_limit);
   void DistributeExtraSpace(
       const MeasureItemCache& item_size_infos, std::vector<float>& base_size,
       std::vector<LayoutUnit>& grow_limit,
@@ -179,6 +196,30 @@ class GridLayoutAlgorithm : public LayoutAlgorithm {
 
   std::vector<float> grid_row_line_offset_from_container_padding_bound_;
   std::vector<float> grid_column_line_offset_from_container_padding_bound_;
+
+  // Scratch buffers of placement and track sizing. They are members only to
+  // keep their capacity while the algorithm is pooled, and are cleared before
+  // each use.
+  PlaceItemCache place_items_cache_;
+  MeasureItemCache size_infos_;
+  std::vector<float> inline_axis_base_size_;
+  std::vector<float> block_axis_base_size_;
+  std::vector<LayoutUnit> inline_axis_grow_limit_;
+  std::vector<LayoutUnit> block_axis_grow_limit_;
+  // Track indices collected by ResolveIntrinsicTrackSizes.
+  std::vector<size_t> intrinsic_minimums_tracks_index_;
+  std::vector<size_t> content_based_minimums_tracks_index_;
+  std::vector<size_t> max_content_minimums_tracks_index_;
+  std::vector<size_t> max_content_or_auto_minimums_tracks_index_;
+  std::vector<size_t> max_content_maximums_tracks_index_;
+  std::vector<size_t> intrinsic_maximums_tracks_index_;
+  std::vector<float> fit_content_argument_value_;
+
+  // Track sizes of the previous passes, owned by container_.
+  GridTrackSizingCache* track_sizing_cache_ = nullptr;
+  GridTrackSizingSnapshot track_sizing_snapshot_;
+  std::vector<size_t> dirty_tracks_;
+  std::vector<bool> is_dirty_track_;
 };
 
 }  // namespace starlight
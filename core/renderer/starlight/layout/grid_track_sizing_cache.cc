@@ -0,0 +1,108 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/starlight/layout/grid_track_sizing_cache.h"
+
+#include <algorithm>
+#include <utility>
+
+namespace lynx {
+namespace starlight {
+
+void GridTrackSizingSnapshot::Clear() {
+  valid = false;
+  is_indefinite = false;
+  gap_size = 0.f;
+  min_track_sizing_function.clear();
+  max_track_sizing_function.clear();
+  fit_content_argument_value.clear();
+  initial_base_size.clear();
+  initial_grow_limit.clear();
+  item_start_lines.clear();
+  item_end_lines.clear();
+  item_crosses_flexible_track.clear();
+  contributions.clear();
+  base_size.clear();
+  grow_limit.clear();
+}
+
+bool GridTrackSizingSnapshot::HasSameLayoutKey(
+    const GridTrackSizingSnapshot& other) const {
+  return is_indefinite == other.is_indefinite && gap_size == other.gap_size &&
+         min_track_sizing_function == other.min_track_sizing_function &&
+         max_track_sizing_function == other.max_track_sizing_function &&
+         fit_content_argument_value == other.fit_content_argument_value &&
+         initial_base_size == other.initial_base_size &&
+         initial_grow_limit == other.initial_grow_limit &&
+         item_start_lines == other.item_start_lines &&
+         item_end_lines == other.item_end_lines &&
+         item_crosses_flexible_track == other.item_crosses_flexible_track;
+}
+
+bool GridTrackSizingSnapshot::HasOnlyNonSpanningItems() const {
+  for (size_t idx = 0; idx < item_start_lines.size(); ++idx) {
+    if (item_end_lines[idx] - item_start_lines[idx] != 1 ||
+        item_crosses_flexible_track[idx]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+GridTrackSizingCache::Reuse GridTrackSizingCache::Compare(
+    Dimension dimension, const GridTrackSizingSnapshot& current,
+    std::vector<size_t>& dirty_tracks) const {
+  dirty_tracks.clear();
+  const GridTrackSizingSnapshot& last = snapshots_[dimension];
+  if (!last.valid || !last.HasSameLayoutKey(current)) {
+    return Reuse::kNone;
+  }
+  if (last.contributions == current.contributions) {
+    return Reuse::kAll;
+  }
+  // An item spanning several tracks distributes space over all of them, which
+  // depends on the sizes the other items gave them before.
+  if (!current.HasOnlyNonSpanningItems()) {
+    return Reuse::kNone;
+  }
+
+  const size_t count = GridTrackSizingSnapshot::kContributionCount;
+  for (size_t item_index = 0; item_index < current.item_start_lines.size();
+       ++item_index) {
+    const auto begin = item_index * count;
+    if (!std::equal(current.contributions.begin() + begin,
+                    current.contributions.begin() + begin + count,
+                    last.contributions.begin() + begin)) {
+      dirty_tracks.emplace_back(current.item_start_lines[item_index] - 1);
+    }
+  }
+  std::sort(dirty_tracks.begin(), dirty_tracks.end());
+  dirty_tracks.erase(std::unique(dirty_tracks.begin(), dirty_tracks.end()),
+                     dirty_tracks.end());
+  return Reuse::kPartial;
+}
+
+void GridTrackSizingCache::Store(Dimension dimension,
+                                 GridTrackSizingSnapshot& current) {
+  std::swap(snapshots_[dimension], current);
+  snapshots_[dimension].valid = true;
+  current.valid = false;
+}
+
+void GridTrackSizingCache::RecordReuse(Reuse reuse) {
+  switch (reuse) {
+    case Reuse::kAll:
+      ++reuse_all_count_;
+      break;
+    case Reuse::kPartial:
+      ++reuse_partial_count_;
+      break;
+    case Reuse::kNone:
+      ++reuse_none_count_;
+      break;
+  }
+}
+
+}  // namespace starlight
+}  // namespace lynx
@@ -0,0 +1,110 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_STARLIGHT_LAYOUT_GRID_TRACK_SIZING_CACHE_H_
+#define CORE_RENDERER_STARLIGHT_LAYOUT_GRID_TRACK_SIZING_CACHE_H_
+
+#include <cstdint>
+#include <vector>
+
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
+#include "core/renderer/starlight/types/layout_directions.h"
+#include "core/renderer/starlight/types/layout_unit.h"
+#include "core/renderer/starlight/types/nlength.h"
+
+namespace lynx {
+namespace starlight {
+
+// The inputs and the result of resolving the intrinsic track sizes of one
+// dimension of a grid container.
+struct GridTrackSizingSnapshot {
+  // Size contributions kept per item, in this order.
+  enum Contribution {
+    kMinimum = 0,
+    kMinContent,
+    kLimitedMinContent,
+    kMaxContent,
+    kLimitedMaxContent,
+    kContributionCount,
+  };
+
+  void Clear();
+
+  // Everything but the item contributions is equal.
+  bool HasSameLayoutKey(const GridTrackSizingSnapshot& other) const;
+  // No item spans several tracks or crosses a flexible track, so the size of
+  // each track only depends on the items in it.
+  bool HasOnlyNonSpanningItems() const;
+  float ItemContribution(size_t item_index, Contribution contribution) const {
+    return contributions[item_index * kContributionCount + contribution];
+  }
+
+  bool valid = false;
+  bool is_indefinite = false;
+  float gap_size = 0.f;
+  std::vector<NLength> min_track_sizing_function;
+  std::vector<NLength> max_track_sizing_function;
+  std::vector<float> fit_content_argument_value;
+  std::vector<float> initial_base_size;
+  std::vector<LayoutUnit> initial_grow_limit;
+
+  // The items in the order they are resolved, i.e. sorted by span. Only the
+  // placement and the contributions of an item are kept, the track sizes do
+  // not depend on anything else of it.
+  std::vector<int32_t> item_start_lines;
+  std::vector<int32_t> item_end_lines;
+  std::vector<bool> item_crosses_flexible_track;
+  std::vector<float> contributions;
+
+  std::vector<float> base_size;
+  std::vector<LayoutUnit> grow_limit;
+};
+
+/*
+ * Keeps the intrinsic track sizes of a grid container between layout passes.
+ * The sizing inputs of a pass are compared with the last ones:
+ * - if they are equal, the last track sizes are reused as they are;
+ * - if only the contributions of items which span a single track changed,
+ *   only the tracks holding those items are sized again;
+ * - otherwise all tracks are sized by the full algorithm.
+ * The item contributions themselves come from the layout cache of each item,
+ * so an unchanged item is not laid out again to get them.
+ */
+class GridTrackSizingCache : public LayoutAlgorithmCache {
+ public:
+  enum class Reuse {
+    kNone,
+    kPartial,
+    kAll,
+  };
+
+  GridTrackSizingCache() : LayoutAlgorithmCache(LayoutAlgorithmKind::kGrid) {}
+
+  // Compares current with the last snapshot of the dimension. On kPartial
+  // the tracks which need to be sized again are put into dirty_tracks.
+  Reuse Compare(Dimension dimension, const GridTrackSizingSnapshot& current,
+                std::vector<size_t>& dirty_tracks) const;
+  const GridTrackSizingSnapshot& Last(Dimension dimension) const {
+    return snapshots_[dimension];
+  }
+  // Keeps current as the last snapshot of the dimension, and leaves the
+  // previous snapshot in current for reuse of its buffers.
+  void Store(Dimension dimension, GridTrackSizingSnapshot& current);
+
+  size_t reuse_all_count() const { return reuse_all_count_; }
+  size_t reuse_partial_count() const { return reuse_partial_count_; }
+  size_t reuse_none_count() const { return reuse_none_count_; }
+  void RecordReuse(Reuse reuse);
+
+ private:
+  GridTrackSizingSnapshot snapshots_[2];
+  size_t reuse_all_count_ = 0;
+  size_t reuse_partial_count_ = 0;
+  size_t reuse_none_count_ = 0;
+};
+
+}  // namespace starlight
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_STARLIGHT_LAYOUT_GRID_TRACK_SIZING_CACHE_H_
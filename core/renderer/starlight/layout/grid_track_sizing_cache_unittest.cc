@@ -0,0 +1,267 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/starlight/layout/grid_track_sizing_cache.h"
+
+#include <memory>
+#include <vector>
+
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
+#include "core/renderer/starlight/layout/layout_object.h"
+#include "core/renderer/starlight/style/layout_computed_style.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace starlight {
+
+namespace {
+
+class Random {
+ public:
+  explicit Random(uint32_t seed) : state_(seed) {}
+  uint32_t Next(uint32_t bound) {
+    state_ = state_ * 1103515245 + 12345;
+    return (state_ >> 16) % bound;
+  }
+
+ private:
+  uint32_t state_;
+};
+
+struct ItemSpec {
+  float width = 0.f;
+  float height = 0.f;
+  int32_t column_span = 1;
+};
+
+struct GridSpec {
+  std::vector<NLength> columns;
+  std::vector<ItemSpec> items;
+  // A negative width lays the container out under a max-content constraint.
+  float container_width = -1.f;
+};
+
+NLength MakeTrack(Random& random) {
+  switch (random.Next(4)) {
+    case 0:
+      return NLength::MakeUnitNLength(10.f + random.Next(40));
+    case 1:
+      return NLength::MakeMaxContentNLength();
+    case 2:
+      return NLength::MakeFitContentNLength(
+          NLength::MakeUnitNLength(20.f + random.Next(40)).NumericLength());
+    default:
+      return NLength::MakeAutoNLength();
+  }
+}
+
+GridSpec MakeGridSpec(Random& random, bool spanning) {
+  GridSpec spec;
+  const size_t column_count = 1 + random.Next(5);
+  for (size_t idx = 0; idx < column_count; ++idx) {
+    spec.columns.emplace_back(MakeTrack(random));
+  }
+  const size_t item_count = 1 + random.Next(12);
+  for (size_t idx = 0; idx < item_count; ++idx) {
+    auto& item = spec.items.emplace_back();
+    item.width = random.Next(80);
+    item.height = random.Next(50);
+    if (spanning) {
+      item.column_span = 1 + random.Next(column_count);
+    }
+  }
+  if (random.Next(2)) {
+    spec.container_width = 100.f + random.Next(300);
+  }
+  return spec;
+}
+
+class GridTree {
+ public:
+  GridTree(const LayoutConfigs& configs, const GridSpec& spec)
+      : container_style_(1.f), container_(configs, &container_style_) {
+    container_style_.SetDisplay(DisplayType::kGrid);
+    auto* grid_data = container_style_.grid_data_.Access();
+    grid_data->grid_template_columns_min_track_sizing_function_ =
+        spec.columns;
+    grid_data->grid_template_columns_max_track_sizing_function_ =
+        spec.columns;
+    container_style_.SetColumnGap(NLength::MakeUnitNLength(4.f));
+    if (spec.container_width >= 0.f) {
+      container_style_.SetWidth(
+          NLength::MakeUnitNLength(spec.container_width));
+    }
+    for (const auto& item : spec.items) {
+      item_styles_.emplace_back(std::make_unique<LayoutComputedStyle>(1.f));
+      auto& style = *item_styles_.back();
+      style.grid_data_.Access()->grid_column_span_ = item.column_span;
+      items_.emplace_back(std::make_unique<LayoutObject>(configs, &style));
+      container_.AppendChild(items_.back().get());
+      SetItemSize(items_.size() - 1, item);
+    }
+  }
+
+  ~GridTree() {
+    for (auto& item : items_) {
+      container_.RemoveChild(item.get());
+    }
+  }
+
+  void SetItemSize(size_t index, const ItemSpec& item) {
+    item_styles_[index]->SetWidth(NLength::MakeUnitNLength(item.width));
+    item_styles_[index]->SetHeight(NLength::MakeUnitNLength(item.height));
+    items_[index]->MarkDirty();
+  }
+
+  // Lays the grid out and clears the dirty flags the way the layout node
+  // does once the result is consumed.
+  void Layout() {
+    container_.ReLayout();
+    container_.MarkUpdated();
+    for (auto& item : items_) {
+      item->MarkUpdated();
+    }
+  }
+
+  const GridTrackSizingCache* Cache() const {
+    return static_cast<const GridTrackSizingCache*>(
+        container_.GetAlgorithmCache(LayoutAlgorithmKind::kGrid));
+  }
+
+  void ExpectSameLayout(const GridTree& other) const {
+    EXPECT_EQ(container_.GetBorderBoundWidth(),
+              other.container_.GetBorderBoundWidth());
+    EXPECT_EQ(container_.GetBorderBoundHeight(),
+              other.container_.GetBorderBoundHeight());
+    ASSERT_EQ(items_.size(), other.items_.size());
+    for (size_t idx = 0; idx < items_.size(); ++idx) {
+      const auto& item = *items_[idx];
+      const auto& other_item = *other.items_[idx];
+      EXPECT_EQ(item.GetBorderBoundLeftFromParentPaddingBound(),
+                other_item.GetBorderBoundLeftFromParentPaddingBound())
+          << "item " << idx;
+      EXPECT_EQ(item.GetBorderBoundTopFromParentPaddingBound(),
+                other_item.GetBorderBoundTopFromParentPaddingBound())
+          << "item " << idx;
+      EXPECT_EQ(item.GetBorderBoundWidth(), other_item.GetBorderBoundWidth())
+          << "item " << idx;
+      EXPECT_EQ(item.GetBorderBoundHeight(),
+                other_item.GetBorderBoundHeight())
+          << "item " << idx;
+    }
+  }
+
+ private:
+  LayoutComputedStyle container_style_;
+  LayoutObject container_;
+  std::vector<std::unique_ptr<LayoutComputedStyle>> item_styles_;
+  std::vector<std::unique_ptr<LayoutObject>> items_;
+};
+
+}  // namespace
+
+class GridTrackSizingCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override { configs_.SetQuirksMode(kGridNewVersion); }
+
+  // Lays a grid out, changes one item and lays it out again, then compares
+  // the result with a grid created with the changed item.
+  void RunRelayoutMatchesFreshLayout(bool spanning) {
+    Random random(spanning ? 7 : 3);
+    for (int round = 0; round < 200; ++round) {
+      SCOPED_TRACE(round);
+      GridSpec spec = MakeGridSpec(random, spanning);
+      GridTree incremental(configs_, spec);
+      incremental.Layout();
+
+      const size_t changed = random.Next(spec.items.size());
+      spec.items[changed].width = random.Next(80);
+      incremental.SetItemSize(changed, spec.items[changed]);
+      incremental.Layout();
+
+      GridTree fresh(configs_, spec);
+      fresh.Layout();
+      incremental.ExpectSameLayout(fresh);
+
+      const auto* cache = incremental.Cache();
+      ASSERT_NE(cache, nullptr);
+      reuse_all_count_ += cache->reuse_all_count();
+      reuse_partial_count_ += cache->reuse_partial_count();
+    }
+  }
+
+  LayoutConfigs configs_;
+  size_t reuse_all_count_ = 0;
+  size_t reuse_partial_count_ = 0;
+};
+
+TEST_F(GridTrackSizingCacheTest, NonSpanningRelayoutMatchesFreshLayout) {
+  RunRelayoutMatchesFreshLayout(false);
+  EXPECT_GT(reuse_all_count_, 0u);
+  EXPECT_GT(reuse_partial_count_, 0u);
+}
+
+TEST_F(GridTrackSizingCacheTest, SpanningRelayoutMatchesFreshLayout) {
+  RunRelayoutMatchesFreshLayout(true);
+  EXPECT_GT(reuse_all_count_, 0u);
+}
+
+TEST_F(GridTrackSizingCacheTest, UnchangedRelayoutReusesAllTracks) {
+  Random random(11);
+  GridTree tree(configs_, MakeGridSpec(random, true));
+  tree.Layout();
+  const size_t reuse_none_count = tree.Cache()->reuse_none_count();
+  tree.Layout();
+  EXPECT_EQ(tree.Cache()->reuse_none_count(), reuse_none_count);
+  EXPECT_GT(tree.Cache()->reuse_all_count(), 0u);
+}
+
+TEST(GridTrackSizingSnapshotTest, CompareFindsDirtyTracks) {
+  GridTrackSizingSnapshot snapshot;
+  snapshot.min_track_sizing_function.assign(3, NLength::MakeAutoNLength());
+  snapshot.max_track_sizing_function.assign(3, NLength::MakeAutoNLength());
+  snapshot.initial_base_size.assign(3, 0.f);
+  snapshot.initial_grow_limit.assign(3, LayoutUnit::Indefinite());
+  snapshot.fit_content_argument_value.assign(3, -1.f);
+  snapshot.item_start_lines = {1, 2, 3, 3};
+  snapshot.item_end_lines = {2, 3, 4, 4};
+  snapshot.item_crosses_flexible_track = {false, false, false, false};
+  snapshot.contributions.assign(
+      4 * GridTrackSizingSnapshot::kContributionCount, 10.f);
+  GridTrackSizingSnapshot current = snapshot;
+
+  GridTrackSizingCache cache;
+  std::vector<size_t> dirty_tracks;
+  EXPECT_EQ(cache.Compare(kHorizontal, current, dirty_tracks),
+            GridTrackSizingCache::Reuse::kNone);
+  cache.Store(kHorizontal, current);
+  EXPECT_EQ(cache.Compare(kHorizontal, snapshot, dirty_tracks),
+            GridTrackSizingCache::Reuse::kAll);
+  // The other dimension has its own snapshot.
+  EXPECT_EQ(cache.Compare(kVertical, snapshot, dirty_tracks),
+            GridTrackSizingCache::Reuse::kNone);
+
+  // The last item sits in the third track.
+  snapshot.contributions.back() = 20.f;
+  EXPECT_EQ(cache.Compare(kHorizontal, snapshot, dirty_tracks),
+            GridTrackSizingCache::Reuse::kPartial);
+  EXPECT_EQ(dirty_tracks, std::vector<size_t>{2});
+
+  // A spanning item needs the full algorithm.
+  snapshot.item_end_lines[0] = 3;
+  cache.Store(kHorizontal, snapshot);
+  current = cache.Last(kHorizontal);
+  current.contributions.front() = 20.f;
+  EXPECT_EQ(cache.Compare(kHorizontal, current, dirty_tracks),
+            GridTrackSizingCache::Reuse::kNone);
+
+  // So does any other change of the inputs.
+  current = cache.Last(kHorizontal);
+  current.gap_size = 4.f;
+  EXPECT_EQ(cache.Compare(kHorizontal, current, dirty_tracks),
+            GridTrackSizingCache::Reuse::kNone);
+}
+
+}  // namespace starlight
+}  // namespace lynx
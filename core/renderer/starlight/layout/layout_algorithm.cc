@@ -15,13 +15,21 @@
 namespace lynx {
 namespace starlight {
 
+namespace {
+
+DirectionSelector MakeDirectionSelector(LayoutObject* container) {
+  return DirectionSelector(
+      container->GetCSSStyle()->IsRow(container->GetLayoutConfigs(),
+                                      container->attr_map()),
+      container->GetCSSStyle()->DirectionIsReverse(
+          container->GetLayoutConfigs(), container->attr_map()),
+      container->GetCSSStyle()->IsAnyRtl());
+}
+
+}  // namespace
+
 LayoutAlgorithm::LayoutAlgorithm(LayoutObject* container)
-    : DirectionSelector(
-          container->GetCSSStyle()->IsRow(container->GetLayoutConfigs(),
-                                          container->attr_map()),
-          container->GetCSSStyle()->DirectionIsReverse(
-              container->GetLayoutConfigs(), container->attr_map()),
-          container->GetCSSStyle()->IsAnyRtl()),
+    : DirectionSelector(MakeDirectionSelector(container)),
       container_(container),
       container_style_(container->GetCSSStyle()) {}
 
@@ -30,6 +38,21 @@ LayoutAlgorithm::~LayoutAlgorithm() {
   container_style_ = nullptr;
 }
 
+void LayoutAlgorithm::Rebind(LayoutObject* container) {
+  static_cast<DirectionSelector&>(*this) = MakeDirectionSelector(container);
+  container_ = container;
+  container_style_ = container->GetCSSStyle();
+}
+
+void LayoutAlgorithm::Recycle() {
+  container_ = nullptr;
+  container_style_ = nullptr;
+  container_constraints_ = Constraints();
+  sticky_items.clear();
+  absolute_or_fixed_items_.clear();
+  inflow_items_.clear();
+}
+
 void LayoutAlgorithm::Update(const Constraints& constraints) {
   UpdateAvailableSizeAndMode(constraints);
   Reset();
@@ -9,6 +9,7 @@
 
 #include "core/renderer/starlight/layout/box_info.h"
 #include "core/renderer/starlight/layout/direction_selector.h"
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
 #include "core/renderer/starlight/layout/layout_object.h"
 #include "core/renderer/starlight/layout/logic_direction_utils.h"
 
@@ -47,6 +48,14 @@ class LayoutAlgorithm : public DirectionSelector {
   const NLength& GapStyle(Dimension dimension) const;
 
  protected:
+  friend class LayoutAlgorithmPool;
+
+  // Binds a recycled algorithm to a new container, see LayoutAlgorithmPool.
+  virtual void Rebind(LayoutObject* container);
+  // Drops the state of the last container but keeps the capacity of the
+  // buffers. Subclasses override it to clear their own state.
+  virtual void Recycle();
+
   virtual void Reset(){};
   void UpdateAvailableSizeAndMode(const Constraints& constraints);
   FloatSize PostLayoutProcessingAndResultBorderBoxSize();
@@ -77,6 +86,8 @@ class LayoutAlgorithm : public DirectionSelector {
  private:
   LayoutAlgorithm();
 
+  LayoutAlgorithmKind pool_kind_ = LayoutAlgorithmKind::kFlex;
+
   // relative
   void HandleRelativePosition();
 
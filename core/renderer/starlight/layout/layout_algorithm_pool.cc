@@ -0,0 +1,92 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "core/renderer/starlight/layout/flex_layout_algorithm.h"
+#include "core/renderer/starlight/layout/grid_layout_algorithm.h"
+#include "core/renderer/starlight/layout/linear_layout_algorithm.h"
+#include "core/renderer/starlight/layout/relative_layout_algorithm.h"
+#include "core/renderer/starlight/layout/staggered_grid_layout_algorithm.h"
+
+namespace lynx {
+namespace starlight {
+
+namespace {
+
+using FreeList = std::vector<std::unique_ptr<LayoutAlgorithm>>;
+
+FreeList& FreeListOf(LayoutAlgorithmKind kind) {
+  static thread_local std::array<
+      FreeList, static_cast<size_t>(LayoutAlgorithmKind::kCount)>
+      free_lists;
+  return free_lists[static_cast<size_t>(kind)];
+}
+
+LayoutAlgorithm* CreateAlgorithm(LayoutAlgorithmKind kind,
+                                 LayoutObject* container) {
+  switch (kind) {
+    case LayoutAlgorithmKind::kFlex:
+      return new FlexLayoutAlgorithm(container);
+    case LayoutAlgorithmKind::kLinear:
+      return new LinearLayoutAlgorithm(container);
+    case LayoutAlgorithmKind::kStaggeredGrid:
+      return new StaggeredGridLayoutAlgorithm(container);
+    case LayoutAlgorithmKind::kRelative:
+      return new RelativeLayoutAlgorithm(container);
+    case LayoutAlgorithmKind::kGrid:
+      return new GridLayoutAlgorithm(container);
+    default:
+      return nullptr;
+  }
+}
+
+}  // namespace
+
+LayoutAlgorithm* LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind kind,
+                                              LayoutObject* container) {
+  auto& free_list = FreeListOf(kind);
+  if (!free_list.empty()) {
+    LayoutAlgorithm* algorithm = free_list.back().release();
+    free_list.pop_back();
+    algorithm->Rebind(container);
+    return algorithm;
+  }
+  LayoutAlgorithm* algorithm = CreateAlgorithm(kind, container);
+  if (algorithm) {
+    algorithm->pool_kind_ = kind;
+  }
+  return algorithm;
+}
+
+void LayoutAlgorithmPool::Release(LayoutAlgorithm* algorithm) {
+  if (!algorithm) {
+    return;
+  }
+  auto& free_list = FreeListOf(algorithm->pool_kind_);
+  if (free_list.size() >= kMaxIdleCountPerKind) {
+    delete algorithm;
+    return;
+  }
+  algorithm->Recycle();
+  free_list.emplace_back(algorithm);
+}
+
+size_t LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind kind) {
+  return FreeListOf(kind).size();
+}
+
+void LayoutAlgorithmPool::Clear() {
+  for (size_t i = 0; i < static_cast<size_t>(LayoutAlgorithmKind::kCount);
+       ++i) {
+    FreeListOf(static_cast<LayoutAlgorithmKind>(i)).clear();
+  }
+}
+
+}  // namespace starlight
+}  // namespace lynx
@@ -0,0 +1,71 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_STARLIGHT_LAYOUT_LAYOUT_ALGORITHM_POOL_H_
+#define CORE_RENDERER_STARLIGHT_LAYOUT_LAYOUT_ALGORITHM_POOL_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace lynx {
+namespace starlight {
+
+class LayoutAlgorithm;
+class LayoutObject;
+
+enum class LayoutAlgorithmKind : uint8_t {
+  kFlex = 0,
+  kLinear,
+  kStaggeredGrid,
+  kRelative,
+  kGrid,
+  kCount,
+};
+
+/*
+ * State an algorithm keeps on its container across layout passes, since the
+ * algorithm itself only lives for one pass. It is owned by the LayoutObject,
+ * see LayoutObject::GetAlgorithmCache.
+ */
+class LayoutAlgorithmCache {
+ public:
+  explicit LayoutAlgorithmCache(LayoutAlgorithmKind kind) : kind_(kind) {}
+  virtual ~LayoutAlgorithmCache() = default;
+
+  LayoutAlgorithmKind kind() const { return kind_; }
+
+ private:
+  const LayoutAlgorithmKind kind_;
+};
+
+/*
+ * Every layout pass creates an algorithm for each container and drops it
+ * again in LayoutObject::RemoveAlgorithmRecursive. Instead of new/delete, the
+ * algorithms are kept in per-thread free lists. A recycled algorithm keeps the
+ * capacity of its scratch buffers (flex line info, item arrays, grid track
+ * sizing buffers), so repeated layouts of a stable tree do not allocate.
+ */
+class LayoutAlgorithmPool {
+ public:
+  // Upper bound of idle algorithms per kind on a thread, which bounds the
+  // memory held after a large tree is gone.
+  static constexpr size_t kMaxIdleCountPerKind = 256;
+
+  // Returns an algorithm of the kind bound to container, recycled if any.
+  static LayoutAlgorithm* Acquire(LayoutAlgorithmKind kind,
+                                  LayoutObject* container);
+  // Takes back an algorithm returned by Acquire.
+  static void Release(LayoutAlgorithm* algorithm);
+
+  // Idle algorithms of the kind on the current thread.
+  static size_t IdleCount(LayoutAlgorithmKind kind);
+  // Deletes all idle algorithms of the current thread.
+  static void Clear();
+};
+
+}  // namespace starlight
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_STARLIGHT_LAYOUT_LAYOUT_ALGORITHM_POOL_H_
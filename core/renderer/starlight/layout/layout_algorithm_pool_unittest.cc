@@ -0,0 +1,91 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
+
+#include <vector>
+
+#include "core/renderer/starlight/layout/layout_algorithm.h"
+#include "core/renderer/starlight/layout/layout_object.h"
+#include "core/renderer/starlight/style/layout_computed_style.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace starlight {
+
+class LayoutAlgorithmPoolTest : public ::testing::Test {
+ protected:
+  void SetUp() override { LayoutAlgorithmPool::Clear(); }
+  void TearDown() override { LayoutAlgorithmPool::Clear(); }
+
+  LayoutConfigs configs_;
+  LayoutComputedStyle style_{1.f};
+};
+
+TEST_F(LayoutAlgorithmPoolTest, RecyclesPerKind) {
+  LayoutObject container(configs_, &style_);
+  LayoutAlgorithm* flex =
+      LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kFlex, &container);
+  ASSERT_NE(flex, nullptr);
+  EXPECT_EQ(flex->GetCSSStyle(), &style_);
+  LayoutAlgorithmPool::Release(flex);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 1u);
+
+  // Another kind does not take the idle flex algorithm.
+  LayoutAlgorithm* grid =
+      LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kGrid, &container);
+  EXPECT_NE(grid, flex);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 1u);
+
+  LayoutComputedStyle other_style(1.f);
+  LayoutObject other(configs_, &other_style);
+  LayoutAlgorithm* recycled =
+      LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kFlex, &other);
+  EXPECT_EQ(recycled, flex);
+  EXPECT_EQ(recycled->GetCSSStyle(), &other_style);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 0u);
+
+  LayoutAlgorithmPool::Release(recycled);
+  LayoutAlgorithmPool::Release(grid);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kGrid), 1u);
+  LayoutAlgorithmPool::Clear();
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 0u);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kGrid), 0u);
+}
+
+TEST_F(LayoutAlgorithmPoolTest, IdleCountIsBounded) {
+  LayoutObject container(configs_, &style_);
+  std::vector<LayoutAlgorithm*> algorithms;
+  for (size_t i = 0; i < LayoutAlgorithmPool::kMaxIdleCountPerKind + 8; ++i) {
+    algorithms.push_back(LayoutAlgorithmPool::Acquire(
+        LayoutAlgorithmKind::kRelative, &container));
+  }
+  for (auto* algorithm : algorithms) {
+    LayoutAlgorithmPool::Release(algorithm);
+  }
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kRelative),
+            LayoutAlgorithmPool::kMaxIdleCountPerKind);
+}
+
+TEST_F(LayoutAlgorithmPoolTest, RelayoutReusesAlgorithms) {
+  LayoutObject root(configs_, &style_);
+  LayoutComputedStyle child_style(1.f);
+  LayoutObject child(configs_, &child_style);
+  root.AppendChild(&child);
+
+  root.ReLayout();
+  const float width = root.GetBorderBoundWidth();
+  const float height = root.GetBorderBoundHeight();
+  // The algorithm of the root goes back to the pool after the pass.
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 1u);
+
+  root.ReLayout();
+  EXPECT_EQ(root.GetBorderBoundWidth(), width);
+  EXPECT_EQ(root.GetBorderBoundHeight(), height);
+  EXPECT_EQ(LayoutAlgorithmPool::IdleCount(LayoutAlgorithmKind::kFlex), 1u);
+  root.RemoveChild(&child);
+}
+
+}  // namespace starlight
+}  // namespace lynx
@@ -7,13 +7,9 @@
 #include <algorithm>
 #include <cmath>
 
-#include "core/renderer/starlight/layout/flex_layout_algorithm.h"
-#include "core/renderer/starlight/layout/grid_layout_algorithm.h"
 #include "core/renderer/starlight/layout/layout_algorithm.h"
-#include "core/renderer/starlight/layout/linear_layout_algorithm.h"
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
 #include "core/renderer/starlight/layout/property_resolving_utils.h"
-#include "core/renderer/starlight/layout/relative_layout_algorithm.h"
-#include "core/renderer/starlight/layout/staggered_grid_layout_algorithm.h"
 #include "core/renderer/starlight/style/default_layout_style.h"
 #include "core/renderer/starlight/style/layout_style_utils.h"
 #include "core/renderer/starlight/types/layout_constraints.h"
@@ -78,9 +74,7 @@ LayoutObject::LayoutObject(const LayoutConfigs& config,
     : configs_(config),
       css_style_(const_cast<starlight::LayoutComputedStyle*>(init_style)) {}
 
-LayoutObject::~LayoutObject() {
-  if (algorithm_) delete algorithm_;
-}
+LayoutObject::~LayoutObject() { LayoutAlgorithmPool::Release(algorithm_); }
 
 void LayoutObject::SetContext(void* context) { context_ = context; }
 void* LayoutObject::GetContext() const { return context_; }
@@ -114,7 +108,7 @@ SLAlignmentFunc LayoutObject::GetSLAlignmentFunc() const {
 
 void LayoutObject::RemoveAlgorithm() {
   if (algorithm_) {
-    delete algorithm_;
+    LayoutAlgorithmPool::Release(algorithm_);
     algorithm_ = nullptr;
   }
 }
@@ -707,21 +701,24 @@ FloatSize LayoutObject::UpdateMeasure(const Constraints& given_constraints,
     }
 
     if (type == DisplayType::kFlex) {
-      algorithm_ = new FlexLayoutAlgorithm(this);
+      algorithm_ =
+          LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kFlex, this);
     } else if (type == DisplayType::kLinear) {
-      if (attr_map_.getColumnCount().has_value()) {
-        algorithm_ = new StaggeredGridLayoutAlgorithm(this);
-      } else {
-        algorithm_ = new LinearLayoutAlgorithm(this);
-      }
+      algorithm_ = LayoutAlgorithmPool::Acquire(
+          attr_map_.getColumnCount().has_value()
+              ? LayoutAlgorithmKind::kStaggeredGrid
+              : LayoutAlgorithmKind::kLinear,
+          this);
     } else if (type == DisplayType::kRelative) {
       // Because of starlight standalone, we can't use FeatureCounter's instance
       // directly, and sent event to layoutcontext instead.
       SendLayoutEvent(LayoutEventType::FeatureCountOnRelativeDisplay);
-      algorithm_ = new RelativeLayoutAlgorithm(this);
+      algorithm_ =
+          LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kRelative, this);
     } else if (type == DisplayType::kGrid) {
       SendLayoutEvent(LayoutEventType::FeatureCountOnGridDisplay);
-      algorithm_ = new GridLayoutAlgorithm(this);
+      algorithm_ =
+          LayoutAlgorithmPool::Acquire(LayoutAlgorithmKind::kGrid, this);
     }
 
     DCHECK(algorithm_);
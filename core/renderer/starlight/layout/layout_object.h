@@ -21,6 +21,7 @@
 #include "core/renderer/starlight/layout/box_info.h"
 #include "core/renderer/starlight/layout/cache_manager.h"
 #include "core/renderer/starlight/layout/container_node.h"
+#include "core/renderer/starlight/layout/layout_algorithm_pool.h"
 #include "core/renderer/starlight/layout/layout_global.h"
 #include "core/renderer/starlight/style/layout_computed_style.h"
 #include "core/renderer/starlight/types/layout_measurefunc.h"
@@ -290,6 +291,17 @@ class LayoutObject : public ContainerNode {
     event_handler_ = handler;
   }
 
+  // Returns the cache of the given algorithm kind, or nullptr if the cache
+  // belongs to another kind, e.g. after the display changed.
+  LayoutAlgorithmCache* GetAlgorithmCache(LayoutAlgorithmKind kind) const {
+    return algorithm_cache_ && algorithm_cache_->kind() == kind
+               ? algorithm_cache_.get()
+               : nullptr;
+  }
+  void SetAlgorithmCache(std::unique_ptr<LayoutAlgorithmCache> cache) {
+    algorithm_cache_ = std::move(cache);
+  }
+
  protected:
   void MarkDirtyWithoutResetCache();
   void MarkHasNewLayout();
@@ -327,6 +339,7 @@ class LayoutObject : public ContainerNode {
 
   void* context_ = nullptr;
   LayoutAlgorithm* algorithm_ = nullptr;
+  std::unique_ptr<LayoutAlgorithmCache> algorithm_cache_;
   LayoutObject* root_node_ = nullptr;
   LayoutEventHandler* event_handler_ = nullptr;
   LayoutComputedStyle* css_style_;
@@ -36,6 +36,16 @@ void LinearLayoutAlgorithm::Reset() {
   baseline_ = 0;
 }
 
+void LinearLayoutAlgorithm::Recycle() {
+  LayoutAlgorithm::Recycle();
+  main_size_.clear();
+  cross_size_.clear();
+  total_main_size_ = 0;
+  total_cross_size_ = 0;
+  remaining_size_ = 0;
+  baseline_ = 0;
+}
+
 void LinearLayoutAlgorithm::SizeDeterminationByAlgorithm() {
   // Algorithm-1
   DetermineItemSize();
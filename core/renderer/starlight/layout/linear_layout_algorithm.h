@@ -30,6 +30,7 @@ class LinearLayoutAlgorithm : public LayoutAlgorithm {
 
  protected:
   void Reset() override;
+  void Recycle() override;
   // Algorithm-1
   void DetermineItemSize();
   // Algorithm-2
@@ -105,6 +105,15 @@ void SortDependencies(const LayoutItems& items,
 RelativeLayoutAlgorithm::RelativeLayoutAlgorithm(LayoutObject* container)
     : LayoutAlgorithm(container) {}
 
+void RelativeLayoutAlgorithm::Recycle() {
+  LayoutAlgorithm::Recycle();
+  proposed_position_.clear();
+  id_map_.clear();
+  horizontal_order_.clear();
+  vertical_order_.clear();
+  layout_results_.clear();
+}
+
 void RelativeLayoutAlgorithm::SizeDeterminationByAlgorithm() {
   ResetMinMaxPosition();
 
@@ -30,6 +30,9 @@ class RelativeLayoutAlgorithm : public LayoutAlgorithm {
   void InitializeAlgorithmEnv() override;
   void SetContainerBaseline() override{};
 
+ protected:
+  void Recycle() override;
+
  private:
   void UpdateChildrenSize();
 
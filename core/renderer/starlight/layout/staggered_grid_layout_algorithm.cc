@@ -13,6 +13,15 @@ namespace starlight {
 StaggeredGridLayoutAlgorithm::StaggeredGridLayoutAlgorithm(
     LayoutObject* container)
     : LinearLayoutAlgorithm(container) {
+  InitializeColumns(container);
+}
+
+void StaggeredGridLayoutAlgorithm::Rebind(LayoutObject* container) {
+  LinearLayoutAlgorithm::Rebind(container);
+  InitializeColumns(container);
+}
+
+void StaggeredGridLayoutAlgorithm::InitializeColumns(LayoutObject* container) {
   auto& attr_map = container->attr_map();
   column_count_ = 1;
   if (attr_map.getColumnCount().has_value()) {
@@ -16,12 +16,14 @@ class StaggeredGridLayoutAlgorithm : public LinearLayoutAlgorithm {
   ~StaggeredGridLayoutAlgorithm() = default;
 
  protected:
+  void Rebind(LayoutObject* container) override;
   void DetermineContainerSize() override;
   void UpdateContainerSize() override;
   void UpdateChildSize(const size_t idx) override;
 
  private:
   bool isHeaderFooter(LayoutObject* item);
+  void InitializeColumns(LayoutObject* container);
 
   int column_count_;
   double cross_axis_gap_;
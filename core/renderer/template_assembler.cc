@@ -62,6 +62,8 @@
 #include "core/services/timing_handler/timing_constants.h"
 #include "core/services/timing_handler/timing_constants_deprecated.h"
 #include "core/shared_data/white_board_tasm_delegate.h"
+#include "core/template_bundle/parsed_style_disk_cache.h"
+#include "core/template_bundle/template_bundle_cache.h"
 #include "core/template_bundle/template_codec/binary_decoder/template_binary_reader.h"
 #include "core/value_wrapper/value_impl_lepus.h"
 
@@ -360,6 +362,8 @@ void TemplateAssembler::DidDecodeTemplate(
   if (component_loader_) {
     component_loader_->SetEnableComponentAsyncDecode(
         page_config_->GetEnableComponentAsyncDecode());
+    component_loader_->SetEnablePreloadDependencies(
+        page_config_->GetEnablePreloadLazyBundleDependencies());
   }
 
   // Ensure that only one page config is set.
@@ -855,7 +859,8 @@ void TemplateAssembler::LoadTemplate(
     const std::string& url, std::vector<uint8_t> source,
     const std::shared_ptr<TemplateData>& template_data,
     std::shared_ptr<PipelineOptions>& pipeline_options,
-    const bool enable_pre_painting, bool enable_recycle_template_bundle) {
+    const bool enable_pre_painting, bool enable_recycle_template_bundle,
+    std::string bundle_digest) {
 #if ENABLE_TESTBENCH_RECORDER
   // test-bench actions
   tasm::recorder::TemplateAssemblerRecorder::RecordLoadTemplate(
@@ -871,11 +876,49 @@ void TemplateAssembler::LoadTemplate(
   if (pre_painting_) {
     page_proxy_.SetPrePaintingStage(PrePaintingStage::kStartPrePainting);
   }
+
+  // Cards loading the same template share one decoded bundle, only the first
+  // one pays for the decoding. The digest is resolved by LynxShell before the
+  // load, an empty digest disables both caches.
+  const bool enable_bundle_cache =
+      !bundle_digest.empty() &&
+      LynxEnv::GetInstance().EnableTemplateBundleCache();
+  const bool enable_style_disk_cache =
+      !bundle_digest.empty() && ParsedStyleDiskCache::Instance().IsEnabled();
+  if (enable_bundle_cache) {
+    auto cached_bundle = TemplateBundleCache::Instance().Find(bundle_digest);
+    if (cached_bundle) {
+      if (enable_recycle_template_bundle) {
+        delegate_.RecycleTemplateBundle(
+            std::make_unique<CachedTemplateBundleRecycler>(*cached_bundle));
+      }
+      LoadTemplateInternal(
+          url, template_data, pipeline_options,
+          [this, template_bundle = std::move(*cached_bundle)](
+              const std::shared_ptr<TemplateEntry>& card_entry) mutable {
+            return card_entry->InitWithTemplateBundle(
+                this, std::move(template_bundle));
+          });
+      ClearCacheData();
+      return;
+    }
+  }
+
+  // Later launches reuse the styles parsed by the first one.
+  std::shared_ptr<const ParsedStyleImage> parsed_style_image;
+  if (enable_style_disk_cache) {
+    parsed_style_image = ParsedStyleDiskCache::Instance().Open(bundle_digest);
+  }
+
   LoadTemplateInternal(
       url, template_data, pipeline_options,
-      [this, source = std::move(source), enable_recycle_template_bundle](
+      [this, source = std::move(source), enable_recycle_template_bundle,
+       bundle_digest = std::move(bundle_digest), enable_bundle_cache,
+       store_parsed_styles = enable_style_disk_cache && !parsed_style_image,
+       parsed_style_image = std::move(parsed_style_image)](
           const std::shared_ptr<TemplateEntry>& card_entry) mutable {
-        if (!FromBinary(card_entry, std::move(source))) {
+        if (!FromBinary(card_entry, std::move(source), true,
+                        std::move(parsed_style_image))) {
           return false;
         }
 
@@ -884,6 +927,17 @@ void TemplateAssembler::LoadTemplate(
               card_entry->GetTemplateBundleRecycler());
         }
 
+        // Both caches complete the decoding of the same recycler, share it.
+        if (store_parsed_styles) {
+          ParsedStyleDiskCache::Instance().StoreAsync(
+              std::move(bundle_digest), card_entry->GetTemplateBundleRecycler(),
+              enable_bundle_cache);
+        } else if (enable_bundle_cache) {
+          TemplateBundleCache::Instance().InsertAsync(
+              std::move(bundle_digest),
+              card_entry->GetTemplateBundleRecycler());
+        }
+
         return true;
       });
   ClearCacheData();
@@ -2227,8 +2281,9 @@ void TemplateAssembler::UpdateDataByJS(
   RunPixelPipeline();
 }
 
-bool TemplateAssembler::FromBinary(const std::shared_ptr<TemplateEntry>& entry,
-                                   std::vector<uint8_t> source, bool is_card) {
+bool TemplateAssembler::FromBinary(
+    const std::shared_ptr<TemplateEntry>& entry, std::vector<uint8_t> source,
+    bool is_card, std::shared_ptr<const ParsedStyleImage> parsed_style_image) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, FROM_BINARY);
 
   auto ReportDecodeError = [this](bool is_card,
@@ -2262,6 +2317,7 @@ bool TemplateAssembler::FromBinary(const std::shared_ptr<TemplateEntry>& entry,
 
   reader->SetIsCardType(is_card);
   reader->SetTemplateUrl(url_.substr(0, url_.find("?")));
+  reader->SetParsedStyleImage(std::move(parsed_style_image));
 
   if (!reader->Decode()) {
     ReportDecodeError(is_card, entry, reader->error_message_);
@@ -19,6 +19,7 @@
 #include "base/include/debug/lynx_assert.h"
 #include "base/include/fml/task_runner.h"
 #include "base/include/log/logging.h"
+#include "core/event/event_type_atom.h"
 #include "core/inspector/observer/inspector_lepus_observer.h"
 #include "core/public/page_options.h"
 #include "core/public/pipeline_option.h"
@@ -263,7 +264,8 @@ class TemplateAssembler final : public TemplateEntryHolder,
                     const std::shared_ptr<TemplateData>& template_data,
                     std::shared_ptr<PipelineOptions>& pipeline_options,
                     const bool enable_pre_painting = false,
-                    bool enable_recycle_template_bundle = false);
+                    bool enable_recycle_template_bundle = false,
+                    std::string bundle_digest = std::string());
 
   void LoadTemplateBundle(const std::string& url,
                           LynxTemplateBundle template_bundle,
@@ -854,8 +856,10 @@ class TemplateAssembler final : public TemplateEntryHolder,
                                       const std::string& res_id,
                                       const std::string& theme_key,
                                       bool isFinalFallback);
-  bool FromBinary(const std::shared_ptr<TemplateEntry>& entry,
-                  std::vector<uint8_t> source, bool is_card = true);
+  bool FromBinary(
+      const std::shared_ptr<TemplateEntry>& entry, std::vector<uint8_t> source,
+      bool is_card = true,
+      std::shared_ptr<const ParsedStyleImage> parsed_style_image = nullptr);
 
   bool UpdateGlobalDataInternal(
       const lepus_value& value, const UpdatePageOption& update_page_option,
@@ -923,6 +927,9 @@ class TemplateAssembler final : public TemplateEntryHolder,
 
   bool default_use_lepus_ng_ = false;
 
+  // Declared before page_proxy_ so event atoms outlive the page elements.
+  event::EventTypeAtomTable::Scope event_type_atom_scope_;
+
   PageProxy page_proxy_;
 
   static thread_local TemplateAssembler* curr_;
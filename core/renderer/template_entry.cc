@@ -341,6 +341,7 @@ TemplateEntry::~TemplateEntry() {
   DetachNapiEnvironment();
   template_bundle_.css_style_manager_->SetThreadStopFlag(true);
   template_bundle_.lepus_chunk_manager_->SetThreadStopFlag(true);
+  template_bundle_.ClearElementTemplatePrototypes();
 #if ENABLE_TRACE_PERFETTO
   if (vm_context_ && vm_context_->IsLepusNGContext()) {
     auto context = std::static_pointer_cast<lepus::QuickContext>(vm_context_);
@@ -385,8 +386,9 @@ lepus::Value TemplateEntry::ElementFromBinary(const std::string& key,
   }
 
   auto& info = GetElementTemplateInfo(key);
-  return TreeResolver::InitElementTree(TreeResolver::FromTemplateInfo(info),
-                                       pid, manager, GetStyleSheetManager());
+  return TreeResolver::InitElementTree(
+      template_bundle_.InstantiateElementTemplate(key, info), pid, manager,
+      GetStyleSheetManager());
 }
 
 const ElementTemplateInfo& TemplateEntry::GetElementTemplateInfo(
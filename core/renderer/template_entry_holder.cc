@@ -4,6 +4,7 @@
 
 #include "core/renderer/template_entry_holder.h"
 
+#include <algorithm>
 #include <utility>
 
 #include "base/include/debug/lynx_assert.h"
@@ -58,7 +59,28 @@ void TemplateEntryHolder::InsertLynxTemplateBundle(
    */
   if (template_entries_.find(url) == template_entries_.end()) {
     TryPostJSBundle(url, bundle);
-    preload_template_bundles_.try_emplace(url, std::move(bundle));
+    const size_t size = bundle.EstimateDecodedFootprint();
+    if (preload_template_bundles_.try_emplace(url, std::move(bundle)).second) {
+      preload_template_bundle_urls_.emplace_back(url, size);
+      preload_template_bundles_size_ += size;
+      TrimPreloadTemplateBundles();
+    }
+  }
+}
+
+void TemplateEntryHolder::SetPreloadTemplateBundlesBudget(size_t budget) {
+  preload_template_bundles_budget_ = budget;
+  TrimPreloadTemplateBundles();
+}
+
+void TemplateEntryHolder::TrimPreloadTemplateBundles() {
+  while (preload_template_bundles_size_ > preload_template_bundles_budget_ &&
+         preload_template_bundle_urls_.size() > 1) {
+    auto [url, size] = std::move(preload_template_bundle_urls_.front());
+    preload_template_bundle_urls_.pop_front();
+    LOGI("Drop preloaded lazy bundle over budget: " << url);
+    preload_template_bundles_size_ -= size;
+    preload_template_bundles_.erase(url);
   }
 }
 
@@ -76,6 +98,14 @@ std::optional<LynxTemplateBundle> TemplateEntryHolder::GetPreloadTemplateBundle(
   std::optional<LynxTemplateBundle> bundle = std::nullopt;
   auto iter = preload_template_bundles_.find(name);
   if (iter != preload_template_bundles_.end()) {
+    auto url_iter = std::find_if(
+        preload_template_bundle_urls_.begin(),
+        preload_template_bundle_urls_.end(),
+        [&name](const auto& entry) { return entry.first == name; });
+    if (url_iter != preload_template_bundle_urls_.end()) {
+      preload_template_bundles_size_ -= url_iter->second;
+      preload_template_bundle_urls_.erase(url_iter);
+    }
     bundle = std::move(iter->second);
     preload_template_bundles_.erase(iter);
   }
@@ -6,11 +6,13 @@
 #define CORE_RENDERER_TEMPLATE_ENTRY_HOLDER_H_
 
 #include <atomic>
+#include <list>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <utility>
 
 #include "base/include/closure.h"
 #include "core/renderer/js_bundle_holder_impl.h"
@@ -44,6 +46,15 @@ class TemplateEntryHolder {
   void InsertLynxTemplateBundle(const std::string& url,
                                 LynxTemplateBundle&& bundle);
 
+  /**
+   * Preloaded bundles are kept up to budget bytes of their estimated decoded
+   * footprint, the least recently preloaded ones are dropped first and loaded
+   * again if required. The most recently preloaded bundle is always kept.
+   */
+  static constexpr size_t kDefaultPreloadTemplateBundlesBudget =
+      32 * 1024 * 1024;
+  void SetPreloadTemplateBundlesBudget(size_t budget);
+
   std::shared_ptr<piper::JsBundleHolder> GetJsBundleHolder() const;
 
  protected:
@@ -64,12 +75,18 @@ class TemplateEntryHolder {
  private:
   void TryPostJSBundle(const std::string& url,
                        const LynxTemplateBundle& bundle);
+  void TrimPreloadTemplateBundles();
 
   std::unordered_map<std::string, std::shared_ptr<TemplateEntry>>
       template_entries_;
 
   // template bundles for preloading lazy bundle
   std::unordered_map<std::string, LynxTemplateBundle> preload_template_bundles_;
+  // urls of preload_template_bundles_ with their footprint, the least
+  // recently preloaded first
+  std::list<std::pair<std::string, size_t>> preload_template_bundle_urls_;
+  size_t preload_template_bundles_size_{0};
+  size_t preload_template_bundles_budget_{kDefaultPreloadTemplateBundlesBudget};
 
   const std::shared_ptr<JsBundleHolderImpl> js_bundle_holder_{
       std::make_shared<JsBundleHolderImpl>()};
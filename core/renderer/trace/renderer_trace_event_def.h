@@ -285,6 +285,10 @@ inline constexpr const char* const
         "DynamicCSSStylesManager::UpdateWithResolvingStatus";
 inline constexpr const char* const SHARED_FRAGMENT_INIT_PSEUDO_NOT_STYLE =
     "SharedCSSFragment::InitPseudoNotStyle";
+inline constexpr const char* const SHARED_FRAGMENT_IMPORT_LAYERS =
+    "SharedCSSFragment::ImportFragmentLayers";
+inline constexpr const char* const SHARED_FRAGMENT_MERGE_LAYERS =
+    "SharedCSSFragment::MergeLayers";
 inline constexpr const char* const UNIT_HANDLER_PROCESS =
     "UnitHandler::Process";
 inline constexpr const char* const CSS_PATCH_RESOLVE_STYLE =
@@ -323,6 +327,21 @@ inline constexpr const char* const ELEMENT_MANAGER_ON_PATCH_FINISH_FOR_FIBER =
 inline constexpr const char* const
     ELEMENT_MANAGER_ON_PATCH_FINISH_FIBER_NO_PATCH =
         "ElementManager::OnPatchFinishForFiberNoPatch";
+inline constexpr const char* const ELEMENT_MANAGER_APPLY_STYLE_INVALIDATIONS =
+    "ElementManager::ApplyPendingStyleInvalidations";
+/**
+ * @trace_description: Number of elements marked dirty by the pending style
+ * invalidation sets before a flush.
+ */
+inline constexpr const char* const
+    ELEMENT_MANAGER_INVALIDATED_ELEMENTS_COUNTER =
+        "StyleInvalidation::InvalidatedElements";
+/**
+ * @trace_description: Number of elements whose style got recalculated in a
+ * flush.
+ */
+inline constexpr const char* const ELEMENT_MANAGER_RESTYLED_ELEMENTS_COUNTER =
+    "StyleInvalidation::RestyledElements";
 inline constexpr const char* const ELEMENT_MANAGER_UPDATE_VIEWPORT =
     "ElementManager::UpdateViewport";
 inline constexpr const char* const ELEMENT_MANAGER_TICK_ALL_ELEMENT =
@@ -619,6 +638,10 @@ inline constexpr const char* const TREE_RESOLVER_ATTACH_TO_ELEMENT_MANAGER =
     "TreeResolver::AttachRootToElementManager";
 inline constexpr const char* const TREE_RESOLVER_FROM_ELEMENT_INFO =
     "TreeResolver::FromElementInfo";
+inline constexpr const char* const ELEMENT_TEMPLATE_PROTOTYPE_INSTANTIATE =
+    "ElementTemplatePrototypeCache::Instantiate";
+inline constexpr const char* const ELEMENT_TEMPLATE_PROTOTYPE_BUILD =
+    "ElementTemplatePrototypeCache::BuildPrototype";
 inline constexpr const char* const FIBER_ELEMENT_SELECTOR_SELECT =
     "FiberElementSelector::Select";
 
@@ -650,6 +673,13 @@ inline constexpr const char* const RADON_COMPONENT_RENDER_BASE =
     "RadonComponent::OnReactComponentRenderBase";
 inline constexpr const char* const RADON_COMPONENT_DIFF_CHILDREN =
     "RadonComponent::RadonDiffChildren";
+/**
+ * @trace_description: Number of components whose props were matched by
+ * reference instead of by a deep comparison, see the enableComponentMemo page
+ * config.
+ */
+inline constexpr const char* const RADON_COMPONENT_MEMOIZED_PROPS_COUNTER =
+    "RadonComponent::MemoizedProps";
 inline constexpr const char* const RADON_CREATE_ELEMENT_IF_NEEDED =
     "RadonNode::CreateElementIfNeeded";
 inline constexpr const char* const RADON_DISPATCH_FIRST_TIME =
@@ -901,6 +931,9 @@ inline constexpr const char* const
         "HandleLayoutOrScrollResult";
 inline constexpr const char* const LINEAR_LAYOUT_MANAGER_PRELOAD_SECTION =
     "LinearLayoutManager::PreloadSectionOnNextFrame";
+inline constexpr const char* const
+    LINEAR_LAYOUT_MANAGER_PREFETCH_ON_NEXT_FRAME =
+        "LinearLayoutManager::PrefetchOnNextFrame";
 inline constexpr const char* const LINEAR_LAYOUT_MANAGER_FILL_ANCHOR_EXTRA =
     "LinearLayoutManager::FillWithAnchor.FillExtra";
 inline constexpr const char* const LINEAR_LAYOUT_MANAGER_FILL_ANCHOR_START =
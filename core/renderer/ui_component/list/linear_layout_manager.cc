@@ -5,6 +5,7 @@
 #include "core/renderer/ui_component/list/linear_layout_manager.h"
 
 #include <algorithm>
+#include <chrono>
 #include <unordered_set>
 #include <vector>
 
@@ -242,6 +243,133 @@ void LinearLayoutManager::PreloadSection() {
   }
 }
 
+void LinearLayoutManager::CancelPrefetch() {
+  prefetch_next_index_ = list::kInvalidIndex;
+  prefetch_target_index_ = list::kInvalidIndex;
+}
+
+void LinearLayoutManager::SchedulePrefetch() {
+  CancelPrefetch();
+  if (!prefetch_predictor_.enabled() ||
+      list_container_->enable_batch_render()) {
+    return;
+  }
+  const auto& on_screen_children = list_children_helper_->on_screen_children();
+  if (on_screen_children.empty()) {
+    return;
+  }
+  const auto* first_visible_item_holder = *(on_screen_children.cbegin());
+  const auto* last_visible_item_holder = *(on_screen_children.crbegin());
+  if (!first_visible_item_holder || !last_visible_item_holder) {
+    return;
+  }
+  int first_visible_index = first_visible_item_holder->index();
+  int last_visible_index = last_visible_item_holder->index();
+  prefetch_predictor_.OnVisibleRangeChanged(first_visible_index,
+                                            last_visible_index);
+  // Keep the prefetched items which may still be reached by this scroll.
+  const int max_prefetch_count = prefetch_predictor_.max_prefetch_count();
+  prefetch_predictor_.ReleaseOutside(first_visible_index - max_prefetch_count,
+                                     last_visible_index + max_prefetch_count);
+  float average_item_size =
+      (list_orientation_helper_->GetDecoratedEnd(last_visible_item_holder) -
+       list_orientation_helper_->GetDecoratedStart(first_visible_item_holder)) /
+      (last_visible_index - first_visible_index + 1);
+  int from = list::kInvalidIndex, to = list::kInvalidIndex;
+  if (!prefetch_predictor_.Predict(first_visible_index, last_visible_index,
+                                   list_container_->GetDataCount(),
+                                   average_item_size, from, to)) {
+    return;
+  }
+  if (prefetch_predictor_.towards_end()) {
+    prefetch_direction_ = list::LayoutDirection::kLayoutToEnd;
+    prefetch_next_index_ = from;
+    prefetch_target_index_ = to;
+  } else {
+    prefetch_direction_ = list::LayoutDirection::kLayoutToStart;
+    prefetch_next_index_ = to;
+    prefetch_target_index_ = from;
+  }
+  list_container_->element()->RequestNextFrame();
+}
+
+/**
+ * @description: Render the pending prefetch items chunk by chunk until the
+ * frame budget runs out, and request another frame for the rest. The chunks
+ * are laid out next to the item before them in the prefetch direction, like
+ * the preload buffer.
+ */
+void LinearLayoutManager::PrefetchOnNextFrame() {
+  if (prefetch_next_index_ == list::kInvalidIndex || !list_container_ ||
+      !list_children_helper_ || !list_orientation_helper_) {
+    return;
+  }
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, LINEAR_LAYOUT_MANAGER_PREFETCH_ON_NEXT_FRAME,
+              "info",
+              base::FormatString("[%d -> %d]", prefetch_next_index_,
+                                 prefetch_target_index_));
+  const bool to_end =
+      prefetch_direction_ == list::LayoutDirection::kLayoutToEnd;
+  ItemHolder* neighbour_item_holder = list_container_->GetItemHolderForIndex(
+      prefetch_next_index_ - static_cast<int32_t>(prefetch_direction_));
+  if (!neighbour_item_holder) {
+    prefetch_next_index_ = list::kInvalidIndex;
+    return;
+  }
+  const auto deadline =
+      std::chrono::steady_clock::now() +
+      std::chrono::milliseconds(list::kPrefetchBudgetPerFrameMs);
+  list_container_->StartInterceptListElementUpdated();
+  LayoutState layout_state;
+  layout_state.latest_updated_content_offset_ = content_offset_;
+  UpdateLayoutStateToFillPreloadBuffer(
+      layout_state, prefetch_next_index_,
+      to_end
+          ? list_orientation_helper_->GetDecoratedEnd(neighbour_item_holder)
+          : list_orientation_helper_->GetDecoratedStart(neighbour_item_holder),
+      prefetch_direction_);
+  while (HasMore(layout_state, prefetch_target_index_) &&
+         std::chrono::steady_clock::now() < deadline) {
+    // Render one chunk at a time to check the budget in between.
+    const int chunk_index = layout_state.next_bind_index_;
+    PreloadInternal(layout_state, chunk_index);
+    if (layout_state.next_bind_index_ == chunk_index) {
+      break;
+    }
+    for (int i = chunk_index; i != layout_state.next_bind_index_;
+         i += static_cast<int32_t>(prefetch_direction_)) {
+      prefetch_predictor_.MarkPrefetched(i);
+    }
+  }
+  prefetch_next_index_ = HasMore(layout_state, prefetch_target_index_)
+                             ? layout_state.next_bind_index_
+                             : list::kInvalidIndex;
+
+  // Prefetched items may change the content size and the offset of the items
+  // behind them, keep the visible items in place.
+  list_children_helper_->UpdateOnScreenChildren(list_orientation_helper_.get(),
+                                                content_offset_);
+  ListAnchorManager::AnchorInfo anchor_info;
+  UpdateScrollAnchorInfo(anchor_info,
+                         list_children_helper_->on_screen_children(),
+                         content_offset_);
+  LayoutInvalidItemHolder(0);
+  content_size_ = GetTargetContentSize();
+  if (anchor_info.valid_) {
+    list_anchor_manager_->AdjustContentOffsetWithAnchor(anchor_info,
+                                                        content_offset_);
+  }
+  FlushContentSizeAndOffsetToPlatform(
+      layout_state.latest_updated_content_offset_, false);
+  list_children_helper_->UpdateOnScreenChildren(list_orientation_helper_.get(),
+                                                content_offset_);
+  HandleLayoutOrScrollResult(layout_state, false);
+  list_container_->StopInterceptListElementUpdated();
+  if (prefetch_next_index_ != list::kInvalidIndex) {
+    list_container_->element()->RequestNextFrame();
+  }
+}
+
 /**
  * @description: The main linear layout fill steps are as follows:
  *
@@ -423,6 +551,9 @@ void LinearLayoutManager::RecycleOffPreloadItemHolders(bool recycle_to_end,
         [this, target_index, recycle_to_end](ItemHolder* item_holder) {
           if (item_holder) {
             int index = item_holder->index();
+            if (prefetch_predictor_.IsPrefetched(index)) {
+              return false;
+            }
             if (recycle_to_end && index > target_index &&
                 ShouldRecycleStickyItemHolder(item_holder)) {
               list_container_->list_adapter()->RecycleItemHolder(item_holder);
@@ -532,6 +663,9 @@ void LinearLayoutManager::ScrollByInternal(float content_offset,
   list_children_helper_->UpdateOnScreenChildren(list_orientation_helper_.get(),
                                                 content_offset_);
   HandlePreloadIfNeeded(layout_state, anchor_info, false);
+  if (from_platform) {
+    SchedulePrefetch();
+  }
   TRACE_EVENT_END(LYNX_TRACE_CATEGORY);
 
   // step 5. Handle scroll result.
@@ -76,6 +76,8 @@ class LinearLayoutManager : public ListLayoutManager {
   void OnBatchLayoutChildren() override;
   void OnLayoutChildren(bool is_component_finished = false,
                         int component_index = -1) override;
+  void PrefetchOnNextFrame() override;
+  void CancelPrefetch() override;
 
  protected:
   void ScrollByInternal(float content_offset, float original_offset,
@@ -133,6 +135,16 @@ class LinearLayoutManager : public ListLayoutManager {
   void RecycleOffPreloadItemHolders(bool recycle_to_end, int target_index);
   void PreloadSectionOnNextFrame();
   void PreloadSection(LayoutState& layout_state);
+  // Predict the items shown next after a platform scroll and request a frame
+  // to prefetch them.
+  void SchedulePrefetch();
+
+  // The pending prefetch range, from the next index to render to the target
+  // index in the prefetch direction.
+  int prefetch_next_index_{list::kInvalidIndex};
+  int prefetch_target_index_{list::kInvalidIndex};
+  list::LayoutDirection prefetch_direction_{
+      list::LayoutDirection::kLayoutToEnd};
 };
 
 }  // namespace tasm
@@ -112,6 +112,7 @@ float ListContainerImpl::RoundValueToPixelGrid(const float value) {
 void ListContainerImpl::OnNextFrame() {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, LIST_CONTAINER_ON_NEXT_FRAME);
   list_layout_manager_->PreloadSection();
+  list_layout_manager_->PrefetchOnNextFrame();
 }
 
 void ListContainerImpl::OnListItemLayoutUpdated(Element* component) {
@@ -252,6 +253,7 @@ void ListContainerImpl::UpdateListLayoutManager(list::LayoutType layout_type) {
   float main_axis_gap = list_layout_manager_->main_axis_gap();
   float cross_axis_gap = list_layout_manager_->cross_axis_gap();
   float preload_buffer_count = list_layout_manager_->preload_buffer_count();
+  int prefetch_item_count = list_layout_manager_->prefetch_item_count();
   float content_size = list_layout_manager_->content_size();
   int initial_scroll_index = list_layout_manager_->GetInitialScrollIndex();
   list::InitialScrollIndexStatus initial_scroll_status =
@@ -277,6 +279,7 @@ void ListContainerImpl::UpdateListLayoutManager(list::LayoutType layout_type) {
                                                          content_size);
   list_layout_manager_->SetPreloadBufferCount(preload_buffer_count);
   list_layout_manager_->SetEnablePreloadSection(enable_preload_section_);
+  list_layout_manager_->SetPrefetchItemCount(prefetch_item_count);
   list_adapter_->OnDataSetChanged();
   need_recycle_all_item_holders_before_layout_ = true;
 }
@@ -444,6 +447,11 @@ bool ListContainerImpl::ResolveAttribute(const base::String& key,
     should_mark_layout_dirty = list_layout_manager_->SetPreloadBufferCount(
         static_cast<int>(value.Number()));
     should_set_props = false;
+  } else if (key.IsEqual(list::kExperimentalPrefetchItemCount)) {
+    // experimental-prefetch-item-count
+    list_layout_manager_->SetPrefetchItemCount(
+        static_cast<int>(value.Number()));
+    should_set_props = false;
   } else if (key.IsEqual(list::kExperimentalBatchRenderStrategy)) {
     // If parse experimental-batch-render-strategy in list property, we should
     // block flush this property to platform because before parsing all
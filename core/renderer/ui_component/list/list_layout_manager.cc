@@ -4,6 +4,7 @@
 
 #include "core/renderer/ui_component/list/list_layout_manager.h"
 
+#include <chrono>
 #include <vector>
 
 #include "base/include/log/logging.h"
@@ -129,6 +130,38 @@ void ListLayoutManager::SendAnchorDebugInfo(
   }
 }
 
+// Report how many of the items shown while scrolling had been prefetched.
+void ListLayoutManager::SendPrefetchDebugInfo() {
+  const ListPrefetchPredictor::Stats& stats = prefetch_predictor_.stats();
+  NLIST_LOGI("[list_container="
+             << list_container_ << "] prefetch: prefetched = "
+             << stats.prefetched_count << ", hit = " << stats.hit_count
+             << ", miss = " << stats.miss_count
+             << ", wasted = " << stats.wasted_count
+             << ", hit_rate = " << stats.HitRate());
+  if (list_container_->ShouldGenerateDebugInfo(
+          list::ListDebugInfoLevel::kListDebugInfoLevelInfo)) {
+    auto detail = lepus::Dictionary::Create();
+    auto prefetch_info_map = lepus::Dictionary::Create();
+    BASE_STATIC_STRING_DECL(kPrefetched, "prefetched");
+    BASE_STATIC_STRING_DECL(kHit, "hit");
+    BASE_STATIC_STRING_DECL(kMiss, "miss");
+    BASE_STATIC_STRING_DECL(kWasted, "wasted");
+    BASE_STATIC_STRING_DECL(kHitRate, "hit_rate");
+    BASE_STATIC_STRING_DECL(kPrefetchInfo, "prefetch_info");
+    prefetch_info_map->SetValue(kPrefetched, stats.prefetched_count);
+    prefetch_info_map->SetValue(kHit, stats.hit_count);
+    prefetch_info_map->SetValue(kMiss, stats.miss_count);
+    prefetch_info_map->SetValue(kWasted, stats.wasted_count);
+    prefetch_info_map->SetValue(kHitRate, stats.HitRate());
+    auto detail_info = lepus::Dictionary::Create();
+    detail_info->SetValue(kPrefetchInfo, prefetch_info_map);
+    detail->SetValue(BASE_STATIC_STRING(list::kListDebugInfoLevelInfo),
+                     detail_info);
+    list_container_->SendDebugEvent(detail);
+  }
+}
+
 void ListLayoutManager::InitLayoutAndAnchor(
     ListAnchorManager::AnchorInfo& anchor_info, int finishing_binding_index) {
   TRACE_EVENT_BEGIN(LYNX_TRACE_CATEGORY,
@@ -186,6 +219,14 @@ void ListLayoutManager::ScrollByPlatformContainer(float content_offset_x,
                                                   float content_offset_y,
                                                   float original_x,
                                                   float original_y) {
+  if (prefetch_predictor_.enabled()) {
+    prefetch_predictor_.OnScroll(
+        orientation_ == list::Orientation::kHorizontal ? content_offset_x
+                                                       : content_offset_y,
+        std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+  }
   ScrollByInternal(
       orientation_ == list::Orientation::kHorizontal ? content_offset_x
                                                      : content_offset_y,
@@ -235,6 +276,11 @@ void ListLayoutManager::ScrollToPosition(int index, float offset, int align,
 void ListLayoutManager::ScrollStopped() {
   NLIST_LOGI("[list_container=" << list_container_ << "] ScrollStopped");
   list_anchor_manager_->ResetScrollInfo();
+  CancelPrefetch();
+  if (prefetch_predictor_.enabled()) {
+    prefetch_predictor_.OnScrollStopped();
+    SendPrefetchDebugInfo();
+  }
 }
 
 // Determine whether the current ItemHolder needs to be recycled.
@@ -265,7 +311,8 @@ void ListLayoutManager::RecycleOffScreenItemHolders() {
       list_children_helper_->attached_children(),
       [this, &off_screen_item_holders](ItemHolder* item_holder) {
         if (item_holder && ShouldRecycleItemHolder(item_holder) &&
-            ShouldRecycleStickyItemHolder(item_holder)) {
+            ShouldRecycleStickyItemHolder(item_holder) &&
+            !prefetch_predictor_.IsPrefetched(item_holder->index())) {
           off_screen_item_holders.push_back(item_holder);
         }
         return false;
@@ -329,6 +376,9 @@ void ListLayoutManager::OnPrepareForLayoutChildren() {
   TRACE_EVENT(LYNX_TRACE_CATEGORY,
               LIST_LAYOUT_MANAGER_PREPARE_FOR_LAYOUT_CHILDREN);
   list_container_->RecordVisibleItemIfNeeded(true);
+  // The indexes of the prefetched items may be changed by the diff.
+  prefetch_predictor_.Reset();
+  CancelPrefetch();
 }
 
 void ListLayoutManager::SendLayoutCompleteEvent() {
@@ -12,6 +12,7 @@
 #include "core/renderer/ui_component/list/list_anchor_manager.h"
 #include "core/renderer/ui_component/list/list_children_helper.h"
 #include "core/renderer/ui_component/list/list_orientation_helper.h"
+#include "core/renderer/ui_component/list/list_prefetch_predictor.h"
 
 namespace lynx {
 namespace tasm {
@@ -31,6 +32,11 @@ class ListLayoutManager {
     SetListAnchorManager(list_children_helper_);
   }
   virtual void PreloadSection() {}
+  // Render and layout the items predicted to be shown next, within the budget
+  // of one frame. Invoked on the next frame after a scroll scheduled them.
+  virtual void PrefetchOnNextFrame() {}
+  // Drop the pending prefetch range scheduled by the last scroll.
+  virtual void CancelPrefetch() {}
   // Init layout state.
   virtual void InitLayoutState() {}
   // Render and layout child nodes. This function will be invoked within
@@ -105,6 +111,12 @@ class ListLayoutManager {
     return count_changed;
   }
   void SetEnablePreloadSection(bool value) { enable_preload_section_ = value; }
+  void SetPrefetchItemCount(int count) {
+    prefetch_predictor_.SetMaxPrefetchCount(count);
+  }
+  int prefetch_item_count() const {
+    return prefetch_predictor_.max_prefetch_count();
+  }
   int preload_buffer_count() const { return preload_buffer_count_; }
   void SetSpanCount(int span_count);
   int span_count() const { return span_count_; }
@@ -164,6 +176,7 @@ class ListLayoutManager {
   }
   void OnPrepareForLayoutChildren();
   void SendAnchorDebugInfo(ListAnchorManager::AnchorInfo& anchor_info);
+  void SendPrefetchDebugInfo();
   void HandleLayoutOrScrollResult(bool is_layout);
 #if ENABLE_TRACE_PERFETTO
   virtual void UpdateTraceDebugInfo(TraceEvent* event) const;
@@ -191,6 +204,7 @@ class ListLayoutManager {
   ListContainerImpl* list_container_{nullptr};
   ListChildrenHelper* list_children_helper_{nullptr};
   bool enable_preload_section_{false};
+  ListPrefetchPredictor prefetch_predictor_;
 };
 
 }  // namespace tasm
@@ -0,0 +1,111 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/ui_component/list/list_prefetch_predictor.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace lynx {
+namespace tasm {
+
+void ListPrefetchPredictor::SetMaxPrefetchCount(int count) {
+  max_prefetch_count_ = std::max(count, 0);
+  if (max_prefetch_count_ == 0) {
+    Reset();
+  }
+}
+
+void ListPrefetchPredictor::OnScroll(float content_offset, int64_t time_ms) {
+  if (last_time_ms_ < 0) {
+    last_offset_ = content_offset;
+    last_time_ms_ = time_ms;
+    return;
+  }
+  const int64_t interval_ms = time_ms - last_time_ms_;
+  if (interval_ms <= 0) {
+    // Several scrolls in the same ms, wait for the next one to measure.
+    return;
+  }
+  const float sample = (content_offset - last_offset_) / interval_ms;
+  if (interval_ms > kMaxSampleIntervalMs) {
+    velocity_ = sample;
+  } else {
+    velocity_ =
+        kVelocitySmoothing * sample + (1.f - kVelocitySmoothing) * velocity_;
+  }
+  last_offset_ = content_offset;
+  last_time_ms_ = time_ms;
+}
+
+void ListPrefetchPredictor::OnScrollStopped() {
+  velocity_ = 0.f;
+  last_time_ms_ = -1;
+}
+
+bool ListPrefetchPredictor::Predict(int first_visible, int last_visible,
+                                    int data_count, float average_item_size,
+                                    int& from, int& to) const {
+  if (!enabled() || std::fabs(velocity_) < kMinVelocity || first_visible < 0 ||
+      last_visible < first_visible || last_visible >= data_count) {
+    return false;
+  }
+  const float distance = std::fabs(velocity_) * kLookAheadMs;
+  const int count = std::min(
+      max_prefetch_count_,
+      static_cast<int>(std::ceil(distance / std::max(average_item_size, 1.f))));
+  if (towards_end()) {
+    from = last_visible + 1;
+    to = std::min(last_visible + count, data_count - 1);
+  } else {
+    from = std::max(first_visible - count, 0);
+    to = first_visible - 1;
+  }
+  return count > 0 && from <= to;
+}
+
+void ListPrefetchPredictor::MarkPrefetched(int index) {
+  if (prefetched_indexes_.insert(index).second) {
+    ++stats_.prefetched_count;
+  }
+}
+
+void ListPrefetchPredictor::ReleaseOutside(int from, int to) {
+  for (auto it = prefetched_indexes_.begin();
+       it != prefetched_indexes_.end();) {
+    if (*it < from || *it > to) {
+      ++stats_.wasted_count;
+      it = prefetched_indexes_.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+void ListPrefetchPredictor::Reset() {
+  prefetched_indexes_.clear();
+  first_visible_ = -1;
+  last_visible_ = -1;
+}
+
+void ListPrefetchPredictor::OnVisibleRangeChanged(int first_visible,
+                                                  int last_visible) {
+  if (first_visible_ >= 0 && first_visible >= 0) {
+    for (int index = first_visible; index <= last_visible; ++index) {
+      if (index >= first_visible_ && index <= last_visible_) {
+        continue;
+      }
+      if (prefetched_indexes_.erase(index) != 0) {
+        ++stats_.hit_count;
+      } else {
+        ++stats_.miss_count;
+      }
+    }
+  }
+  first_visible_ = first_visible;
+  last_visible_ = last_visible;
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,96 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_RENDERER_UI_COMPONENT_LIST_LIST_PREFETCH_PREDICTOR_H_
+#define CORE_RENDERER_UI_COMPONENT_LIST_LIST_PREFETCH_PREDICTOR_H_
+
+#include <cstdint>
+#include <unordered_set>
+
+namespace lynx {
+namespace tasm {
+
+// Predicts which items a scrolling list is about to show from the velocity of
+// the platform scroll events, and keeps track of the items prefetched for
+// them. The prediction only covers the items in front of the visible range in
+// the scroll direction, and grows with the velocity up to the max prefetch
+// count.
+class ListPrefetchPredictor {
+ public:
+  struct Stats {
+    // Items built ahead of time.
+    int prefetched_count{0};
+    // Items shown while scrolling which had been prefetched.
+    int hit_count{0};
+    // Items shown while scrolling which had not been prefetched, i.e. built
+    // on the frame they are shown.
+    int miss_count{0};
+    // Prefetched items dropped before being shown.
+    int wasted_count{0};
+
+    float HitRate() const {
+      const int shown_count = hit_count + miss_count;
+      return shown_count > 0 ? static_cast<float>(hit_count) / shown_count
+                             : 0.f;
+    }
+  };
+
+  // How far ahead of the visible items the prediction looks, in ms.
+  static constexpr float kLookAheadMs = 300.f;
+  // Samples further apart do not describe the same gesture, in ms.
+  static constexpr int64_t kMaxSampleIntervalMs = 100;
+  // Weight of the latest sample in the smoothed velocity.
+  static constexpr float kVelocitySmoothing = 0.5f;
+  // Below this velocity the list is considered settled, in px per ms.
+  static constexpr float kMinVelocity = 0.05f;
+
+  void SetMaxPrefetchCount(int count);
+  int max_prefetch_count() const { return max_prefetch_count_; }
+  bool enabled() const { return max_prefetch_count_ > 0; }
+
+  // Feeds a platform scroll to the main axis content offset at time_ms.
+  void OnScroll(float content_offset, int64_t time_ms);
+  void OnScrollStopped();
+  // Smoothed velocity in px per ms, positive towards the end of the list.
+  float velocity() const { return velocity_; }
+  bool towards_end() const { return velocity_ > 0.f; }
+
+  // Predicts the items next to [first_visible, last_visible] in the scroll
+  // direction which are shown within the look-ahead time. Returns false if
+  // the list is settled or no such items exist.
+  bool Predict(int first_visible, int last_visible, int data_count,
+               float average_item_size, int& from, int& to) const;
+
+  void MarkPrefetched(int index);
+  bool IsPrefetched(int index) const {
+    return prefetched_indexes_.count(index) != 0;
+  }
+  bool HasPrefetchedItems() const { return !prefetched_indexes_.empty(); }
+  // Drops the prefetched items out of [from, to], they are counted as wasted.
+  void ReleaseOutside(int from, int to);
+  // Drops all prefetched items and the visible range without counting them,
+  // e.g. after the data source changed and the indexes are stale.
+  void Reset();
+
+  // Records the visible range while scrolling. Each item becoming visible is
+  // counted as a hit if it was prefetched, otherwise as a miss.
+  void OnVisibleRangeChanged(int first_visible, int last_visible);
+
+  const Stats& stats() const { return stats_; }
+
+ private:
+  int max_prefetch_count_{0};
+  float velocity_{0.f};
+  float last_offset_{0.f};
+  int64_t last_time_ms_{-1};
+  int first_visible_{-1};
+  int last_visible_{-1};
+  std::unordered_set<int> prefetched_indexes_;
+  Stats stats_;
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_RENDERER_UI_COMPONENT_LIST_LIST_PREFETCH_PREDICTOR_H_
@@ -0,0 +1,140 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/renderer/ui_component/list/list_prefetch_predictor.h"
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace testing {
+
+namespace {
+
+// Scrolls by delta every 16ms, count times from the offset and time given.
+void ScrollSteadily(ListPrefetchPredictor& predictor, float& offset,
+                    int64_t& time_ms, float delta, int count) {
+  for (int i = 0; i < count; ++i) {
+    offset += delta;
+    time_ms += 16;
+    predictor.OnScroll(offset, time_ms);
+  }
+}
+
+}  // namespace
+
+TEST(ListPrefetchPredictorTest, DisabledByDefault) {
+  ListPrefetchPredictor predictor;
+  float offset = 0.f;
+  int64_t time_ms = 0;
+  predictor.OnScroll(offset, time_ms);
+  ScrollSteadily(predictor, offset, time_ms, 32.f, 5);
+  int from = -1;
+  int to = -1;
+  EXPECT_FALSE(predictor.enabled());
+  EXPECT_FALSE(predictor.Predict(0, 5, 100, 100.f, from, to));
+}
+
+TEST(ListPrefetchPredictorTest, VelocityFollowsScroll) {
+  ListPrefetchPredictor predictor;
+  predictor.SetMaxPrefetchCount(4);
+  float offset = 0.f;
+  int64_t time_ms = 0;
+  predictor.OnScroll(offset, time_ms);
+  ScrollSteadily(predictor, offset, time_ms, 32.f, 10);
+  EXPECT_NEAR(predictor.velocity(), 2.f, 0.01f);
+  EXPECT_TRUE(predictor.towards_end());
+
+  ScrollSteadily(predictor, offset, time_ms, -32.f, 10);
+  EXPECT_NEAR(predictor.velocity(), -2.f, 0.01f);
+  EXPECT_FALSE(predictor.towards_end());
+
+  // A sample after a pause is not smoothed with the last gesture.
+  time_ms += 200;
+  offset += 100.f;
+  predictor.OnScroll(offset, time_ms);
+  EXPECT_NEAR(predictor.velocity(), 0.5f, 0.01f);
+
+  predictor.OnScrollStopped();
+  EXPECT_EQ(predictor.velocity(), 0.f);
+}
+
+TEST(ListPrefetchPredictorTest, PredictsInScrollDirection) {
+  ListPrefetchPredictor predictor;
+  predictor.SetMaxPrefetchCount(8);
+  float offset = 1000.f;
+  int64_t time_ms = 0;
+  predictor.OnScroll(offset, time_ms);
+  // 2px per ms looks 600px ahead, i.e. 3 items of 200px.
+  ScrollSteadily(predictor, offset, time_ms, 32.f, 10);
+  int from = -1;
+  int to = -1;
+  ASSERT_TRUE(predictor.Predict(10, 15, 100, 200.f, from, to));
+  EXPECT_EQ(from, 16);
+  EXPECT_EQ(to, 18);
+
+  // Faster scrolls predict more items, up to the max prefetch count.
+  ScrollSteadily(predictor, offset, time_ms, 320.f, 10);
+  ASSERT_TRUE(predictor.Predict(10, 15, 100, 200.f, from, to));
+  EXPECT_EQ(from, 16);
+  EXPECT_EQ(to, 23);
+
+  // The prediction stops at the end of the data.
+  ASSERT_TRUE(predictor.Predict(10, 15, 18, 200.f, from, to));
+  EXPECT_EQ(from, 16);
+  EXPECT_EQ(to, 17);
+  EXPECT_FALSE(predictor.Predict(10, 17, 18, 200.f, from, to));
+
+  ScrollSteadily(predictor, offset, time_ms, -32.f, 10);
+  ASSERT_TRUE(predictor.Predict(10, 15, 100, 200.f, from, to));
+  EXPECT_EQ(from, 7);
+  EXPECT_EQ(to, 9);
+  ASSERT_TRUE(predictor.Predict(1, 6, 100, 200.f, from, to));
+  EXPECT_EQ(from, 0);
+  EXPECT_EQ(to, 0);
+  EXPECT_FALSE(predictor.Predict(0, 5, 100, 200.f, from, to));
+
+  predictor.OnScrollStopped();
+  EXPECT_FALSE(predictor.Predict(10, 15, 100, 200.f, from, to));
+}
+
+TEST(ListPrefetchPredictorTest, CountsHitsMissesAndWaste) {
+  ListPrefetchPredictor predictor;
+  predictor.SetMaxPrefetchCount(4);
+  predictor.OnVisibleRangeChanged(0, 3);
+  predictor.MarkPrefetched(4);
+  predictor.MarkPrefetched(5);
+  predictor.MarkPrefetched(5);
+  EXPECT_TRUE(predictor.IsPrefetched(5));
+  EXPECT_FALSE(predictor.IsPrefetched(6));
+
+  // 4 and 5 were prefetched, 6 was not.
+  predictor.OnVisibleRangeChanged(2, 6);
+  EXPECT_FALSE(predictor.IsPrefetched(4));
+  EXPECT_FALSE(predictor.IsPrefetched(5));
+
+  predictor.MarkPrefetched(7);
+  predictor.MarkPrefetched(8);
+  predictor.ReleaseOutside(2, 7);
+  EXPECT_TRUE(predictor.IsPrefetched(7));
+  EXPECT_FALSE(predictor.IsPrefetched(8));
+
+  const auto& stats = predictor.stats();
+  EXPECT_EQ(stats.prefetched_count, 4);
+  EXPECT_EQ(stats.hit_count, 2);
+  EXPECT_EQ(stats.miss_count, 1);
+  EXPECT_EQ(stats.wasted_count, 1);
+  EXPECT_FLOAT_EQ(stats.HitRate(), 2.f / 3.f);
+
+  // Stale items are dropped without being counted.
+  predictor.Reset();
+  EXPECT_FALSE(predictor.HasPrefetchedItems());
+  predictor.OnVisibleRangeChanged(10, 12);
+  EXPECT_EQ(predictor.stats().miss_count, 1);
+  EXPECT_EQ(predictor.stats().wasted_count, 1);
+}
+
+}  // namespace testing
+}  // namespace tasm
+}  // namespace lynx
@@ -83,6 +83,8 @@ static constexpr const char* const kScrollOrientation = "scroll-orientation";
 static constexpr const char* const kPreloadBufferCount = "preload-buffer-count";
 static constexpr const char kExperimentalContinuousResolveTree[] =
     "experimental-continuous-resolve-tree";
+static constexpr const char kExperimentalPrefetchItemCount[] =
+    "experimental-prefetch-item-count";
 
 // constant value
 static constexpr int kInvalidIndex = -1;
@@ -90,6 +92,8 @@ static constexpr int kInvalidItemCount = -1;
 static constexpr int kInvalidDimensionSize = -1.f;
 static constexpr int kStickyItemSetCapacityForSyncMode = 1;
 static constexpr int kStickyItemSetCapacityForASyncMode = 2;
+// Time of a frame spent on prefetching predicted items.
+static constexpr int kPrefetchBudgetPerFrameMs = 4;
 static constexpr const char* const kList = "list";
 static constexpr const char* const kListTypeSingle = "single";
 static constexpr const char* const kListTypeFlow = "flow";
@@ -16,6 +16,7 @@
 #include "base/include/log/logging.h"
 #include "base/include/no_destructor.h"
 #include "base/include/value/table.h"
+#include "base/trace/native/flight_recorder.h"
 #include "base/trace/native/trace_event.h"
 #include "core/build/gen/lynx_sub_error_code.h"
 #include "core/public/layout_node_value.h"
@@ -727,6 +728,7 @@ void LayoutContext::Layout(const std::shared_ptr<PipelineOptions>& options) {
               [&options](lynx::perfetto::EventContext ctx) {
                 options->UpdateTraceDebugInfo(ctx.event());
               });
+  TRACE_FLIGHT_EVENT("LayoutContext::Layout");
 
   if (layout_paused_) {
     pipeline_options_for_paused_layouts_.emplace_back(options);
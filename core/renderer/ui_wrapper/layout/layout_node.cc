@@ -8,6 +8,7 @@
 
 #include "core/renderer/css/computed_css_style.h"
 #include "core/renderer/lynx_env_config.h"
+#include "core/services/timing_handler/timing.h"
 
 namespace lynx {
 namespace tasm {
@@ -201,6 +202,7 @@ void LayoutNode::SetMeasureFunc(std::unique_ptr<MeasureFunc> measure_func) {
                                bool final_measure) {
     MeasureFunc* measure = (static_cast<LayoutNode*>(context))->measure_func();
     DCHECK(measure);
+    TimingCollector::Instance()->Count(FrameCounter::kLayoutNodesMeasured);
     SLMeasureMode width_mode = constraints[starlight::kHorizontal].Mode();
     SLMeasureMode height_mode = constraints[starlight::kVertical].Mode();
     float width = IsSLIndefiniteMode(width_mode)
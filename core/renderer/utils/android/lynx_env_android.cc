@@ -15,6 +15,7 @@
 #include "core/runtime/jscache/js_cache_manager_facade.h"
 #include "core/services/ssr/ssr_type_info.h"
 #include "core/services/timing_handler/timing.h"
+#include "core/template_bundle/parsed_style_disk_cache.h"
 #include "platform/android/lynx_android/src/main/jni/gen/LynxEnv_jni.h"
 #include "platform/android/lynx_android/src/main/jni/gen/LynxEnv_register_jni.h"
 
@@ -38,6 +39,12 @@ void PrepareLynxGlobalPool(JNIEnv* env, jclass jcaller) {
   lynx::tasm::LynxGlobalPool::GetInstance().PreparePool();
 }
 
+void SetParsedStyleCacheDirectory(JNIEnv* env, jclass jcaller,
+                                  jstring directory) {
+  lynx::tasm::ParsedStyleDiskCache::Instance().SetDirectory(
+      lynx::base::android::JNIConvertHelper::ConvertToString(env, directory));
+}
+
 void SetLocalEnv(JNIEnv* env, jobject jcaller, jstring key, jstring value) {
   lynx::tasm::LynxEnv::GetInstance().SetLocalEnv(
       lynx::base::android::JNIConvertHelper::ConvertToString(env, key),
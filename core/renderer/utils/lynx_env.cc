@@ -457,5 +457,41 @@ bool LynxEnv::EnableFiberElementMemoryReport() {
 bool LynxEnv::FixFontSizeOverrideDirectionChangeBug() {
   return GetBoolEnv(Key::FIX_FONT_SIZE_OVERRIDE_DIRECTION_CHANGE_BUG, true);
 }
+
+bool LynxEnv::EnableFlightRecorder() {
+  return GetBoolEnv(Key::ENABLE_FLIGHT_RECORDER, false);
+}
+
+bool LynxEnv::EnableTemplateBundleCache() {
+  return GetBoolEnv(Key::ENABLE_TEMPLATE_BUNDLE_CACHE, false);
+}
+
+bool LynxEnv::EnableElementArena() {
+  return GetBoolEnv(Key::ENABLE_ELEMENT_ARENA, false);
+}
+
+bool LynxEnv::EnableElementTemplatePrototype() {
+  return GetBoolEnv(Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE, false);
+}
+
+bool LynxEnv::EnableLayeredCSSFragment() {
+  return GetBoolEnv(Key::ENABLE_LAYERED_CSS_FRAGMENT, false);
+}
+
+bool LynxEnv::EnableDecoderStringInterning() {
+  return GetBoolEnv(Key::ENABLE_DECODER_STRING_INTERNING, false);
+}
+
+bool LynxEnv::EnableParsedStyleDiskCache() {
+  return GetBoolEnv(Key::ENABLE_PARSED_STYLE_DISK_CACHE, false);
+}
+
+bool LynxEnv::EnableFrameTimeline() {
+  return GetBoolEnv(Key::ENABLE_FRAME_TIMELINE, false);
+}
+
+bool LynxEnv::EnableFrameScheduler() {
+  return GetBoolEnv(Key::ENABLE_FRAME_SCHEDULER, false);
+}
 }  // namespace tasm
 }  // namespace lynx
@@ -106,6 +106,15 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
     FIX_FONT_SIZE_OVERRIDE_DIRECTION_CHANGE_BUG,
     // FIXME(linxs): remove this config in the next version
     FIX_NEGATIVE_Z_INDEX_INSERT_BUG,
+    ENABLE_FLIGHT_RECORDER,
+    ENABLE_TEMPLATE_BUNDLE_CACHE,
+    ENABLE_ELEMENT_ARENA,
+    ENABLE_ELEMENT_TEMPLATE_PROTOTYPE,
+    ENABLE_LAYERED_CSS_FRAGMENT,
+    ENABLE_DECODER_STRING_INTERNING,
+    ENABLE_PARSED_STYLE_DISK_CACHE,
+    ENABLE_FRAME_TIMELINE,
+    ENABLE_FRAME_SCHEDULER,
     // Please add new enum values above
     END_MARK,  // Keep this as the last enum value, and do not use
   };
@@ -224,6 +233,18 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
             {Key::FIX_FONT_SIZE_OVERRIDE_DIRECTION_CHANGE_BUG,
              "fix_font_size_override_direction_change_bug"},
             {Key::FIX_NEGATIVE_Z_INDEX_INSERT_BUG, "fix_negative_z_index_bug"},
+            {Key::ENABLE_FLIGHT_RECORDER, "enable_flight_recorder"},
+            {Key::ENABLE_TEMPLATE_BUNDLE_CACHE, "enable_template_bundle_cache"},
+            {Key::ENABLE_ELEMENT_ARENA, "enable_element_arena"},
+            {Key::ENABLE_ELEMENT_TEMPLATE_PROTOTYPE,
+             "enable_element_template_prototype"},
+            {Key::ENABLE_LAYERED_CSS_FRAGMENT, "enable_layered_css_fragment"},
+            {Key::ENABLE_DECODER_STRING_INTERNING,
+             "enable_decoder_string_interning"},
+            {Key::ENABLE_PARSED_STYLE_DISK_CACHE,
+             "enable_parsed_style_disk_cache"},
+            {Key::ENABLE_FRAME_TIMELINE, "enable_frame_timeline"},
+            {Key::ENABLE_FRAME_SCHEDULER, "enable_frame_scheduler"},
         });
     auto it = (*env_key_to_string_map).find(key);
     DCHECK(it != (*env_key_to_string_map).end());
@@ -351,6 +372,15 @@ class BASE_EXPORT_FOR_DEVTOOL LynxEnv {
   bool EnableReportMTSContextEvent();
   bool EnableFiberElementMemoryReport();
   bool FixFontSizeOverrideDirectionChangeBug();
+  bool EnableFlightRecorder();
+  bool EnableTemplateBundleCache();
+  bool EnableElementArena();
+  bool EnableElementTemplatePrototype();
+  bool EnableLayeredCSSFragment();
+  bool EnableDecoderStringInterning();
+  bool EnableParsedStyleDiskCache();
+  bool EnableFrameTimeline();
+  bool EnableFrameScheduler();
 
   LynxEnv(const LynxEnv&) = delete;
   LynxEnv& operator=(const LynxEnv&) = delete;
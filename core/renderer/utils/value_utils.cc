@@ -4,6 +4,7 @@
 
 #include "core/renderer/utils/value_utils.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "core/renderer/utils/base/tasm_constants.h"
@@ -12,6 +13,134 @@
 namespace lynx {
 namespace tasm {
 
+namespace {
+
+bool IsSameContainer(const lepus::Value& left, const lepus::Value& right) {
+  if (left.IsTable() && right.IsTable()) {
+    return left.Table().get() == right.Table().get();
+  }
+  if (left.IsArray() && right.IsArray()) {
+    return left.Array().get() == right.Array().get();
+  }
+  return false;
+}
+
+bool IsPrimitive(const lepus::Value& value) {
+  switch (value.Type()) {
+    case lepus::Value_Nil:
+    case lepus::Value_Undefined:
+    case lepus::Value_Double:
+    case lepus::Value_Bool:
+    case lepus::Value_String:
+    case lepus::Value_Int32:
+    case lepus::Value_Int64:
+    case lepus::Value_UInt32:
+    case lepus::Value_UInt64:
+    case lepus::Value_NaN:
+      return true;
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
+void RenderedContainers::Record(const lepus::Value& table) {
+  recorded_ = true;
+  if (!table.IsTable()) {
+    return;
+  }
+  auto table_ref = table.Table();
+  const lepus::Dictionary& dictionary = *table_ref;
+  if (table_ref.get() == table_.get() &&
+      dictionary.generation() == table_generation_) {
+    return;
+  }
+  table_ = table_ref;
+  table_generation_ = dictionary.generation();
+  for (const auto& [key, value] : dictionary) {
+    fml::RefPtr<lepus::RefCountedBase> container;
+    uint64_t generation = 0;
+    if (value.IsTable()) {
+      auto child = value.Table();
+      generation = child->generation();
+      container = std::move(child);
+    } else if (value.IsArray()) {
+      auto child = value.Array();
+      generation = child->generation();
+      container = std::move(child);
+    } else {
+      containers_.erase(key);
+      continue;
+    }
+    auto& entry = containers_[key];
+    if (entry.container.get() == container.get() &&
+        entry.generation == generation) {
+      continue;
+    }
+    // Only the containers holding primitives are comparable, the descendants
+    // of the other ones may be written without them.
+    bool comparable = true;
+    if (value.IsTable()) {
+      const auto& child_table =
+          static_cast<const lepus::Dictionary&>(*container);
+      comparable = std::all_of(child_table.begin(), child_table.end(),
+                               [](const auto& pair) {
+                                 return IsPrimitive(pair.second);
+                               });
+    } else {
+      const auto& child_array = static_cast<const lepus::CArray&>(*container);
+      for (size_t i = 0; i < child_array.size() && comparable; ++i) {
+        comparable = IsPrimitive(child_array.get(i));
+      }
+    }
+    entry = {std::move(container), generation, comparable};
+  }
+}
+
+void RenderedContainers::RecordReferences(const lepus::Value& table) {
+  recorded_ = true;
+  if (!table.IsTable()) {
+    return;
+  }
+  auto table_ref = table.Table();
+  const lepus::Dictionary& dictionary = *table_ref;
+  for (const auto& [key, value] : dictionary) {
+    if (value.IsTable()) {
+      auto child = value.Table();
+      const uint64_t generation = child->generation();
+      containers_[key] = {std::move(child), generation, true};
+    } else if (value.IsArray()) {
+      auto child = value.Array();
+      const uint64_t generation = child->generation();
+      containers_[key] = {std::move(child), generation, true};
+    } else {
+      containers_.erase(key);
+    }
+  }
+}
+
+bool RenderedContainers::IsUnchanged(const base::String& key,
+                                     const lepus::Value& value) const {
+  auto it = containers_.find(key);
+  if (it == containers_.end()) {
+    return false;
+  }
+  const auto& [container, generation, comparable] = it->second;
+  if (!comparable) {
+    return false;
+  }
+  if (value.IsTable()) {
+    return value.Table().get() == container.get() &&
+           value.Table()->generation() == generation;
+  }
+  if (value.IsArray()) {
+    return value.Array().get() == container.get() &&
+           value.Array()->generation() == generation;
+  }
+  return false;
+}
+
 // shadow equal check for table value
 bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
                              const lepus::Value& update_item_value) {
@@ -28,6 +157,17 @@ bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
       return update_item_value != target_item_value;
   }
 }
+
+bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
+                             const lepus::Value& update_item_value,
+                             const base::String& key,
+                             const RenderedContainers* rendered) {
+  if (rendered && IsSameContainer(target_item_value, update_item_value) &&
+      rendered->IsUnchanged(key, update_item_value)) {
+    return false;
+  }
+  return CheckTableValueNotEqual(target_item_value, update_item_value);
+}
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
 bool CheckTableDeepUpdated(const lepus::Value& target,
                            const lepus::Value& update, bool first_layer) {
@@ -72,7 +212,8 @@ bool CheckTableDeepUpdated(const lepus::Value& target,
 #endif
 // shadow equal for table
 bool CheckTableShadowUpdated(const lepus::Value& target,
-                             const lepus::Value& update) {
+                             const lepus::Value& update,
+                             const RenderedContainers* rendered) {
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
   if (lynx::tasm::LynxEnv::GetInstance().IsTableDeepCheckEnabled()) {
     return CheckTableDeepUpdated(target, update, true);
@@ -86,24 +227,25 @@ bool CheckTableShadowUpdated(const lepus::Value& target,
 
   if (target_type == lepus::Value_Table) {
     // component new data from setData
-    auto update_table_value = update.Table();
+    auto update_table_ref = update.Table();
+    const lepus::Dictionary& update_table_value = *update_table_ref;
     // component current data table
-    auto target_table_value = target.Table();
+    auto target_table_ref = target.Table();
+    const lepus::Dictionary& target_table_value = *target_table_ref;
     // shadow compare current_data_table && new_data_table top level
     // if any top level data are different, need update;
-    for (auto& update_data_iterator : *update_table_value) {
+    for (const auto& update_data_iterator : update_table_value) {
       auto target_item_iterator =
-          target_table_value->find(update_data_iterator.first);
+          target_table_value.find(update_data_iterator.first);
 
-      if (target_item_iterator == target_table_value->end()) {
+      if (target_item_iterator == target_table_value.end()) {
         // target did not have this new key
         return true;
       }
 
-      lepus::Value target_item_value = target_item_iterator->second;
-      lepus::Value update_item_value = update_data_iterator.second;
-
-      if (CheckTableValueNotEqual(target_item_value, update_item_value)) {
+      if (CheckTableValueNotEqual(target_item_iterator->second,
+                                  update_data_iterator.second,
+                                  update_data_iterator.first, rendered)) {
         return true;
       }
     }
@@ -124,7 +266,7 @@ void ForEachLepusValue(const lepus::Value& value,
   switch (value.Type()) {
     case lepus::ValueType::Value_Table: {
       auto value_scope_ref_ptr = value.Table();
-      auto& table = *value_scope_ref_ptr;
+      const auto& table = *value_scope_ref_ptr;
       for (auto& pair : table) {
         auto key = lepus::Value(pair.first);
         func(key, pair.second);
@@ -4,9 +4,11 @@
 
 #ifndef CORE_RENDERER_UTILS_VALUE_UTILS_H_
 #define CORE_RENDERER_UTILS_VALUE_UTILS_H_
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "base/include/base_export.h"
@@ -22,13 +24,70 @@ namespace tasm {
 // shadow equal check for table value
 bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
                              const lepus::Value& update_item_value);
+
+// Identity and generation of the containers held by the top level of a
+// rendered table, by key. A container which is passed again and has not been
+// written since it was recorded is known to be rendered, without comparing
+// its content. Only the containers holding primitives are compared.
+class RenderedContainers {
+ public:
+  // Records the containers of the top level of |table|, in addition to the
+  // keys recorded before. Only the keys written since the last record are
+  // visited again: nothing is walked if |table| itself was not written, and
+  // the content of a container is only walked if it was replaced or written.
+  // Entries of keys removed from |table| stay, they can not match a value of
+  // |table| any more.
+  void Record(const lepus::Value& table);
+  // Records every container of the top level of |table| by reference, in one
+  // pass over its keys. A descendant written in place is not seen, so this
+  // only suits comparisons by reference such as component memo.
+  void RecordReferences(const lepus::Value& table);
+  void Clear() {
+    containers_.clear();
+    table_ = nullptr;
+    recorded_ = false;
+  }
+  // Whether a table was recorded since the last Clear().
+  bool recorded() const { return recorded_; }
+
+  // Returns true if |value| is the container recorded for |key| and it has
+  // not been written since.
+  bool IsUnchanged(const base::String& key, const lepus::Value& value) const;
+
+ private:
+  struct Entry {
+    // Retained, so that a new container can not take the address of a
+    // recorded one.
+    fml::RefPtr<lepus::RefCountedBase> container;
+    uint64_t generation;
+    // Whether the container only holds primitives, or was recorded by
+    // reference.
+    bool comparable;
+  };
+  std::unordered_map<base::String, Entry> containers_;
+  // The table last passed to Record() and its generation at that time.
+  fml::RefPtr<lepus::RefCountedBase> table_;
+  uint64_t table_generation_{0};
+  bool recorded_{false};
+};
+
+// Same as above, but a table or array shared by target and update which is
+// recorded for |key| in |rendered| and has not been written since is treated
+// as equal instead of always updated.
+bool CheckTableValueNotEqual(const lepus::Value& target_item_value,
+                             const lepus::Value& update_item_value,
+                             const base::String& key,
+                             const RenderedContainers* rendered);
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
 bool CheckTableDeepUpdated(const lepus::Value& target,
                            const lepus::Value& update, bool first_layer);
 #endif
 // shadow equal for table
+// Pass the containers recorded when target was last rendered to skip the
+// containers which are shared with update and have not been written since.
 bool CheckTableShadowUpdated(const lepus::Value& target,
-                             const lepus::Value& update);
+                             const lepus::Value& update,
+                             const RenderedContainers* rendered = nullptr);
 
 BASE_EXPORT_FOR_DEVTOOL void ForEachLepusValue(const lepus::Value& value,
                                                lepus::LepusValueIterator func);
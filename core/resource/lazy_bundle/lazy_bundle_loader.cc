@@ -8,6 +8,7 @@
 
 #include "base/include/timer/time_utils.h"
 #include "base/trace/native/trace_event.h"
+#include "core/base/threading/task_runner_manufactor.h"
 #include "core/build/gen/lynx_sub_error_code.h"
 #include "core/resource/trace/resource_trace_event_def.h"
 #include "core/shell/lynx_engine.h"
@@ -85,8 +86,14 @@ bool LazyBundleLoader::RequireTemplateCollected(RadonLazyComponent* lazy_bundle,
                                                 const std::string& url,
                                                 int instance_id) {
   // The return value indicates whether a request was actually sent.
+  known_urls_.emplace(url);
   if (requiring_urls_.find(url) == requiring_urls_.end()) {
     StartRecordRequireTime(url);
+    if (preloading_urls_.count(url) != 0) {
+      // The preload of the url will be loaded as required once it is ready.
+      preload_waiting_urls_.emplace(url);
+      return false;
+    }
     {
       TRACE_EVENT(LYNX_TRACE_CATEGORY, DYNAMIC_COMPONENT_REQUIRE_TEMPLATE,
                   "url", url);
@@ -221,13 +228,27 @@ void LazyBundleLoader::RequireTemplate(RadonLazyComponent* lazy_bundle,
  * and callback LazyBundleLoader::DidPreloadTemplate
  */
 void LazyBundleLoader::PreloadTemplates(const std::vector<std::string>& urls) {
+  PreloadTemplatesInternal(urls, 0);
+}
+
+void LazyBundleLoader::PreloadTemplatesInternal(
+    const std::vector<std::string>& urls, uint32_t depth) {
   if (!resource_loader_) {
     LOGE(
         "PreloadTemplates:Use default implementation but resource_loader_ is "
         "null");
     return;
   }
-  std::for_each(urls.begin(), urls.end(), [this](const auto& url) {
+  for (const auto& url : urls) {
+    // Dependencies form a graph which may have cycles, each of them is only
+    // preloaded once.
+    if (!known_urls_.emplace(url).second && depth > 0) {
+      continue;
+    }
+    if (requiring_urls_.count(url) != 0 ||
+        !preloading_urls_.try_emplace(url, depth).second) {
+      continue;
+    }
     auto request =
         pub::LynxResourceRequest{url, pub::LynxResourceType::kLazyBundle};
     resource_loader_->LoadResource(
@@ -250,33 +271,96 @@ void LazyBundleLoader::PreloadTemplates(const std::vector<std::string>& urls) {
               std::move(url), std::move(response.data), std::move(bundle),
               std::move(err_msg)});
         });
-  });
+  }
 }
 
 void LazyBundleLoader::DidPreloadTemplate(
     LazyBundleLoader::CallBackInfo callback_info) {
+  // Preloads of many lazy bundles would block the thread calling back one by
+  // one, prepare them in parallel.
+  auto info = std::make_shared<CallBackInfo>(std::move(callback_info));
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [weak_self = weak_from_this(), info]() {
+        if (auto self = weak_self.lock()) {
+          self->PreparePreloadedTemplate(std::move(*info));
+        }
+      },
+      base::ConcurrentTaskType::NORMAL_PRIORITY);
+}
+
+void LazyBundleLoader::PreparePreloadedTemplate(
+    LazyBundleLoader::CallBackInfo callback_info) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, DYNAMIC_COMPONENT_DID_PRELOAD, "url",
               callback_info.component_url);
+  const bool prebuilt = callback_info.bundle.has_value();
   DecodeBundle(callback_info, false);
 
-#ifdef OS_ANDROID
-  // TODO(zhoupeng): Currently, there is no easy way to get JsEngineType, so
-  // QUICK_JS is used by default. Fix it later.
+  std::vector<std::string> dependencies;
   if (callback_info.bundle) {
+    // A prebuilt bundle has prepared its contexts by the configs when created.
+    if (!prebuilt) {
+      TRACE_EVENT(LYNX_TRACE_CATEGORY,
+                  DYNAMIC_COMPONENT_PREPARE_PRELOADED_CONTEXT);
+      callback_info.bundle->PrepareVMByConfigs();
+      callback_info.bundle->PrepareLepusContext(1);
+    }
+    for (const auto& [name, url] :
+         callback_info.bundle->GetDynamicComponentDeclarations()) {
+      dependencies.emplace_back(url);
+    }
+#ifdef OS_ANDROID
+    // TODO(zhoupeng): Currently, there is no easy way to get JsEngineType, so
+    // QUICK_JS is used by default. Fix it later.
     lynx::piper::cache::JsCacheManagerFacade::PostCacheGenerationTask(
         *callback_info.bundle, callback_info.component_url,
         lynx::piper::JSRuntimeType::quickjs);
-  }
 #endif
+  }
 
   if (engine_actor_) {
     engine_actor_->ActAsync(
-        [callback_info = std::move(callback_info)](auto& engine) mutable {
-          engine->DidPreloadComponent(std::move(callback_info));
+        [weak_self = weak_from_this(),
+         callback_info = std::move(callback_info),
+         dependencies = std::move(dependencies)](auto& engine) mutable {
+          auto self = weak_self.lock();
+          if (!self) {
+            engine->DidPreloadComponent(std::move(callback_info));
+            return;
+          }
+          self->DidPreparePreloadedTemplate(engine.get(),
+                                            std::move(callback_info),
+                                            std::move(dependencies));
         });
   }
 }
 
+void LazyBundleLoader::DidPreparePreloadedTemplate(
+    shell::LynxEngine* engine, LazyBundleLoader::CallBackInfo callback_info,
+    std::vector<std::string> dependencies) {
+  const std::string url = callback_info.component_url;
+  if (FinishPreload(url, dependencies)) {
+    EndRecordRequireTime(callback_info);
+    requiring_urls_.erase(url);
+    engine->DidLoadComponent(std::move(callback_info));
+  } else {
+    engine->DidPreloadComponent(std::move(callback_info));
+  }
+}
+
+bool LazyBundleLoader::FinishPreload(
+    const std::string& url, const std::vector<std::string>& dependencies) {
+  uint32_t depth = kMaxPreloadDependencyDepth;
+  if (auto iter = preloading_urls_.find(url); iter != preloading_urls_.end()) {
+    depth = iter->second;
+    preloading_urls_.erase(iter);
+  }
+  if (enable_preload_dependencies_ && depth < kMaxPreloadDependencyDepth &&
+      !dependencies.empty()) {
+    PreloadTemplatesInternal(dependencies, depth + 1);
+  }
+  return preload_waiting_urls_.erase(url) != 0;
+}
+
 bool LazyBundleLoader::SyncRequiring(const std::string& url) {
   // running on TASM thread and not in requiring_urls_
   return engine_actor_ != nullptr && engine_actor_->CanRunNow() &&
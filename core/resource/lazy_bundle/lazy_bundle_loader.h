@@ -149,8 +149,20 @@ class LazyBundleLoader : public std::enable_shared_from_this<LazyBundleLoader> {
   bool DispatchOnComponentLoaded(TemplateAssembler* tasm,
                                  const std::string& url);
 
+  // Preloaded templates are fetched by the resource loader, then decoded and
+  // given a lepus context on the concurrent loop, so the TASM thread only
+  // attaches the ready bundles. A require of a template being preloaded waits
+  // for it instead of loading it again.
   virtual void PreloadTemplates(const std::vector<std::string>& urls);
 
+  // With preload dependencies enabled, the lazy bundles declared by a
+  // preloaded template are preloaded next, up to this many levels below the
+  // templates preloaded by PreloadTemplates().
+  static constexpr uint32_t kMaxPreloadDependencyDepth = 2;
+  void SetEnablePreloadDependencies(bool enable) {
+    enable_preload_dependencies_ = enable;
+  }
+
   void DidPreloadTemplate(LazyBundleLoader::CallBackInfo callback_info);
 
   // is being required synchronously
@@ -182,16 +194,38 @@ class LazyBundleLoader : public std::enable_shared_from_this<LazyBundleLoader> {
   virtual void ReportErrorInner(int32_t code, const std::string& msg){};
 
  private:
+  // depth is 0 for the templates preloaded by PreloadTemplates(), and one
+  // more for each level of dependencies.
+  void PreloadTemplatesInternal(const std::vector<std::string>& urls,
+                                uint32_t depth);
+  // Runs on the concurrent loop.
+  void PreparePreloadedTemplate(LazyBundleLoader::CallBackInfo callback_info);
+  // Runs on the TASM thread.
+  void DidPreparePreloadedTemplate(shell::LynxEngine* engine,
+                                   LazyBundleLoader::CallBackInfo callback_info,
+                                   std::vector<std::string> dependencies);
+  // Runs on the TASM thread. Ends the preload of url and preloads the
+  // dependencies if enabled. Returns true if a require waits for url.
+  bool FinishPreload(const std::string& url,
+                     const std::vector<std::string>& dependencies);
+
   std::shared_ptr<shell::LynxActor<shell::LynxEngine>> engine_actor_;
   std::shared_ptr<pub::LynxResourceLoader> resource_loader_ = nullptr;
 
   std::set<std::string> requiring_urls_{};
+  // preloads in flight with their dependency depth, and the ones which a
+  // require is waiting for
+  std::unordered_map<std::string, uint32_t> preloading_urls_{};
+  std::set<std::string> preload_waiting_urls_{};
+  // preloaded or required before, not preloaded again as a dependency
+  std::set<std::string> known_urls_{};
   UrlToLifecycleOptionMap url_to_lifecycle_option_map_{};
 
   friend class RequireScope;
   RadonLazyComponent* requiring_component_{nullptr};
 
   bool enable_component_async_decode_{false};
+  bool enable_preload_dependencies_{false};
 };
 
 }  // namespace tasm
@@ -5,12 +5,20 @@
 #define private public
 #define protected public
 
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base/include/fml/task_runner.h"
 #include "core/renderer/tasm/testing/event_tracker_mock.h"
+#include "core/renderer/template_entry_holder.h"
 #include "core/renderer/utils/lynx_env.h"
 #include "core/resource/lazy_bundle/lazy_bundle_lifecycle_option.h"
+#include "core/resource/lazy_bundle/lazy_bundle_loader.h"
 #include "core/resource/lazy_bundle/lazy_bundle_utils.h"
 #include "core/services/event_report/event_tracker.h"
 #include "core/services/event_report/event_tracker_platform_impl.h"
+#include "core/shell/lynx_engine.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
 
 namespace lynx {
@@ -154,6 +162,121 @@ TEST(LazyBundleTest, ConstructErrorMessageForBTS) {
   ASSERT_EQ(expect_msg, value);
 }
 
+TEST(LazyBundleTest, PreloadTemplateBundlesBudget) {
+  auto bundle_of_size = [](uint32_t size) {
+    LynxTemplateBundle bundle;
+    bundle.total_size_ = size;
+    return bundle;
+  };
+  // Budgeted by the decoded footprint, not by the binary size.
+  const size_t footprint = bundle_of_size(40).EstimateDecodedFootprint();
+  ASSERT_GT(footprint, 40u);
+  TemplateEntryHolder holder;
+  holder.SetPreloadTemplateBundlesBudget(footprint * 2 + footprint / 2);
+  holder.InsertLynxTemplateBundle("a", bundle_of_size(40));
+  holder.InsertLynxTemplateBundle("b", bundle_of_size(40));
+  EXPECT_EQ(holder.preload_template_bundles_size_, footprint * 2);
+
+  // Over budget, the least recently preloaded one is dropped.
+  holder.InsertLynxTemplateBundle("c", bundle_of_size(40));
+  EXPECT_EQ(holder.preload_template_bundles_size_, footprint * 2);
+  EXPECT_FALSE(holder.GetPreloadTemplateBundle("a"));
+
+  // Taken bundles leave the budget.
+  EXPECT_TRUE(holder.GetPreloadTemplateBundle("b"));
+  EXPECT_EQ(holder.preload_template_bundles_size_, footprint);
+  EXPECT_EQ(holder.preload_template_bundle_urls_.size(), 1u);
+
+  // The most recently preloaded bundle is kept even over budget.
+  holder.InsertLynxTemplateBundle("d", bundle_of_size(footprint * 4));
+  EXPECT_FALSE(holder.GetPreloadTemplateBundle("c"));
+  EXPECT_TRUE(holder.GetPreloadTemplateBundle("d"));
+  EXPECT_EQ(holder.preload_template_bundles_size_, 0u);
+}
+
+namespace {
+
+class MockTasmRunner : public fml::TaskRunner {
+ public:
+  MockTasmRunner() : fml::TaskRunner(nullptr) {}
+  bool RunsTasksOnCurrentThread() override { return true; }
+  void PostTask(base::closure task) override { task(); }
+};
+
+// Records the requests, never calls back.
+class MockResourceLoader : public pub::LynxResourceLoader {
+ public:
+  void LoadResource(
+      const pub::LynxResourceRequest& request, bool request_in_current_thread,
+      base::MoveOnlyClosure<void, pub::LynxResourceResponse&> callback)
+      override {
+    requested_urls_.emplace_back(request.url);
+  }
+
+  std::vector<std::string> requested_urls_;
+};
+
+class LazyBundlePreloadTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    resource_loader_ = std::make_shared<MockResourceLoader>();
+    loader_ = std::make_shared<LazyBundleLoader>(resource_loader_);
+    loader_->SetEngineActor(
+        std::make_shared<shell::LynxActor<shell::LynxEngine>>(
+            nullptr, fml::MakeRefCounted<MockTasmRunner>()));
+  }
+
+  std::shared_ptr<MockResourceLoader> resource_loader_;
+  std::shared_ptr<LazyBundleLoader> loader_;
+};
+
+}  // namespace
+
+TEST_F(LazyBundlePreloadTest, RequireWaitsForInFlightPreload) {
+  loader_->PreloadTemplates({"a"});
+  EXPECT_EQ(resource_loader_->requested_urls_,
+            std::vector<std::string>{"a"});
+
+  // No second request, the preload is loaded as required once ready.
+  EXPECT_FALSE(loader_->RequireTemplateCollected(nullptr, "a", 0));
+  EXPECT_EQ(resource_loader_->requested_urls_.size(), 1u);
+  EXPECT_TRUE(loader_->FinishPreload("a", {}));
+
+  // A preload nobody waits for stays a preload.
+  loader_->PreloadTemplates({"b"});
+  EXPECT_FALSE(loader_->FinishPreload("b", {}));
+  EXPECT_TRUE(loader_->preloading_urls_.empty());
+  EXPECT_TRUE(loader_->preload_waiting_urls_.empty());
+}
+
+TEST_F(LazyBundlePreloadTest, DependencyCycleIsPreloadedOnce) {
+  loader_->SetEnablePreloadDependencies(true);
+  loader_->PreloadTemplates({"a"});
+  EXPECT_FALSE(loader_->FinishPreload("a", {"b"}));
+  EXPECT_FALSE(loader_->FinishPreload("b", {"a", "b"}));
+  EXPECT_EQ(resource_loader_->requested_urls_,
+            (std::vector<std::string>{"a", "b"}));
+  EXPECT_TRUE(loader_->preloading_urls_.empty());
+}
+
+TEST_F(LazyBundlePreloadTest, DependenciesAreBounded) {
+  // Not preloaded unless enabled.
+  loader_->PreloadTemplates({"a"});
+  loader_->FinishPreload("a", {"b"});
+  EXPECT_EQ(resource_loader_->requested_urls_,
+            std::vector<std::string>{"a"});
+
+  loader_->SetEnablePreloadDependencies(true);
+  loader_->PreloadTemplates({"c"});
+  loader_->FinishPreload("c", {"d"});
+  loader_->FinishPreload("d", {"e"});
+  static_assert(LazyBundleLoader::kMaxPreloadDependencyDepth == 2);
+  // Too deep below c.
+  loader_->FinishPreload("e", {"f"});
+  EXPECT_EQ(resource_loader_->requested_urls_,
+            (std::vector<std::string>{"a", "c", "d", "e"}));
+}
+
 }  // namespace test
 }  // namespace tasm
 }  // namespace lynx
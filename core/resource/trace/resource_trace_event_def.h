@@ -16,6 +16,8 @@ inline constexpr const char* const DYNAMIC_COMPONENT_REQUIRE_TEMPLATE =
     "DynamicComponent::RequireTemplate";
 inline constexpr const char* const DYNAMIC_COMPONENT_DID_PRELOAD =
     "DynamicComponent::DidPreload";
+inline constexpr const char* const DYNAMIC_COMPONENT_PREPARE_PRELOADED_CONTEXT =
+    "DynamicComponent::PreparePreloadedContext";
 
 inline constexpr const char* const FETCH_SCRIPT_BY_PROVIDER =
     "FetchScriptByProvider";
@@ -1098,6 +1098,36 @@ Value AppProxy::get(Runtime* rt, const PropNameID& name) {
 
           return piper::Value::undefined();
         });
+  } else if (methodName == "getFrameTimeline") {
+    return Function::createFromHostFunction(
+        *rt, PropNameID::forAscii(*rt, "getFrameTimeline"), 2,
+        [this](Runtime& rt, const piper::Value& this_val,
+               const piper::Value* args,
+               size_t count) -> base::expected<Value, JSINativeException> {
+          // parameter size == 2
+          // [0] since sequence -> Number
+          // [1] callback -> Function
+          if (count < 2) {
+            return base::unexpected(BUILD_JSI_NATIVE_EXCEPTION(
+                "getFrameTimeline args count must be 2."));
+          }
+          auto ptr = native_app_.lock();
+          if (!ptr || ptr->IsDestroying()) {
+            return piper::Value::undefined();
+          }
+          uint64_t since_sequence = 0;
+          if (args[0].isNumber() && args[0].getNumber() > 0) {
+            since_sequence = static_cast<uint64_t>(args[0].getNumber());
+          }
+          if (!args[1].isObject() || !args[1].getObject(rt).isFunction(rt)) {
+            return base::unexpected(BUILD_JSI_NATIVE_EXCEPTION(
+                "getFrameTimeline's second param must be function!"));
+          }
+          ptr->GetFrameTimeline(
+              since_sequence,
+              ptr->CreateCallBack(args[1].getObject(rt).getFunction(rt)));
+          return piper::Value::undefined();
+        });
   } else if (methodName == "callLepusMethod") {
     return Function::createFromHostFunction(
         *rt, PropNameID::forAscii(*rt, "callLepusMethod"), 2,
@@ -1743,6 +1773,7 @@ std::vector<PropNameID> AppProxy::getPropertyNames(Runtime& rt) {
       "resumeGcSuppressionMode",
       "getSessionStorageItem",
       "subscribeSessionStorage",
+      "getFrameTimeline",
       "generatePipelineOptions",
       "onPipelineStart",
       "bindPipelineIdWithTimingFlag",
@@ -3222,6 +3253,11 @@ void App::SubscribeSessionStorage(const base::String& key, double listener_id,
   delegate_->SubscribeSessionStorage(key.str(), listener_id, callback);
 }
 
+void App::GetFrameTimeline(uint64_t since_sequence,
+                           const ApiCallBack& callback) {
+  delegate_->GetFrameTimeline(since_sequence, callback);
+}
+
 void App::ElementAnimate(const std::string& component_id,
                          const std::string& id_selector,
                          const lepus::Value& args) {
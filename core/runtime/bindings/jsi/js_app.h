@@ -142,6 +142,7 @@ class App : public std::enable_shared_from_this<App> {
                              const ApiCallBack& callback);
   void SubscribeSessionStorage(const base::String& key, double listener_id,
                                const ApiCallBack& callback);
+  void GetFrameTimeline(uint64_t since_sequence, const ApiCallBack& callback);
   void ElementAnimate(const std::string& component_id,
                       const std::string& id_selector, const lepus::Value& args);
   void ElementAnimateV2(const std::string& component_id,
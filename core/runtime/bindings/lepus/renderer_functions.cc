@@ -1125,7 +1125,7 @@ RENDERER_FUNCTION_CC(DispatchEvent) {
 
 void ModifyStyleSheetByIdHelper(
     TemplateAssembler* tasm, const std::string& entry_name, int32_t id,
-    std::unique_ptr<SharedCSSFragment> style_sheet) {
+    std::shared_ptr<SharedCSSFragment> style_sheet) {
   const auto& style_sheet_manager = tasm->style_sheet_manager(entry_name);
   if (!style_sheet) {
     style_sheet_manager->RemoveSharedCSSFragment(id);
@@ -11,10 +11,10 @@
 #include <utility>
 #include <vector>
 
+#include "base/include/content_hash.h"
 #include "base/include/file_utils.h"
 #include "base/include/fml/synchronization/waitable_event.h"
 #include "base/include/log/logging.h"
-#include "base/include/md5.h"
 #include "base/include/no_destructor.h"
 #include "base/include/path_utils.h"
 #include "base/include/string/string_utils.h"
@@ -125,8 +125,8 @@ bool JsCacheManager::WriteFile(const std::string &filename, uint8_t *out_buf,
   return true;
 }
 
-std::string JsCacheManager::MakeFilename(const std::string &file_md5) {
-  return file_md5 + ".cache";
+std::string JsCacheManager::MakeFilename(const std::string &file_digest) {
+  return file_digest + ".cache";
 }
 
 std::string JsCacheManager::GetCacheDir() {
@@ -225,7 +225,7 @@ std::shared_ptr<Buffer> JsCacheManager::TryGetCache(
                 debug->set_string_value(source_url);
               });
 
-  std::optional<std::string> md5_optional;
+  std::optional<std::string> digest_optional;
   std::scoped_lock<std::mutex> lock(cache_lock_);
 
   // try to load cache from memory
@@ -261,7 +261,7 @@ std::shared_ptr<Buffer> JsCacheManager::TryGetCache(
   JsCacheErrorCode error_code = JsCacheErrorCode::META_FILE_READ_ERROR;
   if (file_info) {
     auto cache =
-        LoadCacheFromStorage(*file_info, EnsureMd5(buffer, md5_optional));
+        LoadCacheFromStorage(*file_info, EnsureDigest(buffer, digest_optional));
     if (cache) {
       LOGI("cache loaded from storage, size: " << cache->size() << " bytes");
       if (runtime::IsKernelJs(source_url)) {
@@ -287,7 +287,8 @@ std::shared_ptr<Buffer> JsCacheManager::TryGetCache(
   std::vector<std::unique_ptr<CacheGenerator>> generators;
   generators.push_back(std::move(cache_generator));
   PostTaskBackground(TaskInfo(TaskInfo::TaskType::GENERATE_CACHE, template_url,
-                              std::move(md5_optional), std::move(generators)));
+                              std::move(digest_optional),
+                              std::move(generators)));
   return nullptr;
 }
 
@@ -411,7 +412,7 @@ void JsCacheManager::RunTasks() {
 void JsCacheManager::RunTask(TaskInfo &task) {
   auto start = base::CurrentTimeMilliseconds();
 
-  auto &[type, template_key, md5_optional, generators, callback] = task;
+  auto &[type, template_key, digest_optional, generators, callback] = task;
   std::unordered_map<std::string, std::shared_ptr<Buffer>> generator_results;
 
   for (const auto &generator : generators) {
@@ -419,7 +420,7 @@ void JsCacheManager::RunTask(TaskInfo &task) {
     if (type == TaskInfo::TaskType::GENERATE_CACHE_IF_NEEDED) {
       if (auto info = GetMetaData().GetFileInfo(identifier)) {
         if (auto cache = LoadCacheFromStorage(
-                *info, EnsureMd5(generator->SrcBuffer(), md5_optional))) {
+                *info, EnsureDigest(generator->SrcBuffer(), digest_optional))) {
           if (callback) {
             generator_results[GetCacheUrlFromIdentifier(identifier)] =
                 std::move(cache);
@@ -428,11 +429,12 @@ void JsCacheManager::RunTask(TaskInfo &task) {
         }
       }
     }
-    std::string file_md5 = EnsureMd5(generator->SrcBuffer(), md5_optional);
+    std::string file_digest =
+        EnsureDigest(generator->SrcBuffer(), digest_optional);
 
     LOGI("RunTask start"
          << ", url: '" << identifier.url << "', template_url: '"
-         << identifier.template_url << "', file_md5: " << file_md5
+         << identifier.template_url << "', file_digest: " << file_digest
          << ", buffer size: " << generator->SrcBuffer()->size() << " bytes");
 
     std::shared_ptr<Buffer> cache_buffer(generator->GenerateCache());
@@ -463,7 +465,7 @@ void JsCacheManager::RunTask(TaskInfo &task) {
 
     JsCacheErrorCode error_code = JsCacheErrorCode::NO_ERROR;
     auto persist_success = SaveCacheContentToStorage(identifier, cache_buffer,
-                                                     file_md5, error_code);
+                                                     file_digest, error_code);
     JsCacheTracker::OnGenerateBytecode(
         engine_type_, identifier.url, identifier.template_url, true,
         generator->SrcBuffer()->size(), cache_buffer->size(), persist_success,
@@ -483,12 +485,13 @@ void JsCacheManager::RunTask(TaskInfo &task) {
 }
 
 std::shared_ptr<Buffer> JsCacheManager::LoadCacheFromStorage(
-    const CacheFileInfo &file_info, const std::string &file_md5) {
+    const CacheFileInfo &file_info, const std::string &file_digest) {
   std::string cache;
-  if (file_info.md5 != file_md5 || !ReadFile(MakeFilename(file_md5), cache) ||
+  if (file_info.md5 != file_digest ||
+      !ReadFile(MakeFilename(file_digest), cache) ||
       cache.size() != file_info.cache_size) {
-    if (file_info.md5 != file_md5) {
-      LOGI("js file md5 mismatch.");
+    if (file_info.md5 != file_digest) {
+      LOGI("js file digest mismatch.");
     } else {
       LOGI("cache file broken. cache size read from storage: "
            << cache.size()
@@ -508,10 +511,10 @@ std::shared_ptr<Buffer> JsCacheManager::LoadCacheFromStorage(
 
 bool JsCacheManager::SaveCacheContentToStorage(
     const JsFileIdentifier &identifier, const std::shared_ptr<Buffer> &cache,
-    const std::string &file_md5, JsCacheErrorCode &error_code) {
+    const std::string &file_digest, JsCacheErrorCode &error_code) {
   LOGI("SaveCacheContentToStorage template_url=' "
        << identifier.template_url << "', url='" << identifier.url << "'");
-  GetMetaData().UpdateFileInfo(identifier, file_md5, cache->size());
+  GetMetaData().UpdateFileInfo(identifier, file_digest, cache->size());
   std::string json = GetMetaData().ToJson();
   LOGV("metadata: " << json);
   if (!WriteFile(METADATA_FILE_NAME, reinterpret_cast<uint8_t *>(json.data()),
@@ -520,8 +523,8 @@ bool JsCacheManager::SaveCacheContentToStorage(
     error_code = JsCacheErrorCode::META_FILE_WRITE_ERROR;
     return false;
   }
-  if (!WriteFile(MakeFilename(file_md5), const_cast<uint8_t *>(cache->data()),
-                 cache->size())) {
+  if (!WriteFile(MakeFilename(file_digest),
+                 const_cast<uint8_t *>(cache->data()), cache->size())) {
     LOGE("Write Cache File failed!");
     error_code = JsCacheErrorCode::CACHE_FILE_WRITE_ERROR;
     return false;
@@ -724,14 +727,18 @@ size_t JsCacheManager::MaxCacheSize() {
       tasm::LynxEnv::Key::BYTECODE_MAX_SIZE, 100 * 1024 * 1024);
 }
 
-const std::string &JsCacheManager::EnsureMd5(
+const std::string &JsCacheManager::EnsureDigest(
     const std::shared_ptr<const Buffer> &buffer,
-    std::optional<std::string> &md5_str) {
-  if (!md5_str.has_value()) {
-    md5_str = base::md5(reinterpret_cast<const char *>(buffer->data()),
-                        buffer->size());
+    std::optional<std::string> &digest) {
+  if (!digest.has_value()) {
+    if (!buffer->digest().empty()) {
+      digest = buffer->digest();
+    } else {
+      digest = base::ContentHasher::HashToHexString(buffer->data(),
+                                                    buffer->size());
+    }
   }
-  return *md5_str;
+  return *digest;
 }
 
 std::string JsCacheManager::GetSourceCategory(const std::string &source_url) {
@@ -54,19 +54,19 @@ class JsCacheManager {
       GENERATE_CACHE_IF_NEEDED,
     } type;
 
-    std::string template_key;                 // template unique key
-    std::optional<std::string> md5_optional;  // md5 of source js file
+    std::string template_key;                    // template unique key
+    std::optional<std::string> digest_optional;  // digest of source js file
     std::vector<std::unique_ptr<CacheGenerator>>
         cache_generators;  // functions to generate cache
     std::unique_ptr<BytecodeGenerateCallback> callback;
 
     TaskInfo(TaskType type, std::string template_url,
-             std::optional<std::string> md5_optional,
+             std::optional<std::string> digest_optional,
              std::vector<std::unique_ptr<CacheGenerator>> generators,
              std::unique_ptr<BytecodeGenerateCallback> callback = nullptr)
         : type(type),
           template_key(std::move(template_url)),
-          md5_optional(std::move(md5_optional)),
+          digest_optional(std::move(digest_optional)),
           cache_generators(std::move(generators)),
           callback(std::move(callback)) {}
   };
@@ -134,10 +134,10 @@ UNITTEST_PUBLIC:
   UNITTEST_VIRTUAL std::string GetCacheDir();
 
   /**
-   * Generate file name using md5 of file.
-   * @param file_md5 Md5 of the file.
+   * Generate file name using the content digest of file.
+   * @param file_digest Digest of the file.
    */
-  std::string MakeFilename(const std::string &file_md5);
+  std::string MakeFilename(const std::string &file_digest);
 
   bool IsCacheEnabled();
   /**
@@ -169,22 +169,22 @@ UNITTEST_PUBLIC:
   /**
    * Try to load cache file from storage.
    * @param info The info of the original js file.
-   * @param file_md5 The md5 of the js file.
+   * @param file_digest The content digest of the js file.
    * @return Cache buffer; or nullptr if no matching cache exists.
    */
   std::shared_ptr<Buffer> LoadCacheFromStorage(const CacheFileInfo &info,
-                                               const std::string &file_md5);
+                                               const std::string &file_digest);
 
   /**
    * Save the cache content to storage.
    * @param identifier The identifier of the js file.
    * @param cache The cache to store.
-   * @param file_md5 The md5 of the source js file.
+   * @param file_digest The content digest of the source js file.
    * @return If the save operation succeed.
    */
   bool SaveCacheContentToStorage(const JsFileIdentifier &identifier,
                                  const std::shared_ptr<Buffer> &cache,
-                                 const std::string &file_md5,
+                                 const std::string &file_digest,
                                  JsCacheErrorCode &error_code);
 
   /**
@@ -232,15 +232,15 @@ UNITTEST_PUBLIC:
   void ClearCacheDir();
 
   /**
-   * Calculate MD5.
-   * If md5_str is empty, calculate MD5 and return.
-   * If md5_str is not empty, return md5_str directly.
-   * @param buffer buffer to calculate MD5.
-   * @param md5_str either empty_str or calculated MD5 result.
-   * @returns MD5 result.
+   * Calculate the content digest, see base::ContentHasher.
+   * If digest is not empty, return it directly.
+   * Otherwise use the digest carried by buffer, or calculate it.
+   * @param buffer buffer to calculate the digest of.
+   * @param digest either empty or calculated digest result.
+   * @returns digest result.
    */
-  const std::string &EnsureMd5(const std::shared_ptr<const Buffer> &buffer,
-                               std::optional<std::string> &md5_str);
+  const std::string &EnsureDigest(const std::shared_ptr<const Buffer> &buffer,
+                                  std::optional<std::string> &digest);
 
   /**
    * Save cache to memory.
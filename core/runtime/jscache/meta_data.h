@@ -47,7 +47,7 @@ struct CacheFileInfo {
   JsFileIdentifier identifier;  // identifier of js file
   uint64_t cache_size;          // in bytes
   int64_t last_accessed;        // seconds since epoch
-  std::string md5;              // md5 of js file
+  std::string md5;              // content digest of js file
 };
 
 class MetaData {
@@ -51,18 +51,27 @@ class BASE_EXPORT Buffer {
   BASE_EXPORT virtual ~Buffer() = default;
   virtual size_t size() const = 0;
   virtual const uint8_t* data() const = 0;
+  // The content digest of the data if the producer already computed it,
+  // otherwise empty. See base::ContentHasher.
+  virtual const std::string& digest() const {
+    static const std::string kEmpty;
+    return kEmpty;
+  }
 };
 
 class StringBuffer : public Buffer {
  public:
-  StringBuffer(std::string s) : s_(std::move(s)) {}
+  StringBuffer(std::string s, std::string digest = std::string())
+      : s_(std::move(s)), digest_(std::move(digest)) {}
   size_t size() const override { return s_.size(); }
   const uint8_t* data() const override {
     return reinterpret_cast<const uint8_t*>(s_.data());
   }
+  const std::string& digest() const override { return digest_; }
 
  private:
   std::string s_;
+  std::string digest_;
 };
 
 class ByteBuffer : public Buffer {
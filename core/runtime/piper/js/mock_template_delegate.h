@@ -169,6 +169,9 @@ class MockTemplateDelegate : public runtime::TemplateDelegate {
   void SubscribeSessionStorage(const std::string&, double listener_id,
                                const piper::ApiCallBack& callback) override{};
 
+  void GetFrameTimeline(uint64_t since_sequence,
+                        const piper::ApiCallBack& callback) override{};
+
  protected:
   std::string sdk_version_;
   std::shared_ptr<tasm::PropBundleCreator> prop_bundle_creator_;
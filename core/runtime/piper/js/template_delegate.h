@@ -210,6 +210,11 @@ class TemplateDelegate : public ContextProxy::Delegate,
 
   virtual void SubscribeSessionStorage(const std::string&, double listener_id,
                                        const piper::ApiCallBack& callback) = 0;
+
+  // Calls back with the frames of the FrameTimeline completed after
+  // |since_sequence|.
+  virtual void GetFrameTimeline(uint64_t since_sequence,
+                                const piper::ApiCallBack& callback) = 0;
 };
 }  // namespace runtime
 }  // namespace lynx
@@ -5,6 +5,7 @@
 #include "core/runtime/vm/lepus/base_binary_reader.h"
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -172,7 +173,18 @@ bool BaseBinaryReader::DecodeDate(fml::RefPtr<CDate>& date) {
 bool BaseBinaryReader::DeserializeStringSection() { return true; }
 
 bool BaseBinaryReader::DecodeUtf8Str(base::String& result) {
-  ReadStringDirectly(result);
+  if (!enable_string_interning_) {
+    ReadStringDirectly(result);
+    return true;
+  }
+  std::string_view view;
+  ERROR_UNLESS(ReadStringView(&view));
+  auto it = interned_strings_.find(view);
+  if (it == interned_strings_.end()) {
+    it = interned_strings_.emplace(view, base::String(view.data(), view.size()))
+             .first;
+  }
+  result = it->second;
   return true;
 }
 
@@ -7,6 +7,7 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -144,6 +145,13 @@ class BaseBinaryReader : public BinaryReader {
 
   bool DecodeUtf8Str(base::String&);
   bool DecodeUtf8Str(std::string*);
+
+  // When enabled, strings decoded by DecodeUtf8Str() are looked up by their
+  // bytes in the stream buffer, and repeated strings share the base::String
+  // created for the first occurrence instead of allocating a copy each.
+  void SetEnableStringInterning(bool enable) {
+    enable_string_interning_ = enable;
+  }
   bool DecodeTable(fml::RefPtr<Dictionary>&, bool = false);
   bool DecodeArray(fml::RefPtr<CArray>&);
   bool DecodeValue(Value*, bool = false);
@@ -161,6 +169,11 @@ class BaseBinaryReader : public BinaryReader {
   tasm::CompileOptions compile_options_;
 
   std::vector<base::String> string_list_;
+
+  bool enable_string_interning_{false};
+  // Keys are views into the stream buffer, which outlives the reader's use
+  // of them since it is shared by the derived streams.
+  std::unordered_map<std::string_view, base::String> interned_strings_;
 };
 
 }  // namespace lepus
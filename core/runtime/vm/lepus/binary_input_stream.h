@@ -10,6 +10,7 @@
 #include <cstring>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -88,6 +89,17 @@ class InputStream {
     return true;
   }
 
+  // The view references the stream buffer and is only valid as long as it.
+  bool ReadStringView(std::string_view& str, size_t len) {
+    if (!CheckSize(len)) {
+      return false;
+    }
+
+    str = std::string_view(reinterpret_cast<const char*>(cursor()), len);
+    offset_ += len;
+    return true;
+  }
+
   size_t offset() { return offset_; }
 
   // Returns the length of the leb128.
@@ -6,6 +6,8 @@
 
 #include "core/runtime/vm/lepus/binary_input_stream_unittest.h"
 
+#include "core/runtime/vm/lepus/base_binary_reader.h"
+
 namespace lynx {
 namespace lepus {
 namespace test {
@@ -139,6 +141,49 @@ TEST_F(ByteArrayInputStreamTest, TestReadString1) {
   EXPECT_EQ(target_str, "st");
 }
 
+TEST_F(ByteArrayInputStreamTest, TestReadStringView) {
+  std::string str = "test string";
+
+  auto stream = std::make_unique<ByteArrayInputStream>(
+      reinterpret_cast<const uint8_t*>(str.data()), str.size());
+
+  std::string_view target_str;
+  EXPECT_FALSE(stream->ReadStringView(target_str, str.size() + 1));
+  EXPECT_TRUE(target_str.empty());
+
+  EXPECT_TRUE(stream->ReadStringView(target_str, 4));
+  EXPECT_EQ(target_str, "test");
+  // The view references the stream buffer instead of a copy.
+  EXPECT_EQ(reinterpret_cast<const uint8_t*>(target_str.data()),
+            stream->begin());
+
+  EXPECT_TRUE(stream->ReadStringView(target_str, 7));
+  EXPECT_EQ(target_str, " string");
+}
+
+TEST_F(ByteArrayInputStreamTest, TestInternDecodedStrings) {
+  std::string str = "\x03abc\x03abc\x03xyz\x03abc";
+
+  BaseBinaryReader reader(std::make_unique<ByteArrayInputStream>(
+      reinterpret_cast<const uint8_t*>(str.data()), str.size()));
+  reader.SetEnableStringInterning(true);
+
+  base::String first, second, third;
+  EXPECT_TRUE(reader.DecodeUtf8Str(first));
+  EXPECT_TRUE(reader.DecodeUtf8Str(second));
+  EXPECT_TRUE(reader.DecodeUtf8Str(third));
+  EXPECT_EQ(first, "abc");
+  EXPECT_EQ(third, "xyz");
+  EXPECT_EQ(first.c_str(), second.c_str());
+  EXPECT_NE(first.c_str(), third.c_str());
+
+  reader.SetEnableStringInterning(false);
+  base::String copied;
+  EXPECT_TRUE(reader.DecodeUtf8Str(copied));
+  EXPECT_EQ(copied, first);
+  EXPECT_NE(copied.c_str(), first.c_str());
+}
+
 TEST_F(ByteArrayInputStreamTest, TestReadCompactU32) {
   std::string str = "test string";
 
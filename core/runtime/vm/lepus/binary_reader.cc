@@ -61,6 +61,13 @@ bool BinaryReader::ReadStringDirectly(base::String& out_value) {
   return true;
 }
 
+bool BinaryReader::ReadStringView(std::string_view* out_value) {
+  uint32_t length = 0;
+  ERROR_UNLESS(ReadCompactU32(&length));
+  ERROR_UNLESS(stream_->ReadStringView(*out_value, length));
+  return true;
+}
+
 void BinaryReader::PrintError(const char* format, const char* func, int line) {
   char buffer[1024];
   snprintf(buffer, sizeof(buffer), format, func, line);
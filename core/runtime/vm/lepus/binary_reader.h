@@ -10,6 +10,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
@@ -57,6 +58,7 @@ class BinaryReader {
   bool ReadCompactD64(double* value);
   bool ReadStringDirectly(std::string* out_value);
   bool ReadStringDirectly(base::String& out_value);
+  bool ReadStringView(std::string_view* out_value);
   void PrintError(const char* format, const char* func, int line);
   bool CheckSize(int len, uint32_t maxOffset = 0);
   void Skip(uint32_t size);
@@ -3,6 +3,7 @@
 // LICENSE file in the root directory of this source tree.
 #include "core/runtime/vm/lepus/code_generator.h"
 
+#include <cmath>
 #include <stack>
 
 #include "base/include/sorted_for_each.h"
@@ -366,6 +367,10 @@ void CodeGenerator::Visit(ChunkAST* ast, void* data) {
 
   context_->root_function_ = current_function_->function_;
   GenerateScopes(current_function_);
+  for (const auto& function : function_generators_) {
+    context_->compile_stats_.instruction_count +=
+        function->function_->OpCodeSize();
+  }
 }
 
 void CodeGenerator::Visit(CatchBlockAST* ast, void* data) {
@@ -761,6 +766,150 @@ long CodeGenerator::GetUpvalueArrayIndex(const lynx::base::String& name) {
   return -1;
 }
 
+bool CodeGenerator::FoldConstant(ASTree* ast, Value& value,
+                                 size_t& node_count) {
+  // Integers beyond it are computed in int64 by the vm, only fold the numbers
+  // a double holds exactly so the result is the same.
+  constexpr double kMaxSafeInteger = 9007199254740991.0;
+  auto is_safe_number = [](double number) {
+    return std::isfinite(number) && std::fabs(number) <= kMaxSafeInteger;
+  };
+  if (ast->type() == ASTType_Literal) {
+    auto* literal = static_cast<LiteralAST*>(ast);
+    if (literal->lex_op() != LexicalOp_Read) {
+      return false;
+    }
+    const Token& token = literal->token();
+    if (token.token_ == Token_Number && is_safe_number(token.number_)) {
+      value.SetNumber(token.number_);
+    } else if (token.token_ == Token_String) {
+      value.SetString(token.str_);
+    } else {
+      return false;
+    }
+    ++node_count;
+    return true;
+  }
+  if (ast->type() == ASTType_UnaryExpr) {
+    auto* unary = static_cast<UnaryExpression*>(ast);
+    if (unary->op_token().token_ != '-' ||
+        !FoldConstant(unary->expression().get(), value, node_count) ||
+        !value.IsNumber()) {
+      return false;
+    }
+    value.SetNumber(-value.Number());
+    ++node_count;
+    return true;
+  }
+  if (ast->type() != ASTType_BinaryExpr) {
+    return false;
+  }
+  auto* binary = static_cast<BinaryExprAST*>(ast);
+  Value left;
+  Value right;
+  if (!FoldConstant(binary->left().get(), left, node_count) ||
+      !FoldConstant(binary->right().get(), right, node_count)) {
+    return false;
+  }
+  const int op = binary->op_token().token_;
+  if (left.IsString() && right.IsString()) {
+    if (op != '+') {
+      return false;
+    }
+    value.SetString(left.StdString() + right.StdString());
+  } else if (left.IsNumber() && right.IsNumber()) {
+    const double l = left.Number();
+    const double r = right.Number();
+    double result = 0;
+    switch (op) {
+      case '+':
+        result = l + r;
+        break;
+      case '-':
+        result = l - r;
+        break;
+      case '*':
+        result = l * r;
+        break;
+      case '/':
+        // Division by zero is reported by the vm at runtime.
+        if (r == 0) {
+          return false;
+        }
+        result = l / r;
+        break;
+      case '<':
+        value.SetBool(l < r);
+        ++node_count;
+        return true;
+      case '>':
+        value.SetBool(l > r);
+        ++node_count;
+        return true;
+      case Token_LessEqual:
+        value.SetBool(l <= r);
+        ++node_count;
+        return true;
+      case Token_GreaterEqual:
+        value.SetBool(l >= r);
+        ++node_count;
+        return true;
+      default:
+        return false;
+    }
+    if (!is_safe_number(result)) {
+      return false;
+    }
+    value.SetNumber(result);
+  } else {
+    return false;
+  }
+  ++node_count;
+  return true;
+}
+
+void CodeGenerator::LoadConstant(const Value& value, long register_id) {
+  fml::RefPtr<Function> function = current_function_->function_;
+  long index;
+  if (value.IsNumber()) {
+    index = function->AddConstNumber(value.Number());
+  } else if (value.IsString()) {
+    index = function->AddConstString(value.String());
+  } else {
+    index = function->AddConstBoolean(value.Bool());
+  }
+  Load(TypeOp_LoadConst, register_id, index);
+}
+
+long CodeGenerator::LocalOperandRegister(ASTree* ast) {
+  if (ast->type() != ASTType_Literal) {
+    return -1;
+  }
+  auto* literal = static_cast<LiteralAST*>(ast);
+  if (literal->lex_op() != LexicalOp_Read ||
+      literal->token().token_ != Token_Id ||
+      literal->scope() != LexicalScoping_Local ||
+      literal->auto_type() != Automatic_None) {
+    return -1;
+  }
+  // A variable captured by a closure is reloaded from its context slot first.
+  if (support_closure_ && GetUpvalueArrayIndex(literal->token().str_) != -1) {
+    return -1;
+  }
+  return SearchVariable(literal->token().str_);
+}
+
+bool CodeGenerator::IsPureOperand(ASTree* ast) {
+  if (ast->type() != ASTType_Literal) {
+    return false;
+  }
+  auto* literal = static_cast<LiteralAST*>(ast);
+  if (literal->token().token_ != Token_Id) {
+    return literal->lex_op() == LexicalOp_Read;
+  }
+  return LocalOperandRegister(ast) >= 0;
+}
+
 void CodeGenerator::Visit(LiteralAST* ast, void* data) {
   fml::RefPtr<Function> function = current_function_->function_;
   AstLineScope sop(current_function_->function_.get(), ast);
@@ -939,11 +1088,31 @@ void CodeGenerator::Visit(BinaryExprAST* ast, void* data) {
   AstLineScope sop(current_function_->function_.get(), ast);
   int register_id = data == nullptr ? -1 : *static_cast<int*>(data);
   fml::RefPtr<Function> function = current_function_->function_;
-  long left_register_id = GenerateRegisterId();
-  ast->left()->Accept(this, &left_register_id);
-  if (ast->op_token().token_ == Token_And ||
-      ast->op_token().token_ == Token_Or ||
-      ast->op_token().token_ == Token_Nullish_Coalescing) {
+  const bool is_logical = ast->op_token().token_ == Token_And ||
+                          ast->op_token().token_ == Token_Or ||
+                          ast->op_token().token_ == Token_Nullish_Coalescing;
+  if (!is_logical && register_id >= 0) {
+    Value folded;
+    size_t node_count = 0;
+    if (FoldConstant(ast, folded, node_count)) {
+      LoadConstant(folded, register_id);
+      context_->compile_stats_.folded_instruction_count += node_count - 1;
+      return;
+    }
+  }
+  // The operator reads a local variable operand from its own register instead
+  // of a copy, unless the other operand evaluated after it may assign it.
+  long left_register_id = -1;
+  if (!is_logical && IsPureOperand(ast->right().get())) {
+    left_register_id = LocalOperandRegister(ast->left().get());
+  }
+  if (left_register_id >= 0) {
+    ++context_->compile_stats_.elided_move_count;
+  } else {
+    left_register_id = GenerateRegisterId();
+    ast->left()->Accept(this, &left_register_id);
+  }
+  if (is_logical) {
     if (support_closure_) {
       Instruction instruction;
       long jmp_index = 0;
@@ -1000,8 +1169,13 @@ void CodeGenerator::Visit(BinaryExprAST* ast, void* data) {
       }
     }
   } else {
-    long right_register_id = GenerateRegisterId();
-    ast->right()->Accept(this, &right_register_id);
+    long right_register_id = LocalOperandRegister(ast->right().get());
+    if (right_register_id >= 0) {
+      ++context_->compile_stats_.elided_move_count;
+    } else {
+      right_register_id = GenerateRegisterId();
+      ast->right()->Accept(this, &right_register_id);
+    }
     if (!support_closure_) {
       int token = ast->op_token().token_;
       if (token == '&' || token == '|' || token == '^' || token == Token_Pow) {
@@ -1100,6 +1274,13 @@ void CodeGenerator::Visit(UnaryExpression* ast, void* data) {
   int register_id = *static_cast<int*>(data);
   AstLineScope sop(current_function_->function_.get(), ast);
   fml::RefPtr<Function> function = current_function_->function_;
+  Value folded;
+  size_t node_count = 0;
+  if (register_id >= 0 && FoldConstant(ast, folded, node_count)) {
+    LoadConstant(folded, register_id);
+    context_->compile_stats_.folded_instruction_count += node_count - 1;
+    return;
+  }
   ast->expression()->Accept(this, data);
   if (!support_closure_) {
     if (ast->op_token().token_ == '~' || ast->op_token().token_ == '+') {
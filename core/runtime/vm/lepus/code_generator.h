@@ -340,6 +340,18 @@ class CodeGenerator : public Visitor {
                            std::pair<long, long> src);
   void AutomaticUpValue(AutomaticType type, long dst, long src);
   long GetUpvalueArrayIndex(const base::String& name);
+
+  // Folds |ast| into |value| if it only combines number literals with
+  // arithmetic or comparison operators, or joins string literals with '+'.
+  // |node_count| is increased by the number of nodes folded.
+  bool FoldConstant(ASTree* ast, Value& value, size_t& node_count);
+  void LoadConstant(const Value& value, long register_id);
+  // Returns the register of the local variable |ast| reads if the operator
+  // can read it in place instead of from a copy, -1 otherwise.
+  long LocalOperandRegister(ASTree* ast);
+  // Whether evaluating |ast| can not change any local variable.
+  bool IsPureOperand(ASTree* ast);
+
   long GenerateRegisterId();
   uint64_t GetCurrentBlockId();
   void DestoryRegisterId() {
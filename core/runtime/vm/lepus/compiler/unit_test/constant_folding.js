@@ -0,0 +1,48 @@
+// Constant expressions are folded at compile time.
+
+Assert(1 + 2 * 3 == 7);
+Assert((1 + 2) * 3 == 9);
+Assert(-4 - -6 == 2);
+Assert(7 / 2 == 3.5);
+Assert(8 / 2 == 4);
+Assert(1 < 2);
+Assert(2 >= 2);
+Assert(!(3 <= 2));
+Assert("ab" + "cd" == "abcd");
+Assert("a" + "b" + "c" == "abc");
+
+// Not folded.
+Assert(2 ** 3 == 8);
+Assert("a" + 1 == "a1");
+
+// Local operands are read in place.
+
+let a = 3;
+let b = 4;
+Assert(a + b == 7);
+Assert(a * b - a == 9);
+Assert(a + 1 == 4);
+Assert(1 + a == 4);
+Assert(a < b);
+
+// The right operand assigns the left one, which is read first.
+Assert(a + (a = 10) == 13);
+Assert(a == 10);
+Assert(a + a++ == 20);
+Assert(a == 11);
+Assert(a-- + a == 21);
+Assert(a == 10);
+
+function add(x, y) {
+  return x + y;
+}
+Assert(add(a, b) == 14);
+
+// A captured variable is still read from its closure.
+let c = 1;
+function inc() {
+  c = c + 1;
+  return c;
+}
+Assert(inc() + c == 4);
+Assert(c + inc() == 5);
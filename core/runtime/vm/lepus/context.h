@@ -35,6 +35,7 @@ namespace lynx {
 namespace tasm {
 class AnimationFrameManager;
 class LepusCallbackManager;
+class RenderedContainers;
 }  // namespace tasm
 
 namespace lepus {
@@ -112,8 +113,11 @@ class Context {
   virtual bool UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
                                             const Value& val) = 0;
   // shadow equal for table
+  // rendered holds the containers recorded when the top level variables were
+  // last rendered, see tasm::CheckTableShadowUpdated().
   virtual bool CheckTableShadowUpdatedWithTopLevelVariable(
-      const lepus::Value& update) = 0;
+      const lepus::Value& update,
+      const tasm::RenderedContainers* rendered = nullptr) = 0;
 
   virtual void ResetTopLevelVariable() = 0;
   virtual void ResetTopLevelVariableByVal(const Value& val) = 0;
@@ -538,7 +538,7 @@ Value* QuickContext::GetParam(long index) {
 const std::string& QuickContext::name() const { return name_; }
 
 bool QuickContext::CheckTableShadowUpdatedWithTopLevelVariable(
-    const lepus::Value& update) {
+    const lepus::Value& update, const tasm::RenderedContainers* rendered) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, QUICK_CONTEXT_CHECK_TABLE_SHADOW_UPDATED);
   bool enable_deep_check = false;
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
@@ -591,7 +591,8 @@ bool QuickContext::CheckTableShadowUpdatedWithTopLevelVariable(
       return true;
     }
     if (!enable_deep_check &&
-        tasm::CheckTableValueNotEqual(value.ToLepusValue(), val)) {
+        tasm::CheckTableValueNotEqual(value.ToLepusValue(), val,
+                                      update_data_iterator.first, rendered)) {
       return true;
     }
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
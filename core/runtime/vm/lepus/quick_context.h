@@ -63,7 +63,8 @@ class QuickContext : private LEPUSRuntimeData,
   virtual bool UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
                                             const lepus::Value& val) override;
   virtual bool CheckTableShadowUpdatedWithTopLevelVariable(
-      const lepus::Value& update) override;
+      const lepus::Value& update,
+      const tasm::RenderedContainers* rendered = nullptr) override;
   virtual void ResetTopLevelVariable() override;
   virtual void ResetTopLevelVariableByVal(const Value& val) override;
 
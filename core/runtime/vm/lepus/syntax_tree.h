@@ -177,6 +177,7 @@ class BinaryExprAST : public ASTree {
   std::unique_ptr<ASTree>& right() { return right_; }
 
   Token& op_token() { return op_token_; }
+  virtual ASTType type() { return ASTType_BinaryExpr; }
   AST_ACCEPT_VISITOR
  private:
   std::unique_ptr<ASTree> left_;
@@ -193,6 +194,7 @@ class UnaryExpression : public ASTree {
   std::unique_ptr<ASTree>& expression() { return expression_; }
 
   Token& op_token() { return op_token_; }
+  virtual ASTType type() { return ASTType_UnaryExpr; }
   AST_ACCEPT_VISITOR
  private:
   std::unique_ptr<ASTree> expression_;
@@ -130,6 +130,116 @@ TEST(LepusShadowEqualTest, HasSameTableValueReturnTrue) {
                                             lepus::Value(target_map)));
 }
 
+TEST(LepusShadowEqualTest, UnmutatedSharedTableSinceRender) {
+  lepus::Value dic = lepus::Value(lepus::Dictionary::Create());
+  dic.SetProperty(base::String(bar), lepus::Value(1));
+  auto target_map = lepus::Dictionary::Create();
+  target_map.get()->SetValue(base::String(foo), dic);
+  tasm::RenderedContainers rendered;
+  rendered.Record(lepus::Value(target_map));
+
+  auto update_map = lepus::Dictionary::Create();
+  update_map.get()->SetValue(base::String(foo), dic);
+
+  ASSERT_FALSE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+
+  // Written since the render.
+  dic.SetProperty(base::String(bar), lepus::Value(2));
+  ASSERT_TRUE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+}
+
+TEST(LepusShadowEqualTest, MutatedSharedTableSinceRender) {
+  lepus::Value nested = lepus::Value(lepus::Dictionary::Create());
+  lepus::Value dic = lepus::Value(lepus::Dictionary::Create());
+  dic.SetProperty(base::String(bar), nested);
+  auto target_map = lepus::Dictionary::Create();
+  target_map.get()->SetValue(base::String(foo), dic);
+  tasm::RenderedContainers rendered;
+  rendered.Record(lepus::Value(target_map));
+
+  // Only the nested table is mutated, a table holding tables is not recorded.
+  nested.SetProperty(base::String(bar), lepus::Value(1));
+  auto update_map = lepus::Dictionary::Create();
+  update_map.get()->SetValue(base::String(foo), dic);
+
+  ASSERT_TRUE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+}
+
+TEST(LepusShadowEqualTest, RecordAgainAfterWrites) {
+  lepus::Value dic = lepus::Value(lepus::Dictionary::Create());
+  dic.SetProperty(base::String(bar), lepus::Value(1));
+  lepus::Value array = lepus::Value(lepus::CArray::Create());
+  array.Array()->push_back(lepus::Value(1));
+  auto target_map = lepus::Dictionary::Create();
+  target_map.get()->SetValue(base::String(foo), dic);
+  target_map.get()->SetValue(base::String(bar), array);
+  tasm::RenderedContainers rendered;
+  rendered.Record(lepus::Value(target_map));
+
+  // Recording again the unwritten target keeps the entries, the array
+  // written in place no longer matches its recorded generation.
+  array.Array()->push_back(lepus::Value(lepus::Dictionary::Create()));
+  rendered.Record(lepus::Value(target_map));
+  auto update_map = lepus::Dictionary::Create();
+  update_map.get()->SetValue(base::String(foo), dic);
+  ASSERT_FALSE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+  update_map.get()->SetValue(base::String(bar), array);
+  ASSERT_TRUE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+}
+
+TEST(LepusShadowEqualTest, TargetWrittenSinceRender) {
+  lepus::Value array = lepus::Value(lepus::CArray::Create());
+  array.Array()->push_back(lepus::Value(1));
+  auto target_map = lepus::Dictionary::Create();
+  tasm::RenderedContainers rendered;
+  rendered.Record(lepus::Value(target_map));
+
+  // The array is written into target after render and never rendered.
+  target_map.get()->SetValue(base::String(foo), array);
+  auto update_map = lepus::Dictionary::Create();
+  update_map.get()->SetValue(base::String(foo), array);
+
+  ASSERT_TRUE(tasm::CheckTableShadowUpdated(
+      lepus::Value(target_map), lepus::Value(update_map), &rendered));
+}
+
+TEST(LepusShadowEqualTest, MutationGeneration) {
+  auto dic = lepus::Dictionary::Create();
+  auto created = dic->generation();
+
+  // Const lookups and iteration are not writes.
+  const lepus::Dictionary& const_dic = *dic;
+  const_dic.find(base::String(foo));
+  for (auto it = const_dic.begin(); it != const_dic.end(); ++it) {
+  }
+  EXPECT_EQ(dic->generation(), created);
+
+  dic->SetValue(base::String(foo), lepus::Value(1));
+  EXPECT_EQ(dic->generation(), created + 1);
+  dic->Erase(base::String(foo));
+  EXPECT_EQ(dic->generation(), created + 2);
+
+  // Values may be written through non-const iterators.
+  dic->find(base::String(foo));
+  EXPECT_EQ(dic->generation(), created + 3);
+  dic->begin();
+  EXPECT_EQ(dic->generation(), created + 4);
+
+  // Generations are counted per container.
+  auto other = lepus::Dictionary::Create();
+  EXPECT_EQ(other->generation(), 0u);
+
+  auto array = lepus::CArray::Create();
+  auto array_created = array->generation();
+  array->resize(2);
+  EXPECT_GT(array->generation(), array_created);
+}
+
 TEST(LepusValueTest, MKVAL) {
   LEPUSValue catch_offset = LEPUS_MKVAL(LEPUS_TAG_CATCH_OFFSET, 3);
   ASSERT_TRUE(LEPUS_VALUE_GET_CATCH_OFFSET(catch_offset) == 3);
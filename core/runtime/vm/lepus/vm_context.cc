@@ -230,7 +230,7 @@ bool VMContext::UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
 }
 
 bool VMContext::CheckTableShadowUpdatedWithTopLevelVariable(
-    const lepus::Value& update) {
+    const lepus::Value& update, const tasm::RenderedContainers* rendered) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, VM_CONTEXT_CHECK_TABLE_SHADOW_UPDATED);
   bool enable_deep_check = false;
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
@@ -286,7 +286,8 @@ bool VMContext::CheckTableShadowUpdatedWithTopLevelVariable(
 
     lepus::Value update_item_value = update_data_iterator.second;
     if (!enable_deep_check &&
-        tasm::CheckTableValueNotEqual(*ptr, update_item_value)) {
+        tasm::CheckTableValueNotEqual(*ptr, update_item_value,
+                                      update_data_iterator.first, rendered)) {
       return true;
     }
 #if ENABLE_INSPECTOR && (ENABLE_TRACE_PERFETTO || ENABLE_TRACE_SYSTRACE)
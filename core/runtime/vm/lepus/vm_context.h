@@ -49,7 +49,8 @@ class VMContext : public Context {
   virtual bool UpdateTopLevelVariableByPath(base::Vector<std::string>& path,
                                             const Value& value) override;
   virtual bool CheckTableShadowUpdatedWithTopLevelVariable(
-      const lepus::Value& update) override;
+      const lepus::Value& update,
+      const tasm::RenderedContainers* rendered = nullptr) override;
 
   virtual void ResetTopLevelVariable() override;
   virtual void ResetTopLevelVariableByVal(const Value& val) override;
@@ -110,6 +111,20 @@ class VMContext : public Context {
   void SetClosureFix(bool val) { closure_fix_ = val; }
   bool GetClosureFix() { return closure_fix_; }
 
+  // Instructions generated for the chunks compiled in this context, and the
+  // ones CodeGenerator saved by folding constants and reading local operands
+  // in place. Only reported at encode time.
+  struct CompileStats {
+    size_t instruction_count{0};
+    size_t folded_instruction_count{0};
+    size_t elided_move_count{0};
+
+    size_t UnoptimizedInstructionCount() const {
+      return instruction_count + folded_instruction_count + elided_move_count;
+    }
+  };
+  const CompileStats& compile_stats() const { return compile_stats_; }
+
   inline Global* global() { return &global_; }
   inline Global* builtin() { return &builtin_; }
   void SetGlobalData(const base::String& name, Value value) override;
@@ -249,6 +264,7 @@ class VMContext : public Context {
   bool enable_top_var_strict_mode_;
   bool enable_null_prop_as_undef_ = false;
   bool closure_fix_ = false;
+  CompileStats compile_stats_;
 
   bool executed_ = false;
 
@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base/include/timer/time_utils.h"
+#include "base/trace/native/flight_recorder.h"
 #include "base/trace/native/trace_event.h"
 #include "core/base/thread/thread_utils.h"
 #include "core/base/threading/task_runner_manufactor.h"
@@ -30,6 +31,12 @@ LongTaskMonitor::LongTaskMonitor()
       long_batched_tasks_monitor_(
           LongBatchedTasksMonitor(thread_name_, duration_threshold_ms_)) {
   g_enabled = LynxEnv::GetInstance().EnableLongTaskTiming();
+  if (LynxEnv::GetInstance().EnableFlightRecorder()) {
+    auto& recorder = trace::FlightRecorder::Instance();
+    recorder.SetEnabled(true);
+    recorder.SetCurrentThreadName(thread_name_);
+    recorder.SetLongTaskDumpDir(LynxEnv::GetInstance().GetStorageDirectory());
+  }
 }
 
 void LongTaskMonitor::WillProcessTask(const std::string& type,
@@ -75,6 +82,14 @@ void LongTaskMonitor::DidProcessTask() {
           ctx.event()->add_debug_annotations(
               "duration_ms", std::to_string(timing.duration_ms_));
         });
+    if (trace::FlightRecorder::Instance().IsEnabled()) {
+      // Dump the engine activity that preceded the long task off the current
+      // thread.
+      tasm::report::EventTrackerPlatformImpl::GetReportTaskRunner()->PostTask(
+          [task_name = timing.task_name_] {
+            trace::FlightRecorder::Instance().NotifyLongTask(task_name);
+          });
+    }
     tasm::report::EventTrackerPlatformImpl::GetReportTaskRunner()->PostTask(
         [timing = std::move(timing),
          duration_threshold_ms = duration_threshold_ms_] {
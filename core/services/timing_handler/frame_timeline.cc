@@ -0,0 +1,266 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/timing_handler/frame_timeline.h"
+
+#include <algorithm>
+#include <utility>
+
+#include "base/include/no_destructor.h"
+#include "core/services/timing_handler/timing_utils.h"
+
+namespace lynx {
+namespace tasm {
+namespace timing {
+
+namespace {
+
+constexpr char kEntryTypeFrame[] = "frame";
+constexpr char kSequence[] = "sequence";
+constexpr char kPipelineID[] = "pipelineId";
+constexpr char kStart[] = "start";
+constexpr char kEnd[] = "end";
+constexpr char kMtsRenderDuration[] = "mtsRenderDuration";
+constexpr char kResolveDuration[] = "resolveDuration";
+constexpr char kLayoutDuration[] = "layoutDuration";
+constexpr char kUiOperationFlushDuration[] = "uiOperationFlushDuration";
+constexpr char kPlatformCommitDuration[] = "platformCommitDuration";
+constexpr char kAllocationCount[] = "allocationCount";
+constexpr char kElementCreatedCount[] = "elementCreatedCount";
+constexpr char kElementUpdatedCount[] = "elementUpdatedCount";
+constexpr char kElementRestyledCount[] = "elementRestyledCount";
+constexpr char kLayoutNodeMeasuredCount[] = "layoutNodeMeasuredCount";
+
+struct PhaseKey {
+  uint8_t phase;
+  bool is_start;
+};
+
+TimestampUs PhaseDuration(TimestampUs start, TimestampUs end) {
+  return start != 0 && end > start ? end - start : 0;
+}
+
+}  // namespace
+
+FrameTimeline::FrameTimeline(size_t capacity)
+    : capacity_(std::max<size_t>(capacity, 1)) {}
+
+void FrameTimeline::OnPipelineStart(const PipelineID& pipeline_id,
+                                    const PipelineOrigin& pipeline_origin,
+                                    TimestampUs pipeline_start_timestamp) {
+  auto* frame = FindOrCreatePending(pipeline_id);
+  if (frame == nullptr) {
+    return;
+  }
+  frame->entry.pipeline_origin = pipeline_origin;
+  frame->entry.start = pipeline_start_timestamp;
+}
+
+void FrameTimeline::OnTiming(const TimestampKey& timing_key,
+                             TimestampUs us_timestamp,
+                             const PipelineID& pipeline_id) {
+  static const base::NoDestructor<std::unordered_map<TimestampKey, PhaseKey>>
+      phase_keys{{
+          {kMtsRenderStart, {kPhaseMtsRender, true}},
+          {kMtsRenderEnd, {kPhaseMtsRender, false}},
+          {kResolveStart, {kPhaseResolve, true}},
+          {kResolveEnd, {kPhaseResolve, false}},
+          {kLayoutStart, {kPhaseLayout, true}},
+          {kLayoutEnd, {kPhaseLayout, false}},
+          {kPaintingUiOperationExecuteStart,
+           {kPhasePaintingUiOperation, true}},
+          {kPaintingUiOperationExecuteEnd,
+           {kPhasePaintingUiOperation, false}},
+          {kLayoutUiOperationExecuteStart, {kPhaseLayoutUiOperation, true}},
+          {kLayoutUiOperationExecuteEnd, {kPhaseLayoutUiOperation, false}},
+      }};
+
+  auto* frame = FindOrCreatePending(pipeline_id);
+  if (frame == nullptr || us_timestamp == 0) {
+    return;
+  }
+  auto it = phase_keys->find(timing_key);
+  if (it != phase_keys->end()) {
+    // A phase may run more than once in a pipeline, e.g. layout triggered by
+    // a list. The breakdown covers the first start to the last end.
+    const auto& [phase, is_start] = it->second;
+    if (is_start) {
+      auto& start = frame->phase_start[phase];
+      start = start == 0 ? us_timestamp : std::min(start, us_timestamp);
+    } else {
+      auto& end = frame->phase_end[phase];
+      end = std::max(end, us_timestamp);
+    }
+  } else if (timing_key == kPipelineStart) {
+    frame->entry.start = us_timestamp;
+  } else if (timing_key == kPipelineEnd) {
+    frame->pipeline_end = us_timestamp;
+  } else if (timing_key == kPaintEnd) {
+    frame->paint_end = us_timestamp;
+  } else {
+    return;
+  }
+  if (IsComplete(*frame)) {
+    Complete(pipeline_id);
+  }
+}
+
+void FrameTimeline::OnCounters(const PipelineID& pipeline_id,
+                               const FrameCounters& counters) {
+  if (pipeline_id.empty() || counters.empty()) {
+    return;
+  }
+  // Counters of a scope on another thread may be reported after the pipeline
+  // completed.
+  if (auto* entry = FindCompleted(pipeline_id); entry != nullptr) {
+    entry->counters.Add(counters);
+    return;
+  }
+  auto* frame = FindOrCreatePending(pipeline_id);
+  if (frame != nullptr) {
+    frame->entry.counters.Add(counters);
+  }
+}
+
+std::vector<FrameTimelineEntry> FrameTimeline::GetEntries(
+    uint64_t since_sequence) const {
+  std::vector<FrameTimelineEntry> result;
+  for (const auto& entry : entries_) {
+    if (entry.sequence > since_sequence) {
+      result.emplace_back(entry);
+    }
+  }
+  return result;
+}
+
+std::unique_ptr<pub::Value> FrameTimeline::GetEntriesAsPubValue(
+    const std::shared_ptr<pub::PubValueFactory>& value_factory,
+    uint64_t since_sequence) const {
+  if (!value_factory) {
+    return nullptr;
+  }
+  auto result = value_factory->CreateArray();
+  for (const auto& entry : entries_) {
+    if (entry.sequence <= since_sequence) {
+      continue;
+    }
+    auto map = value_factory->CreateMap();
+    map->PushStringToMap(kEntryType, kEntryTypeFrame);
+    map->PushStringToMap(kEntryName, entry.pipeline_origin);
+    map->PushUInt64ToMap(kSequence, entry.sequence);
+    map->PushStringToMap(kPipelineID, entry.pipeline_id);
+    map->PushDoubleToMap(kStart, ConvertUsToDouble(entry.start));
+    map->PushDoubleToMap(kEnd, ConvertUsToDouble(entry.end));
+    map->PushDoubleToMap(
+        kDuration, ConvertUsToDouble(PhaseDuration(entry.start, entry.end)));
+    map->PushDoubleToMap(kMtsRenderDuration,
+                         ConvertUsToDouble(entry.mts_render_duration));
+    map->PushDoubleToMap(kResolveDuration,
+                         ConvertUsToDouble(entry.resolve_duration));
+    map->PushDoubleToMap(kLayoutDuration,
+                         ConvertUsToDouble(entry.layout_duration));
+    map->PushDoubleToMap(kUiOperationFlushDuration,
+                         ConvertUsToDouble(entry.ui_operation_flush_duration));
+    map->PushDoubleToMap(kPlatformCommitDuration,
+                         ConvertUsToDouble(entry.platform_commit_duration));
+    map->PushUInt32ToMap(kAllocationCount,
+                         entry.counters.Get(FrameCounter::kAllocations));
+    map->PushUInt32ToMap(kElementCreatedCount,
+                         entry.counters.Get(FrameCounter::kElementsCreated));
+    map->PushUInt32ToMap(kElementUpdatedCount,
+                         entry.counters.Get(FrameCounter::kElementsUpdated));
+    map->PushUInt32ToMap(kElementRestyledCount,
+                         entry.counters.Get(FrameCounter::kElementsRestyled));
+    map->PushUInt32ToMap(
+        kLayoutNodeMeasuredCount,
+        entry.counters.Get(FrameCounter::kLayoutNodesMeasured));
+    result->PushValueToArray(std::move(map));
+  }
+  return result;
+}
+
+void FrameTimeline::Clear() {
+  entries_.clear();
+  pending_frames_.clear();
+  pending_order_.clear();
+}
+
+FrameTimeline::PendingFrame* FrameTimeline::FindOrCreatePending(
+    const PipelineID& pipeline_id) {
+  if (pipeline_id.empty()) {
+    return nullptr;
+  }
+  auto it = pending_frames_.find(pipeline_id);
+  if (it != pending_frames_.end()) {
+    return &it->second;
+  }
+  if (FindCompleted(pipeline_id) != nullptr) {
+    // Timings marked after the pipeline completed, e.g. a second paint end,
+    // do not start a new frame.
+    return nullptr;
+  }
+  while (pending_order_.size() >= kMaxPendingFrames) {
+    pending_frames_.erase(pending_order_.front());
+    pending_order_.pop_front();
+  }
+  pending_order_.emplace_back(pipeline_id);
+  auto& frame = pending_frames_[pipeline_id];
+  frame.entry.pipeline_id = pipeline_id;
+  return &frame;
+}
+
+bool FrameTimeline::IsComplete(const PendingFrame& frame) const {
+  return frame.paint_end != 0 && frame.pipeline_end != 0 &&
+         frame.phase_end[kPhaseLayout] != 0 &&
+         frame.phase_end[kPhaseLayoutUiOperation] != 0;
+}
+
+void FrameTimeline::Complete(const PipelineID& pipeline_id) {
+  auto it = pending_frames_.find(pipeline_id);
+  if (it == pending_frames_.end()) {
+    return;
+  }
+  auto& frame = it->second;
+  auto& entry = frame.entry;
+  entry.sequence = next_sequence_++;
+  entry.end = frame.paint_end;
+  entry.mts_render_duration = PhaseDuration(
+      frame.phase_start[kPhaseMtsRender], frame.phase_end[kPhaseMtsRender]);
+  entry.resolve_duration = PhaseDuration(frame.phase_start[kPhaseResolve],
+                                         frame.phase_end[kPhaseResolve]);
+  entry.layout_duration = PhaseDuration(frame.phase_start[kPhaseLayout],
+                                        frame.phase_end[kPhaseLayout]);
+  entry.ui_operation_flush_duration =
+      PhaseDuration(frame.phase_start[kPhasePaintingUiOperation],
+                    frame.phase_end[kPhasePaintingUiOperation]) +
+      PhaseDuration(frame.phase_start[kPhaseLayoutUiOperation],
+                    frame.phase_end[kPhaseLayoutUiOperation]);
+  entry.platform_commit_duration = PhaseDuration(
+      std::max(frame.phase_end[kPhasePaintingUiOperation],
+               frame.phase_end[kPhaseLayoutUiOperation]),
+      frame.paint_end);
+
+  if (entries_.size() >= capacity_) {
+    entries_.pop_front();
+  }
+  entries_.emplace_back(std::move(entry));
+  pending_frames_.erase(it);
+  pending_order_.erase(
+      std::find(pending_order_.begin(), pending_order_.end(), pipeline_id));
+}
+
+FrameTimelineEntry* FrameTimeline::FindCompleted(
+    const PipelineID& pipeline_id) {
+  // Late timings belong to the most recent frames.
+  for (auto it = entries_.rbegin(); it != entries_.rend(); ++it) {
+    if (it->pipeline_id == pipeline_id) {
+      return &*it;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace timing
+}  // namespace tasm
+}  // namespace lynx
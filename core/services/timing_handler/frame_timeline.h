@@ -0,0 +1,122 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_SERVICES_TIMING_HANDLER_FRAME_TIMELINE_H_
+#define CORE_SERVICES_TIMING_HANDLER_FRAME_TIMELINE_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/public/pipeline_option.h"
+#include "core/public/pub_value.h"
+#include "core/services/timing_handler/timing.h"
+#include "core/services/timing_handler/timing_constants.h"
+#include "core/services/timing_handler/timing_map.h"
+
+namespace lynx {
+namespace tasm {
+namespace timing {
+
+// The per phase breakdown of one pipeline.
+struct FrameTimelineEntry {
+  // Increases by one for every completed frame of the timeline.
+  uint64_t sequence{0};
+  PipelineID pipeline_id;
+  PipelineOrigin pipeline_origin;
+  TimestampUs start{0};
+  TimestampUs end{0};
+  // Durations of the phases, 0 if the phase did not run.
+  TimestampUs mts_render_duration{0};
+  TimestampUs resolve_duration{0};
+  TimestampUs layout_duration{0};
+  TimestampUs ui_operation_flush_duration{0};
+  // From the end of the UI operation flush to the paint end.
+  TimestampUs platform_commit_duration{0};
+  FrameCounters counters;
+};
+
+/**
+ * @class FrameTimeline
+ *
+ * Builds a FrameTimelineEntry for every pipeline from the timing keys of the
+ * phases and the counters reported with the timings, and keeps the completed
+ * entries in a bounded ring buffer. A pipeline completes under the same
+ * condition as the pipeline entry of the PerformanceObserver.
+ *
+ * Like the TimingHandler owning it, the class is not thread-safe and is used
+ * on the timing thread only.
+ */
+class FrameTimeline {
+ public:
+  static constexpr size_t kDefaultCapacity = 120;
+  // Pipelines which never complete, e.g. those without UI changes, are dropped
+  // once there are more pending ones.
+  static constexpr size_t kMaxPendingFrames = 32;
+
+  explicit FrameTimeline(size_t capacity = kDefaultCapacity);
+
+  void OnPipelineStart(const PipelineID& pipeline_id,
+                       const PipelineOrigin& pipeline_origin,
+                       TimestampUs pipeline_start_timestamp);
+  void OnTiming(const TimestampKey& timing_key, TimestampUs us_timestamp,
+                const PipelineID& pipeline_id);
+  void OnCounters(const PipelineID& pipeline_id,
+                  const FrameCounters& counters);
+
+  // The completed entries with a sequence greater than |since_sequence|,
+  // oldest first.
+  std::vector<FrameTimelineEntry> GetEntries(
+      uint64_t since_sequence = 0) const;
+  std::unique_ptr<pub::Value> GetEntriesAsPubValue(
+      const std::shared_ptr<pub::PubValueFactory>& value_factory,
+      uint64_t since_sequence = 0) const;
+
+  void Clear();
+
+  size_t capacity() const { return capacity_; }
+  size_t size() const { return entries_.size(); }
+  size_t pending_size() const { return pending_frames_.size(); }
+
+ private:
+  enum Phase : uint8_t {
+    kPhaseMtsRender = 0,
+    kPhaseResolve,
+    kPhaseLayout,
+    kPhasePaintingUiOperation,
+    kPhaseLayoutUiOperation,
+    kPhaseCount,
+  };
+
+  struct PendingFrame {
+    FrameTimelineEntry entry;
+    TimestampUs phase_start[kPhaseCount] = {};
+    TimestampUs phase_end[kPhaseCount] = {};
+    TimestampUs pipeline_end{0};
+    TimestampUs paint_end{0};
+  };
+
+  PendingFrame* FindOrCreatePending(const PipelineID& pipeline_id);
+  bool IsComplete(const PendingFrame& frame) const;
+  void Complete(const PipelineID& pipeline_id);
+  FrameTimelineEntry* FindCompleted(const PipelineID& pipeline_id);
+
+  size_t capacity_;
+  uint64_t next_sequence_{1};
+  // Completed entries, oldest first.
+  std::deque<FrameTimelineEntry> entries_;
+  std::unordered_map<PipelineID, PendingFrame> pending_frames_;
+  // Pending pipelines in the order they were seen.
+  std::deque<PipelineID> pending_order_;
+};
+
+}  // namespace timing
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_SERVICES_TIMING_HANDLER_FRAME_TIMELINE_H_
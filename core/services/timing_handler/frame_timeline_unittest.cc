@@ -0,0 +1,153 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/services/timing_handler/frame_timeline.h"
+
+#include <string>
+#include <thread>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace timing {
+namespace test {
+
+namespace {
+
+void MarkPipeline(FrameTimeline& timeline, const PipelineID& id,
+                  TimestampUs start) {
+  timeline.OnPipelineStart(id, kUpdateTriggeredByNative, start);
+  timeline.OnTiming(kMtsRenderStart, start + 10, id);
+  timeline.OnTiming(kMtsRenderEnd, start + 110, id);
+  timeline.OnTiming(kResolveStart, start + 120, id);
+  timeline.OnTiming(kResolveEnd, start + 170, id);
+  timeline.OnTiming(kPaintingUiOperationExecuteStart, start + 180, id);
+  timeline.OnTiming(kPaintingUiOperationExecuteEnd, start + 200, id);
+  timeline.OnTiming(kPipelineEnd, start + 200, id);
+  timeline.OnTiming(kLayoutStart, start + 210, id);
+  timeline.OnTiming(kLayoutEnd, start + 290, id);
+  timeline.OnTiming(kLayoutUiOperationExecuteStart, start + 300, id);
+  timeline.OnTiming(kLayoutUiOperationExecuteEnd, start + 330, id);
+}
+
+struct CountersDelegate {
+  void SetTiming(Timing timing) { counters = timing.counters_; }
+
+  FrameCounters counters;
+};
+
+}  // namespace
+
+TEST(FrameTimelineTest, CountersOfThreadsWithoutScope) {
+  CountersDelegate delegate;
+  {
+    TimingCollector::Scope<CountersDelegate> scope(&delegate, "p1");
+    TimingCollector::Instance()->Count(FrameCounter::kElementsCreated);
+    std::thread worker([]() {
+      TimingCollector::Instance()->Count(FrameCounter::kElementsRestyled, 2);
+    });
+    worker.join();
+  }
+  EXPECT_EQ(delegate.counters.Get(FrameCounter::kElementsCreated), 1u);
+  EXPECT_EQ(delegate.counters.Get(FrameCounter::kElementsRestyled), 2u);
+
+  // Merged only once.
+  {
+    TimingCollector::Scope<CountersDelegate> scope(&delegate, "p2");
+  }
+  EXPECT_TRUE(delegate.counters.empty());
+}
+
+TEST(FrameTimelineTest, BreakdownOfCompletedPipeline) {
+  FrameTimeline timeline;
+  MarkPipeline(timeline, "p1", 1000);
+  FrameCounters counters;
+  counters.Add(FrameCounter::kElementsCreated, 3);
+  counters.Add(FrameCounter::kAllocations, 5);
+  timeline.OnCounters("p1", counters);
+  EXPECT_EQ(timeline.size(), 0u);
+  EXPECT_EQ(timeline.pending_size(), 1u);
+
+  timeline.OnTiming(kPaintEnd, 1400, "p1");
+  ASSERT_EQ(timeline.size(), 1u);
+  EXPECT_EQ(timeline.pending_size(), 0u);
+
+  auto entries = timeline.GetEntries();
+  ASSERT_EQ(entries.size(), 1u);
+  const auto& entry = entries[0];
+  EXPECT_EQ(entry.sequence, 1u);
+  EXPECT_EQ(entry.pipeline_id, "p1");
+  EXPECT_EQ(entry.pipeline_origin, kUpdateTriggeredByNative);
+  EXPECT_EQ(entry.start, 1000u);
+  EXPECT_EQ(entry.end, 1400u);
+  EXPECT_EQ(entry.mts_render_duration, 100u);
+  EXPECT_EQ(entry.resolve_duration, 50u);
+  EXPECT_EQ(entry.layout_duration, 80u);
+  EXPECT_EQ(entry.ui_operation_flush_duration, 50u);
+  EXPECT_EQ(entry.platform_commit_duration, 70u);
+  EXPECT_EQ(entry.counters.Get(FrameCounter::kElementsCreated), 3u);
+  EXPECT_EQ(entry.counters.Get(FrameCounter::kAllocations), 5u);
+  EXPECT_EQ(entry.counters.Get(FrameCounter::kLayoutNodesMeasured), 0u);
+}
+
+TEST(FrameTimelineTest, LateTimingsAndCounters) {
+  FrameTimeline timeline;
+  MarkPipeline(timeline, "p1", 1000);
+  timeline.OnTiming(kPaintEnd, 1400, "p1");
+  ASSERT_EQ(timeline.size(), 1u);
+
+  // Counters of the layout scope reported after the paint end are merged into
+  // the completed frame.
+  FrameCounters counters;
+  counters.Add(FrameCounter::kLayoutNodesMeasured, 2);
+  timeline.OnCounters("p1", counters);
+  // A second paint end does not start a new frame.
+  timeline.OnTiming(kPaintEnd, 1500, "p1");
+
+  EXPECT_EQ(timeline.pending_size(), 0u);
+  auto entries = timeline.GetEntries();
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].end, 1400u);
+  EXPECT_EQ(entries[0].counters.Get(FrameCounter::kLayoutNodesMeasured), 2u);
+}
+
+TEST(FrameTimelineTest, RingBufferIsBounded) {
+  FrameTimeline timeline(2);
+  for (int i = 0; i < 3; ++i) {
+    auto id = "p" + std::to_string(i);
+    MarkPipeline(timeline, id, 1000 * (i + 1));
+    timeline.OnTiming(kPaintEnd, 1000 * (i + 1) + 400, id);
+  }
+  auto entries = timeline.GetEntries();
+  ASSERT_EQ(entries.size(), 2u);
+  EXPECT_EQ(entries[0].pipeline_id, "p1");
+  EXPECT_EQ(entries[0].sequence, 2u);
+  EXPECT_EQ(entries[1].pipeline_id, "p2");
+
+  entries = timeline.GetEntries(2);
+  ASSERT_EQ(entries.size(), 1u);
+  EXPECT_EQ(entries[0].sequence, 3u);
+  EXPECT_TRUE(timeline.GetEntries(3).empty());
+}
+
+TEST(FrameTimelineTest, PendingFramesAreBounded) {
+  FrameTimeline timeline;
+  for (size_t i = 0; i < FrameTimeline::kMaxPendingFrames + 8; ++i) {
+    timeline.OnTiming(kPipelineStart, 1000, "p" + std::to_string(i));
+  }
+  EXPECT_EQ(timeline.pending_size(), FrameTimeline::kMaxPendingFrames);
+  // Timings without a pipeline are ignored.
+  timeline.OnTiming(kLayoutStart, 1000, "");
+  EXPECT_EQ(timeline.pending_size(), FrameTimeline::kMaxPendingFrames);
+
+  timeline.Clear();
+  EXPECT_EQ(timeline.pending_size(), 0u);
+  EXPECT_EQ(timeline.size(), 0u);
+}
+
+}  // namespace test
+}  // namespace timing
+}  // namespace tasm
+}  // namespace lynx
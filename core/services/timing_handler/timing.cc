@@ -10,11 +10,23 @@
 namespace lynx {
 namespace tasm {
 
+std::atomic<uint32_t>
+    TimingCollector::unscoped_counters_[FrameCounters::kSize] = {};
+
 TimingCollector* TimingCollector::Instance() {
   static thread_local TimingCollector instance_;
   return &instance_;
 }
 
+void TimingCollector::TakeUnscopedCounters(FrameCounters& counters) {
+  for (size_t i = 0; i < FrameCounters::kSize; ++i) {
+    if (unscoped_counters_[i].load(std::memory_order_relaxed) != 0) {
+      counters.values[i] +=
+          unscoped_counters_[i].exchange(0, std::memory_order_relaxed);
+    }
+  }
+}
+
 void TimingCollector::Mark(const TimingKey& key, uint64_t timestamp) {
   // If timing_stack_ is empty, no processing is required
   if (timing_stack_.empty()) {
@@ -5,7 +5,9 @@
 #ifndef CORE_SERVICES_TIMING_HANDLER_TIMING_H_
 #define CORE_SERVICES_TIMING_HANDLER_TIMING_H_
 
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -35,6 +37,48 @@ using TimingMap = base::LinkedHashMap<TimingKey, uint64_t>;
 // Initialize the timing map with larger allocation size.
 constexpr size_t kTimingMapAllocationSize = 16;
 
+// Work done while the timing scope of a pipeline is on top of the stack. The
+// counters are reported with the timings of the scope and aggregated per
+// pipeline by the FrameTimeline. Work on threads without a scope, e.g. the
+// workers of the parallel flush, is merged into the next scope that ends.
+enum class FrameCounter : uint8_t {
+  // Elements and layout nodes allocated through the ElementArena.
+  kAllocations = 0,
+  kElementsCreated,
+  kElementsUpdated,
+  // Elements whose own styles were resolved again from the style sheets.
+  kElementsRestyled,
+  // Calls of the platform measure functions of layout nodes.
+  kLayoutNodesMeasured,
+  kCount,
+};
+
+struct FrameCounters {
+  static constexpr size_t kSize = static_cast<size_t>(FrameCounter::kCount);
+
+  uint32_t values[kSize] = {};
+
+  uint32_t Get(FrameCounter counter) const {
+    return values[static_cast<size_t>(counter)];
+  }
+  void Add(FrameCounter counter, uint32_t count) {
+    values[static_cast<size_t>(counter)] += count;
+  }
+  void Add(const FrameCounters& other) {
+    for (size_t i = 0; i < kSize; ++i) {
+      values[i] += other.values[i];
+    }
+  }
+  bool empty() const {
+    for (size_t i = 0; i < kSize; ++i) {
+      if (values[i] != 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+};
+
 class Timing {
  public:
   explicit Timing(const PipelineID& pipeline_id = "")
@@ -46,6 +90,7 @@ class Timing {
 
   TimingMap timings_{kTimingMapAllocationSize};
   TimingMap framework_timings_{kTimingMapAllocationSize};
+  FrameCounters counters_;
   PipelineID pipeline_id_;
 };
 
@@ -71,6 +116,7 @@ class TimingCollector {
     ~Scope() {
       if (delegate_ptr_ != nullptr) {
         auto& timing = TimingCollector::Instance()->timing_stack_.top();
+        TakeUnscopedCounters(timing.counters_);
         delegate_ptr_->SetTiming(std::move(timing));
       }
       TimingCollector::Instance()->timing_stack_.pop();
@@ -91,6 +137,17 @@ class TimingCollector {
   void MarkFrameworkTiming(const TimingKey& key, uint64_t timestamp = 0);
   PipelineID GetTopPipelineID();
 
+  // Counts work for the pipeline of the top scope, or for the next scope that
+  // ends if there is no scope on the current thread.
+  void Count(FrameCounter counter, uint32_t count = 1) {
+    if (!timing_stack_.empty()) {
+      timing_stack_.top().counters_.Add(counter, count);
+      return;
+    }
+    unscoped_counters_[static_cast<size_t>(counter)].fetch_add(
+        count, std::memory_order_relaxed);
+  }
+
   TimingCollector(){};
   TimingCollector(const TimingCollector& timing) = delete;
   TimingCollector& operator=(const TimingCollector&) = delete;
@@ -98,7 +155,11 @@ class TimingCollector {
   TimingCollector& operator=(TimingCollector&&) = delete;
 
  private:
+  static void TakeUnscopedCounters(FrameCounters& counters);
+
   base::InlineStack<Timing, 16> timing_stack_;
+  // Shared by all threads, the collector itself is thread local.
+  static std::atomic<uint32_t> unscoped_counters_[FrameCounters::kSize];
   // Used to mark the loadTemplate/reloadTemplate start time. should be
   // consistent with SETUP_TIMING_FLAG_PREFIX of TimingHandler in platform.
   static const std::string SETUP_TIMING_FLAG_PREFIX;
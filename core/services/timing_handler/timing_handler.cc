@@ -9,6 +9,7 @@
 
 #include "base/include/log/logging.h"
 #include "base/include/string/string_utils.h"
+#include "core/renderer/utils/lynx_env.h"
 #include "core/services/timing_handler/timing_constants.h"
 #include "core/services/timing_handler/timing_constants_deprecated.h"
 #include "core/services/timing_handler/timing_handler_delegate.h"
@@ -20,10 +21,13 @@ namespace timing {
 
 TimingHandler::TimingHandler(std::unique_ptr<TimingHandlerDelegate> delegate,
                              performance::PerformanceEventSender* sender)
-    : handler_ng_(sender), delegate_(std::move(delegate)) {
+    : handler_ng_(sender), sender_(sender), delegate_(std::move(delegate)) {
   if (delegate_) {
     timing_info_.SetValueFactory(delegate_->GetValueFactory());
   }
+  if (LynxEnv::GetInstance().EnableFrameTimeline()) {
+    frame_timeline_ = std::make_unique<FrameTimeline>();
+  }
 }
 
 void TimingHandler::OnPipelineStart(const PipelineID& pipeline_id,
@@ -32,6 +36,10 @@ void TimingHandler::OnPipelineStart(const PipelineID& pipeline_id,
   pipeline_id_to_origin_map_.emplace(pipeline_id, pipeline_origin);
   handler_ng_.OnPipelineStart(pipeline_id, pipeline_origin,
                               pipeline_start_timestamp);
+  if (frame_timeline_) {
+    frame_timeline_->OnPipelineStart(pipeline_id, pipeline_origin,
+                                     pipeline_start_timestamp);
+  }
 
   std::string start_time_key(kPipelineStart);
   SetTiming(start_time_key, pipeline_start_timestamp, pipeline_id);
@@ -49,6 +57,9 @@ void TimingHandler::BindPipelineIDWithTimingFlag(
 
 // Methods for setting timing information.
 void TimingHandler::SetTiming(tasm::Timing timing) {
+  if (frame_timeline_) {
+    frame_timeline_->OnCounters(timing.pipeline_id_, timing.counters_);
+  }
   for (auto& [timing_key, timestamp] : timing.framework_timings_) {
     SetFrameworkTiming(timing_key, timestamp, timing.pipeline_id_);
   }
@@ -87,6 +98,9 @@ void TimingHandler::SetTiming(TimestampKey& timing_key,
     return;
   }
   handler_ng_.SetTiming(timing_key, us_timestamp, pipeline_id);
+  if (frame_timeline_) {
+    frame_timeline_->OnTiming(timing_key, us_timestamp, pipeline_id);
+  }
 
   TimestampKey polyfillKey = "";
   if (!TryUpdatePolyfillTimingKey(timing_key, polyfillKey)) {
@@ -272,6 +286,15 @@ std::unique_ptr<lynx::pub::Value> TimingHandler::GetAllTimingInfo() const {
   return timing_info_.GetAllTimingInfoAsMicrosecond();
 }
 
+std::unique_ptr<lynx::pub::Value> TimingHandler::GetFrameTimeline(
+    uint64_t since_sequence) const {
+  if (!frame_timeline_ || sender_ == nullptr) {
+    return nullptr;
+  }
+  return frame_timeline_->GetEntriesAsPubValue(sender_->GetValueFactory(),
+                                               since_sequence);
+}
+
 // Reset all timing information.
 void TimingHandler::ResetTimingBeforeReload() {
   ClearPipelineTimingInfo();
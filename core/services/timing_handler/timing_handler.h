@@ -17,6 +17,7 @@
 #include "base/include/vector.h"
 #include "core/public/pipeline_option.h"
 #include "core/services/performance/performance_event_sender.h"
+#include "core/services/timing_handler/frame_timeline.h"
 #include "core/services/timing_handler/timing.h"
 #include "core/services/timing_handler/timing_handler_delegate.h"
 #include "core/services/timing_handler/timing_handler_ng.h"
@@ -128,6 +129,12 @@ class TimingHandler {
   // Retrieves all timing information.
   std::unique_ptr<lynx::pub::Value> GetAllTimingInfo() const;
 
+  // Retrieves the frames of the FrameTimeline completed after
+  // |since_sequence|. Returns nullptr if the timeline is disabled.
+  std::unique_ptr<lynx::pub::Value> GetFrameTimeline(
+      uint64_t since_sequence = 0) const;
+  FrameTimeline* frame_timeline() { return frame_timeline_.get(); }
+
   // Setter methods for various properties related to timing.
   inline void SetEnableJSRuntime(bool enable_js_runtime) {
     timing_info_.SetEnableJSRuntime(enable_js_runtime);
@@ -152,6 +159,9 @@ class TimingHandler {
 
  private:
   TimingHandlerNg handler_ng_;
+  performance::PerformanceEventSender* sender_;
+  // Null unless the enable_frame_timeline switch is on.
+  std::unique_ptr<FrameTimeline> frame_timeline_;
   // Internal storage and delegate for timing information.
   TimingInfo timing_info_;
   std::vector<tasm::PipelineID> pending_paint_end_pipeline_ids_queue_;
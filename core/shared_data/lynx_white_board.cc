@@ -13,6 +13,16 @@
 namespace lynx {
 namespace tasm {
 
+void WhiteBoardBatch::Set(const std::string& key,
+                          std::shared_ptr<pub::Value> value) {
+  auto result = index_.emplace(key, updates_.size());
+  if (result.second) {
+    updates_.emplace_back(key, std::move(value));
+  } else {
+    updates_[result.first->second].second = std::move(value);
+  }
+}
+
 WhiteBoard::WhiteBoard()
     : listeners_{static_cast<uint8_t>(WhiteBoardStorageType::COUNT)} {
   data_center_lock_ =
@@ -30,14 +40,9 @@ WhiteBoard::WhiteBoard()
 
 void WhiteBoard::SetGlobalSharedData(const std::string& key,
                                      const std::shared_ptr<pub::Value>& value) {
-  {
-    fml::UniqueLock lock(*data_center_lock_);
-    data_center_[key] = value;
-  }
-
-  TriggerListener(WhiteBoardStorageType::TYPE_LEPUS, key, *value);
-  TriggerListener(WhiteBoardStorageType::TYPE_CLIENT, key, *value);
-  TriggerListener(WhiteBoardStorageType::TYPE_JS, key, *value);
+  WhiteBoardBatch batch;
+  batch.Set(key, value);
+  Commit(std::move(batch));
 }
 
 std::shared_ptr<pub::Value> WhiteBoard::GetGlobalSharedData(
@@ -50,6 +55,38 @@ std::shared_ptr<pub::Value> WhiteBoard::GetGlobalSharedData(
   return nullptr;
 }
 
+void WhiteBoard::Commit(WhiteBoardBatch batch) {
+  if (batch.empty()) {
+    return;
+  }
+  {
+    fml::UniqueLock lock(*data_center_lock_);
+    for (const auto& update : batch.updates_) {
+      data_center_[update.first] = update.second;
+    }
+    ++version_;
+  }
+
+  for (const auto& update : batch.updates_) {
+    TriggerListener(WhiteBoardStorageType::TYPE_LEPUS, update.first,
+                    *update.second);
+    TriggerListener(WhiteBoardStorageType::TYPE_CLIENT, update.first,
+                    *update.second);
+    TriggerListener(WhiteBoardStorageType::TYPE_JS, update.first,
+                    *update.second);
+  }
+}
+
+WhiteBoard::Snapshot WhiteBoard::GetSnapshot() const {
+  fml::SharedLock lock(*data_center_lock_);
+  return Snapshot{version_, data_center_};
+}
+
+uint64_t WhiteBoard::version() const {
+  fml::SharedLock lock(*data_center_lock_);
+  return version_;
+}
+
 void WhiteBoard::TriggerListener(const WhiteBoardStorageType& type,
                                  const std::string& key,
                                  const pub::Value& value) {
@@ -5,9 +5,11 @@
 #ifndef CORE_SHARED_DATA_LYNX_WHITE_BOARD_H_
 #define CORE_SHARED_DATA_LYNX_WHITE_BOARD_H_
 
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "base/include/closure.h"
@@ -19,9 +21,10 @@ namespace tasm {
 
 /**
  WhiteBoard is a DataCenter that can be shared and operated by multi LynxViews,
- it is not thread-safe, should be operated only on TASM thread Now. users can
- `set` `get` `registerListener` to whiteboard for sharing data between multiple
- lynxViews.
+ users can `set` `get` `registerListener` to whiteboard for sharing data
+ between multiple lynxViews. Updates are committed in batches, each commit
+ increases the version of the data. Listeners are invoked on the thread that
+ commits the change.
  */
 enum class WhiteBoardStorageType : uint8_t {
   TYPE_LEPUS = 0,
@@ -40,6 +43,23 @@ struct WhiteBoardListener {
   base::MoveOnlyClosure<void> remove_callback;
 };
 
+// A set of updates committed to the WhiteBoard at once. Updating a key twice
+// keeps the last value only.
+class WhiteBoardBatch {
+ public:
+  void Set(const std::string& key, std::shared_ptr<pub::Value> value);
+
+  bool empty() const { return updates_.empty(); }
+  size_t size() const { return updates_.size(); }
+
+ private:
+  friend class WhiteBoard;
+
+  // In the order the keys were first set.
+  std::vector<std::pair<std::string, std::shared_ptr<pub::Value>>> updates_;
+  std::unordered_map<std::string, size_t> index_;
+};
+
 class WhiteBoardDelegate;
 class WhiteBoard final {
  public:
@@ -49,11 +69,29 @@ class WhiteBoard final {
   WhiteBoard(WhiteBoard&&) = delete;
   WhiteBoard& operator=(WhiteBoard&&) = delete;
 
-  // set & get operation
+  using LynxWhiteBoardMap =
+      std::unordered_map<std::string, std::shared_ptr<pub::Value>>;
+
+  // A copy of the data, version is increased by every commit.
+  struct Snapshot {
+    uint64_t version{0};
+    LynxWhiteBoardMap data;
+  };
+
+  // set & get operation, a set is committed as a single entry batch.
   void SetGlobalSharedData(const std::string& key,
                            const std::shared_ptr<pub::Value>& value);
   std::shared_ptr<pub::Value> GetGlobalSharedData(const std::string& key);
 
+  // Applies all the updates of batch at once, then notifies every listener
+  // of an updated key once with the committed value.
+  void Commit(WhiteBoardBatch batch);
+
+  // Copies the data, consistent with the version. Meant for debugging and
+  // tests, use GetGlobalSharedData() to read a key.
+  Snapshot GetSnapshot() const;
+  uint64_t version() const;
+
   // subscribe & unsubscribe operation
   void RegisterSharedDataListener(const WhiteBoardStorageType& type,
                                   const std::string& key,
@@ -64,16 +102,15 @@ class WhiteBoard final {
   ~WhiteBoard() = default;
 
  private:
-  using LynxWhiteBoardMap =
-      std::unordered_map<std::string, std::shared_ptr<pub::Value>>;
   using WhiteBoardListenerMap =
       std::unordered_map<std::string, std::vector<WhiteBoardListener>>;
 
   void TriggerListener(const WhiteBoardStorageType& type,
                        const std::string& key, const pub::Value& value);
 
-  LynxWhiteBoardMap data_center_;
   std::unique_ptr<fml::SharedMutex> data_center_lock_;
+  LynxWhiteBoardMap data_center_;
+  uint64_t version_{0};
   std::unordered_map<WhiteBoardStorageType, std::unique_ptr<fml::SharedMutex>>
       listener_lock_;
   std::vector<WhiteBoardListenerMap> listeners_;
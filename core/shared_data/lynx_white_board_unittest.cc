@@ -73,6 +73,61 @@ TEST_F(LynxWhiteBoardTest, RegisterJSSharedDataListenerRule0) {
                                          key.c_str(), std::move(listener));
 }
 
+TEST_F(LynxWhiteBoardTest, CommitBatchNotifiesOncePerKey) {
+  WhiteBoard white_board;
+  int name_calls = 0;
+  int age_calls = 0;
+  lepus::Value last_name;
+  white_board.RegisterSharedDataListener(
+      WhiteBoardStorageType::TYPE_LEPUS, "name",
+      {0,
+       [&](const pub::Value& value) {
+         ++name_calls;
+         last_name = pub::ValueUtils::ConvertValueToLepusValue(value);
+       },
+       []() {}});
+  white_board.RegisterSharedDataListener(
+      WhiteBoardStorageType::TYPE_JS, "age",
+      {1, [&](const pub::Value& value) { ++age_calls; }, []() {}});
+
+  const auto initial_version = white_board.version();
+  WhiteBoardBatch batch;
+  batch.Set("name", std::make_shared<pub::ValueImplLepus>(lepus::Value("a")));
+  batch.Set("age", std::make_shared<pub::ValueImplLepus>(lepus::Value(1)));
+  batch.Set("name", std::make_shared<pub::ValueImplLepus>(lepus::Value("b")));
+  EXPECT_EQ(batch.size(), static_cast<size_t>(2));
+  white_board.Commit(std::move(batch));
+
+  EXPECT_EQ(name_calls, 1);
+  EXPECT_EQ(age_calls, 1);
+  EXPECT_EQ(last_name, lepus::Value("b"));
+  EXPECT_EQ(white_board.version(), initial_version + 1);
+
+  white_board.Commit(WhiteBoardBatch());
+  EXPECT_EQ(white_board.version(), initial_version + 1);
+}
+
+TEST_F(LynxWhiteBoardTest, SnapshotIsACopy) {
+  WhiteBoard white_board;
+  white_board.SetGlobalSharedData(
+      "name", std::make_shared<pub::ValueImplLepus>(lepus::Value("a")));
+  auto snapshot = white_board.GetSnapshot();
+
+  white_board.SetGlobalSharedData(
+      "name", std::make_shared<pub::ValueImplLepus>(lepus::Value("b")));
+  white_board.SetGlobalSharedData(
+      "other", std::make_shared<pub::ValueImplLepus>(lepus::Value("c")));
+
+  EXPECT_EQ(snapshot.data.size(), static_cast<size_t>(1));
+  EXPECT_EQ(pub::ValueUtils::ConvertValueToLepusValue(
+                *snapshot.data.at("name")),
+            lepus::Value("a"));
+  EXPECT_EQ(white_board.GetSnapshot().version, snapshot.version + 2);
+  EXPECT_EQ(pub::ValueUtils::ConvertValueToLepusValue(
+                *white_board.GetGlobalSharedData("name")),
+            lepus::Value("b"));
+}
+
 TEST(WhiteBoardTasmDelegateTest, TestCallLepusCallbackWithValue) {
   TemplateAssembler* tasm = nullptr;
   std::shared_ptr<WhiteBoard> white_board;
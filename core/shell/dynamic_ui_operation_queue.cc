@@ -82,6 +82,12 @@ void DynamicUIOperationQueue::SetPageOptions(const tasm::PageOptions& options) {
   impl_->SetPageOptions(options);
 }
 
+void DynamicUIOperationQueue::SetFrameScheduler(
+    std::shared_ptr<base::FrameScheduler> frame_scheduler) {
+  frame_scheduler_ = std::move(frame_scheduler);
+  impl_->SetFrameScheduler(frame_scheduler_);
+}
+
 uint32_t DynamicUIOperationQueue::GetNativeUpdateDataOrder() {
   return impl_->GetNativeUpdateDataOrder();
 }
@@ -95,6 +101,7 @@ void DynamicUIOperationQueue::CreateImpl() {
               ? std::make_shared<shell::LynxUIOperationAsyncQueue>(ui_runner_,
                                                                    instance_id_)
               : std::make_shared<shell::LynxUIOperationQueue>(instance_id_);
+  impl_->SetFrameScheduler(frame_scheduler_);
 }
 
 }  // namespace shell
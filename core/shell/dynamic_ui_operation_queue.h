@@ -36,6 +36,8 @@ class DynamicUIOperationQueue {
   void SetEnableFlush(bool enable_flush);
   void SetErrorCallback(ErrorCallback callback);
   void SetPageOptions(const tasm::PageOptions& options);
+  // Kept across Transfer(), see LynxUIOperationQueue::SetFrameScheduler().
+  void SetFrameScheduler(std::shared_ptr<base::FrameScheduler> frame_scheduler);
   uint32_t GetNativeUpdateDataOrder();
   uint32_t UpdateNativeUpdateDataOrder();
 
@@ -46,6 +48,8 @@ class DynamicUIOperationQueue {
 
   std::shared_ptr<LynxUIOperationQueue> impl_;
 
+  std::shared_ptr<base::FrameScheduler> frame_scheduler_;
+
   const fml::RefPtr<fml::TaskRunner> ui_runner_;
 
   const int32_t instance_id_;
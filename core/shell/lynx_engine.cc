@@ -77,7 +77,8 @@ void LynxEngine::LoadTemplate(
     const std::string& url, std::vector<uint8_t> source,
     const std::shared_ptr<tasm::TemplateData>& template_data,
     std::shared_ptr<tasm::PipelineOptions> pipeline_options,
-    const bool enable_pre_painting, bool enable_recycle_template_bundle) {
+    const bool enable_pre_painting, bool enable_recycle_template_bundle,
+    std::string bundle_digest) {
   TRACE_EVENT(LYNX_TRACE_CATEGORY, LYNX_ENGINE_LOAD_TEMPLATE, "url", url,
               INSTANCE_ID, instance_id_);
   tasm::TimingCollector::Scope<Delegate> scope(delegate_.get(),
@@ -87,7 +88,8 @@ void LynxEngine::LoadTemplate(
       tasm_->GetPageOptions(), tasm::timing::kLoadTemplateTask,
       tasm::timing::kTaskNameLynxEngineLoadTemplate);
   tasm_->LoadTemplate(url, std::move(source), template_data, pipeline_options,
-                      enable_pre_painting, enable_recycle_template_bundle);
+                      enable_pre_painting, enable_recycle_template_bundle,
+                      std::move(bundle_digest));
 }
 
 void LynxEngine::LoadTemplateBundle(
@@ -571,6 +573,13 @@ void LynxEngine::UpdateI18nResource(const std::string& key,
   tasm_->UpdateI18nResource(key, new_data);
 }
 
+void LynxEngine::TrimListReusePools() {
+  if (tasm_ == nullptr) {
+    return;
+  }
+  tasm_->page_proxy()->TrimListReusePools();
+}
+
 void LynxEngine::Flush() {
   if (tasm_ != nullptr &&
       !tasm_->GetPageOptions()
@@ -672,6 +681,11 @@ void LynxEngine::GetJSSessionStorage(const std::string& key,
   }
 }
 
+void LynxEngine::CallJSApiCallbackWithValue(const piper::ApiCallBack& callback,
+                                            const lepus::Value& value) {
+  delegate_->CallJSApiCallbackWithValue(callback, value);
+}
+
 void LynxEngine::SubscribeJSSessionStorage(const std::string& key,
                                            double listener_id,
                                            const piper::ApiCallBack& callback) {
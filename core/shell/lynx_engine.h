@@ -64,7 +64,8 @@ class LynxEngine {
                     const std::shared_ptr<tasm::TemplateData>& template_data,
                     std::shared_ptr<tasm::PipelineOptions> pipeline_options,
                     const bool enable_pre_painting = false,
-                    bool enable_recycle_template_bundle = false);
+                    bool enable_recycle_template_bundle = false,
+                    std::string bundle_digest = std::string());
 
   void LoadTemplateBundle(
       const std::string& url, tasm::LynxTemplateBundle template_bundle,
@@ -254,6 +255,8 @@ class LynxEngine {
 
   void UpdateI18nResource(const std::string& key, const std::string& new_data);
 
+  void TrimListReusePools();
+
   void Flush();
 
   void InvokeUIMethod(const tasm::NodeSelectRoot& root,
@@ -301,6 +304,9 @@ class LynxEngine {
   void SubscribeJSSessionStorage(const std::string&, double listener_id,
                                  const piper::ApiCallBack& callback);
 
+  void CallJSApiCallbackWithValue(const piper::ApiCallBack& callback,
+                                  const lepus::Value& value);
+
   void SetClientSessionStorage(const std::string& key,
                                const lepus::Value& data);
 
@@ -27,6 +27,8 @@
 #include "core/shell/runtime_mediator.h"
 #include "core/shell/runtime_standalone_helper.h"
 #include "core/shell/tasm_operation_queue_async.h"
+#include "core/template_bundle/parsed_style_disk_cache.h"
+#include "core/template_bundle/template_bundle_cache.h"
 #include "core/value_wrapper/value_impl_lepus.h"
 
 namespace lynx {
@@ -400,9 +402,21 @@ void LynxShell::LoadTemplate(
   perf_controller_actor_->ActAsync([url](auto& performance) {
     performance->GetTimingHandler().SetURL(url);
   });
-  engine_actor_->Act([url, source = std::move(source), template_data,
+  // Hash the binary on the concurrent loop for the template caches while the
+  // load task is posted.
+  auto shared_source =
+      std::make_shared<std::vector<uint8_t>>(std::move(source));
+  std::unique_ptr<tasm::PendingTemplateDigest> pending_digest;
+  if (tasm::LynxEnv::GetInstance().EnableTemplateBundleCache() ||
+      tasm::ParsedStyleDiskCache::Instance().IsEnabled()) {
+    pending_digest =
+        std::make_unique<tasm::PendingTemplateDigest>(shared_source);
+  }
+  engine_actor_->Act([url, shared_source = std::move(shared_source),
+                      template_data,
                       pipeline_options = std::move(pipeline_options),
                       enable_pre_painting, enable_recycle_template_bundle,
+                      pending_digest = std::move(pending_digest),
                       need_to_merge_back,
                       tasm_runner = runners_.GetTASMTaskRunner().get(),
                       weak_ui_queue =
@@ -411,9 +425,13 @@ void LynxShell::LoadTemplate(
                       current_strategy = current_strategy_,
                       &need_wait_for_merge = need_wait_for_merge_,
                       &tasm_merge_cv = tasm_merge_cv_](auto& engine) mutable {
-    engine->LoadTemplate(url, std::move(source), template_data,
+    // The digest task no longer reads the binary once the digest is known.
+    std::string bundle_digest =
+        pending_digest ? pending_digest->Get() : std::string();
+    engine->LoadTemplate(url, std::move(*shared_source), template_data,
                          std::move(pipeline_options), enable_pre_painting,
-                         enable_recycle_template_bundle);
+                         enable_recycle_template_bundle,
+                         std::move(bundle_digest));
     if (need_to_merge_back) {
       // FIXME(heshan,zhixuan,liting):After each engine_actor's task is
       // completed, the afterInvoke() is executed.Within this
@@ -1035,6 +1053,7 @@ void LynxShell::OnEnterBackground() {
     return;
   }
   app_state_ = AppState::kBackground;
+  engine_actor_->Act([](auto& engine) { engine->TrimListReusePools(); });
 #if ENABLE_AIR
   if (!enable_runtime_) {
     engine_actor_->Act([](auto& engine) {
@@ -1160,11 +1179,47 @@ lepus::Value LynxShell::EnsureGlobalPropsThreadSafe(
 }
 
 void LynxShell::PreloadLazyBundles(std::vector<std::string> urls) {
-  engine_actor_->Act([urls = std::move(urls)](auto& engine) {
+  ActInIdleFrame([urls = std::move(urls)](auto& engine) {
     engine->PreloadLazyBundles(urls);
   });
 }
 
+void LynxShell::InitFrameSchedulersIfNeeded() {
+  if (!tasm::LynxEnv::GetInstance().EnableFrameScheduler()) {
+    return;
+  }
+  auto ui_monitor = base::VSyncMonitor::Create();
+  ui_monitor->BindTaskRunner(runners_.GetUITaskRunner());
+  ui_monitor->Init();
+  ui_operation_queue_->SetFrameScheduler(std::make_shared<base::FrameScheduler>(
+      runners_.GetUITaskRunner(), std::move(ui_monitor)));
+
+  auto engine_monitor = base::VSyncMonitor::Create();
+  engine_monitor->BindTaskRunner(runners_.GetTASMTaskRunner());
+  // Queued before any frame is requested, which happens on the TASM runner.
+  engine_actor_->ActLite(
+      [engine_monitor](auto& engine) { engine_monitor->Init(); });
+  engine_frame_scheduler_ = std::make_shared<base::FrameScheduler>(
+      runners_.GetTASMTaskRunner(), std::move(engine_monitor));
+}
+
+void LynxShell::ActInIdleFrame(
+    base::MoveOnlyClosure<void, std::unique_ptr<LynxEngine>&> func) {
+  // No frames come in background, the work is not in the way of any either.
+  if (!engine_frame_scheduler_ || app_state_ == AppState::kBackground) {
+    engine_actor_->Act(std::move(func));
+    return;
+  }
+  engine_frame_scheduler_->PostTask(
+      base::FrameScheduler::Lane::kIdle,
+      [engine_actor = engine_actor_, func = std::move(func)]() mutable {
+        // The scheduler runs on the engine runner, so func runs right here,
+        // within the idle budget of the frame.
+        DCHECK(engine_actor->CanRunNow());
+        engine_actor->Act(std::move(func));
+      });
+}
+
 void LynxShell::RegisterLazyBundle(std::string url,
                                    tasm::LynxTemplateBundle bundle) {
   engine_actor_->Act(
@@ -1247,6 +1302,17 @@ BASE_EXPORT_FOR_DEVTOOL const lepus::Value LynxShell::GetAllTimingInfo() const {
   });
 }
 
+const lepus::Value LynxShell::GetFrameTimeline(uint64_t since_sequence) const {
+  return perf_controller_actor_->ActSync([since_sequence](auto& performance) {
+    auto timeline =
+        performance->GetTimingHandler().GetFrameTimeline(since_sequence);
+    if (!timeline) {
+      return lepus::Value();
+    }
+    return pub::ValueUtils::ConvertValueToLepusValue(*timeline);
+  });
+}
+
 void LynxShell::SetSSRTimingData(std::string url, uint64_t data_size) const {
   perf_controller_actor_->ActAsync(
       [url = std::move(url), data_size](auto& performance) {
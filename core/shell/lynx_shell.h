@@ -16,6 +16,7 @@
 #include "base/include/base_export.h"
 #include "base/include/lynx_actor.h"
 #include "base/include/value/base_value.h"
+#include "core/base/threading/frame_scheduler.h"
 #include "core/base/threading/task_runner_manufactor.h"
 #include "core/base/threading/vsync_monitor.h"
 #include "core/inspector/observer/inspector_runtime_observer_ng.h"
@@ -330,6 +331,10 @@ class LynxShell {
 
   const lepus::Value GetAllTimingInfo() const;
 
+  // The frames of the FrameTimeline completed after |since_sequence|, or
+  // undefined if the enable_frame_timeline switch is off.
+  const lepus::Value GetFrameTimeline(uint64_t since_sequence = 0) const;
+
   // TODO(kechenglong): should find a better way to set SSR timing data?
   void SetSSRTimingData(std::string url, uint64_t data_size) const;
 
@@ -375,6 +380,15 @@ class LynxShell {
 
   void ConsumeModuleFactory(piper::LynxModuleManager* module_manager);
 
+  // Creates the frame schedulers of the UI and the TASM threads when enabled
+  // by LynxEnv. Called on the UI thread once the engine actor is created.
+  void InitFrameSchedulersIfNeeded();
+
+  // Runs func on the engine in the idle lane of the engine frames, or as a
+  // plain engine task without frame scheduler or in background.
+  void ActInIdleFrame(
+      base::MoveOnlyClosure<void, std::unique_ptr<LynxEngine>&> func);
+
   std::atomic_bool is_destroyed_{false};
 
   std::shared_ptr<LynxActor<NativeFacade>>
@@ -437,6 +451,9 @@ class LynxShell {
 
   std::shared_ptr<LayoutResultManager> layout_result_manager_;
 
+  // On TASM runner, runs the engine work that can wait for an idle frame.
+  std::shared_ptr<base::FrameScheduler> engine_frame_scheduler_;
+
  private:
   friend class LynxEngineWrapper;
   std::weak_ptr<piper::JsBundleHolder> GetWeakJsBundleHolder();
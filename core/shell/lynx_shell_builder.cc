@@ -290,6 +290,7 @@ LynxShell* LynxShellBuilder::build() {
   }
   // after set shell members
   shell->engine_actor_->Impl()->SetOperationQueue(shell->tasm_operation_queue_);
+  shell->InitFrameSchedulersIfNeeded();
   shell->layout_actor_->Impl()->SetRequestLayoutCallback(
       [layout_actor = shell->layout_actor_]() {
         layout_actor->Act([](auto& layout) { layout->Layout(); });
@@ -114,6 +114,11 @@ void LynxUIOperationAsyncQueue::FlushOnTASMThread() {
       self->FlushInterval();
     }
   };
+  if (frame_scheduler_) {
+    frame_scheduler_->PostTask(base::FrameScheduler::Lane::kVisibleUpdate,
+                               std::move(task));
+    return;
+  }
   runner_->PostTask(std::move(task));
 }
 
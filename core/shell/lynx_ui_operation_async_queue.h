@@ -38,6 +38,10 @@ class LynxUIOperationAsyncQueue
   virtual uint32_t UpdateNativeUpdateDataOrder() override;
   virtual bool IsInFlush() override { return is_in_flush_; }
   virtual bool FlushPendingOperations() override;
+  virtual void SetFrameScheduler(
+      std::shared_ptr<base::FrameScheduler> frame_scheduler) override {
+    frame_scheduler_ = std::move(frame_scheduler);
+  }
 
  private:
   void FlushOnTASMThread();
@@ -68,6 +72,9 @@ class LynxUIOperationAsyncQueue
   // Actually, it will always be a UIThread runner. We add |runner_|
   // just for unit test to mock UIThread runner.
   const fml::RefPtr<fml::TaskRunner> runner_;
+  // Runs the flush in the visible update lane, right away like without it,
+  // and ahead of the idle work of the UI frames.
+  std::shared_ptr<base::FrameScheduler> frame_scheduler_;
   std::atomic_uint32_t native_update_data_order_{0};
   bool is_in_flush_{false};
 };
@@ -4,6 +4,9 @@
 
 #include "core/shell/lynx_ui_operation_async_queue.h"
 
+#include <atomic>
+#include <memory>
+
 #include "base/include/fml/synchronization/waitable_event.h"
 #include "core/shell/testing/mock_runner_manufactor.h"
 #include "third_party/googletest/googletest/include/gtest/gtest.h"
@@ -11,6 +14,18 @@
 namespace lynx {
 namespace shell {
 namespace testing {
+
+namespace {
+
+class TestVSyncMonitor : public base::VSyncMonitor {
+ public:
+  void RequestVSync() override { ++request_count_; }
+
+  std::atomic_int request_count_{0};
+};
+
+}  // namespace
+
 class LynxUIOperationAsyncQueueTest : public ::testing::Test {
  protected:
   LynxUIOperationAsyncQueueTest() = default;
@@ -159,6 +174,20 @@ TEST_F(LynxUIOperationAsyncQueueTest, FlushHighPriorityTask) {
   ASSERT_EQ(count, 2);
 }
 
+TEST_F(LynxUIOperationAsyncQueueTest, FlushInFrameSchedulerLane) {
+  auto monitor = std::make_shared<TestVSyncMonitor>();
+  monitor->BindTaskRunner(ui_runner_);
+  queue_->SetFrameScheduler(
+      std::make_shared<base::FrameScheduler>(ui_runner_, monitor));
+  queue_->EnqueueUIOperation([this]() { arwe_.Signal(); });
+
+  tasm_runner_->PostSyncTask([this]() { queue_->Flush(); });
+  // The flush does not wait for the next frame of the UI thread.
+  arwe_.Wait();
+  ASSERT_EQ(result_, expect_);
+  ASSERT_EQ(monitor->request_count_, 0);
+}
+
 }  // namespace testing
 }  // namespace shell
 }  // namespace lynx
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "base/include/debug/lynx_assert.h"
+#include "base/trace/native/flight_recorder.h"
 #include "base/trace/native/trace_event.h"
 #include "core/base/threading/task_runner_manufactor.h"
 #include "core/services/long_task_timing/long_task_monitor.h"
@@ -49,6 +50,7 @@ void LynxUIOperationQueue::ConsumeOperations(
   tasm::timing::LongTaskMonitor::Scope longTaskScope(
       page_options_, tasm::timing::kUIOperationFlushTask,
       tasm::timing::kTaskNameLynxUIOperationQueueConsumeOperations);
+  TRACE_FLIGHT_EVENT("LynxUIOperationQueue::ConsumeOperations");
   for (auto& operation : high_priority_operations) {
     TRACE_EVENT(LYNX_TRACE_CATEGORY,
                 UI_OPERATION_QUEUE_EXECUTE_HIGH_PRIORITY_OPERATION);
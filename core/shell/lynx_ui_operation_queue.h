@@ -14,6 +14,7 @@
 
 #include "base/include/closure.h"
 #include "base/include/concurrent_queue.h"
+#include "core/base/threading/frame_scheduler.h"
 #include "core/public/page_options.h"
 #include "core/renderer/utils/lynx_env.h"
 #include "core/services/event_report/event_tracker.h"
@@ -62,6 +63,9 @@ class LynxUIOperationQueue {
   virtual uint32_t UpdateNativeUpdateDataOrder() { return 0; }
   virtual bool IsInFlush() { return false; }
   virtual bool FlushPendingOperations() { return false; }
+  // Only used by the async queue, whose flush is posted to the UI thread.
+  virtual void SetFrameScheduler(
+      std::shared_ptr<base::FrameScheduler> frame_scheduler) {}
 
  protected:
   void ConsumeOperations(
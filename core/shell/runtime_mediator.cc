@@ -11,6 +11,7 @@
 #include "core/services/timing_handler/timing_mediator.h"
 #include "core/shared_data/white_board_delegate.h"
 #include "core/shell/common/shell_trace_event_def.h"
+#include "core/value_wrapper/value_impl_lepus.h"
 
 #if ENABLE_TESTBENCH_RECORDER
 #include "core/services/recorder/testbench_base_recorder.h"
@@ -544,6 +545,32 @@ void RuntimeMediator::GetSessionStorageItem(
   });
 }
 
+void RuntimeMediator::GetFrameTimeline(uint64_t since_sequence,
+                                       const piper::ApiCallBack& callback) {
+  // The timeline is filled by the pipelines of the engine, there is none to
+  // report without engine.
+  if (runtime_standalone_mode_) {
+    if (white_board_delegate_) {
+      white_board_delegate_->CallJSApiCallbackWithValue(callback,
+                                                        lepus::Value());
+    }
+    return;
+  }
+  perf_controller_actor_->ActAsync(
+      [since_sequence, callback,
+       engine_actor = engine_actor_](auto& performance) {
+        auto timeline =
+            performance->GetTimingHandler().GetFrameTimeline(since_sequence);
+        lepus::Value value;
+        if (timeline) {
+          value = pub::ValueUtils::ConvertValueToLepusValue(*timeline);
+        }
+        engine_actor->Act([callback, value = std::move(value)](auto& engine) {
+          engine->CallJSApiCallbackWithValue(callback, value);
+        });
+      });
+}
+
 void RuntimeMediator::SubscribeSessionStorage(
     const std::string& key, double listener_id,
     const piper::ApiCallBack& callback) {
@@ -204,6 +204,9 @@ class RuntimeMediator : public runtime::TemplateDelegate {
   void SubscribeSessionStorage(const std::string& key, double listener_id,
                                const piper::ApiCallBack& callback) override;
 
+  void GetFrameTimeline(uint64_t since_sequence,
+                        const piper::ApiCallBack& callback) override;
+
  private:
   std::shared_ptr<LynxActor<NativeFacade>> facade_actor_;
 
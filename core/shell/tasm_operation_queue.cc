@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "base/include/log/logging.h"
+#include "base/trace/native/flight_recorder.h"
 
 namespace lynx {
 namespace shell {
@@ -28,6 +29,7 @@ bool TASMOperationQueue::Flush() {
     return result;
   }
 
+  TRACE_FLIGHT_EVENT("TASMOperationQueue::Flush");
   auto operations = std::move(operations_);
   operations_.reserve(kOperationArrayReserveSize);
 
@@ -37,6 +37,30 @@ void LepusChunkManager::AddLepusChunk(
   lepus_chunk_map_.emplace(chunk_key, std::move(bundle));
 }
 
+size_t LynxTemplateBundle::EstimateDecodedFootprint() const {
+  size_t footprint = sizeof(LynxTemplateBundle) + total_size_ + binary_.size();
+  for (const auto &str : string_list_) {
+    footprint += sizeof(base::String) + str.length();
+  }
+  for (const auto &[path, content] : js_bundle_.GetAllJsFiles()) {
+    footprint += path.size() + sizeof(piper::JsContent);
+    if (const auto &buffer = content.GetBuffer()) {
+      footprint += buffer->size();
+    }
+  }
+  for (const auto &[key, styles] : parsed_styles_map_) {
+    footprint += key.size() + sizeof(ParsedStyles);
+    if (styles) {
+      footprint +=
+          styles->first.size() * (sizeof(CSSPropertyID) + sizeof(CSSValue)) +
+          styles->second.size() * 2 * sizeof(base::String);
+    }
+  }
+  footprint +=
+      element_template_infos_.size() * sizeof(ElementTemplateInfo);
+  return footprint;
+}
+
 lepus::Value LynxTemplateBundle::GetExtraInfo() {
   if (page_configs_) {
     return page_configs_->GetExtraInfo();
@@ -124,6 +148,18 @@ std::optional<Elements> LynxTemplateBundle::TryGetElements(
   return task_schedular_->TryGetElements(key, element_template_infos_[key]);
 }
 
+Elements LynxTemplateBundle::InstantiateElementTemplate(
+    const std::string &key, const ElementTemplateInfo &info) {
+  EnsureParseTaskScheduler();
+  return task_schedular_->InstantiateElementTemplate(key, info);
+}
+
+void LynxTemplateBundle::ClearElementTemplatePrototypes() {
+  if (task_schedular_ != nullptr) {
+    task_schedular_->ClearElementTemplatePrototypes();
+  }
+}
+
 static void StyleObjectArrayDeleter(style::StyleObject **obj) {
   for (auto **p = obj; *p != nullptr; p++) {
     (*p)->Release();
@@ -126,6 +126,10 @@ class LynxTemplateBundle final {
 
   uint32_t Size() const { return total_size_; }
 
+  // Estimated memory held by the decoded bundle. The sections that are not
+  // walked are accounted with their encoded size.
+  size_t EstimateDecodedFootprint() const;
+
   bool is_lepusng_binary() { return is_lepusng_binary_; }
 
   bool ShouldReuseLepusContext() const;
@@ -151,6 +155,21 @@ class LynxTemplateBundle final {
 
   std::optional<Elements> TryGetElements(const std::string &key);
 
+  // Synchronously creates a detached instance of the element template, cloned
+  // from the template prototype if it exists.
+  Elements InstantiateElementTemplate(const std::string &key,
+                                      const ElementTemplateInfo &info);
+
+  // Drops the element template prototypes, called when a page releases the
+  // bundle, which may be kept alive by the bundle cache.
+  void ClearElementTemplatePrototypes();
+
+  // Lazy bundles used by this bundle, from component name to url.
+  const std::unordered_map<std::string, std::string> &
+  GetDynamicComponentDeclarations() const {
+    return dynamic_component_declarations_;
+  }
+
   const std::shared_ptr<lynx::tasm::PageConfig> &GetPageConfig() {
     return page_configs_;
   };
@@ -0,0 +1,169 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/parsed_style_disk_cache.h"
+
+#include <errno.h>
+#if defined(OS_WIN)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#include <cstdio>
+#include <utility>
+#include <vector>
+
+#include "base/include/file_utils.h"
+#include "base/include/log/logging.h"
+#include "base/include/no_destructor.h"
+#include "base/include/path_utils.h"
+#include "base/trace/native/trace_event.h"
+#include "core/base/threading/task_runner_manufactor.h"
+#include "core/renderer/utils/lynx_env.h"
+#include "core/template_bundle/template_bundle_cache.h"
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+constexpr char kImageSuffix[] = ".lxps";
+constexpr char kTempSuffix[] = ".tmp";
+
+}  // namespace
+
+ParsedStyleDiskCache& ParsedStyleDiskCache::Instance() {
+  static base::NoDestructor<ParsedStyleDiskCache> instance;
+  return *instance;
+}
+
+void ParsedStyleDiskCache::SetDirectory(const std::string& directory) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  directory_ = directory;
+  directory_created_ = false;
+}
+
+bool ParsedStyleDiskCache::EnsureDirectory() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (directory_created_ || directory_.empty()) {
+    return directory_created_;
+  }
+#if defined(OS_WIN)
+  int result = _mkdir(directory_.c_str());
+#else
+  int result = mkdir(directory_.c_str(), S_IRWXU);
+#endif
+  directory_created_ = result == 0 || errno == EEXIST;
+  if (!directory_created_) {
+    LOGE("ParsedStyleDiskCache create directory failed: " << directory_);
+  }
+  return directory_created_;
+}
+
+bool ParsedStyleDiskCache::IsEnabled() {
+  if (!LynxEnv::GetInstance().EnableParsedStyleDiskCache()) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return !directory_.empty();
+}
+
+std::string ParsedStyleDiskCache::PathFor(const std::string& digest) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (directory_.empty() || digest.empty()) {
+    return std::string();
+  }
+  return base::PathUtils::JoinPaths({directory_, digest + kImageSuffix});
+}
+
+std::shared_ptr<const ParsedStyleImage> ParsedStyleDiskCache::Open(
+    const std::string& digest) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "ParsedStyleDiskCache::Open");
+  auto path = PathFor(digest);
+  auto image = path.empty() ? nullptr : ParsedStyleImage::Open(path, digest);
+  if (image == nullptr) {
+    ++miss_count_;
+    return nullptr;
+  }
+  ++hit_count_;
+  return image;
+}
+
+bool ParsedStyleDiskCache::HasImage(const std::string& digest) {
+  auto path = PathFor(digest);
+  return !path.empty() && ParsedStyleImage::Open(path, digest) != nullptr;
+}
+
+void ParsedStyleDiskCache::StoreAsync(
+    std::string digest, std::unique_ptr<LynxBinaryRecyclerDelegate> recycler,
+    bool insert_into_bundle_cache) {
+  if (!recycler || digest.empty()) {
+    return;
+  }
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [this, key = std::move(digest), recycler = std::move(recycler),
+       insert_into_bundle_cache]() mutable {
+        TRACE_EVENT(LYNX_TRACE_CATEGORY, "ParsedStyleDiskCache::StoreAsync");
+        {
+          std::lock_guard<std::mutex> lock(mutex_);
+          if (!pending_.insert(key).second) {
+            return;
+          }
+        }
+        // Another load of the same template may have stored the image since
+        // this one missed it, do not rewrite it.
+        const bool has_image = HasImage(key);
+        auto builder = std::make_shared<ParsedStyleImageBuilder>();
+        if (!has_image) {
+          recycler->RecordParsedStyles(builder);
+        }
+        if ((!has_image || insert_into_bundle_cache) &&
+            recycler->CompleteDecode()) {
+          if (!builder->empty()) {
+            Write(key, builder->Serialize(key));
+          }
+          if (insert_into_bundle_cache) {
+            TemplateBundleCache::Instance().Insert(
+                key, recycler->GetCompleteTemplateBundle());
+          }
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.erase(key);
+      },
+      base::ConcurrentTaskType::NORMAL_PRIORITY);
+}
+
+bool ParsedStyleDiskCache::Write(const std::string& digest,
+                                 const std::vector<uint8_t>& image) {
+  auto path = PathFor(digest);
+  if (path.empty() || !EnsureDirectory()) {
+    return false;
+  }
+  // The temp file is unique per digest and only one store of a digest runs at
+  // a time.
+  auto temp_path = path + kTempSuffix;
+  if (!base::FileUtils::WriteFileBinary(temp_path, image.data(),
+                                        image.size())) {
+    LOGE("ParsedStyleDiskCache write failed: " << temp_path);
+    return false;
+  }
+  remove(path.c_str());
+  if (rename(temp_path.c_str(), path.c_str())) {
+    remove(temp_path.c_str());
+    LOGE("ParsedStyleDiskCache rename failed: " << path);
+    return false;
+  }
+  return true;
+}
+
+void ParsedStyleDiskCache::Clear(const std::string& digest) {
+  auto path = PathFor(digest);
+  if (!path.empty()) {
+    remove(path.c_str());
+  }
+}
+
+}  // namespace tasm
+}  // namespace lynx
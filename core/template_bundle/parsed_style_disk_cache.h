@@ -0,0 +1,84 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_PARSED_STYLE_DISK_CACHE_H_
+#define CORE_TEMPLATE_BUNDLE_PARSED_STYLE_DISK_CACHE_H_
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "base/include/no_destructor.h"
+#include "core/template_bundle/template_codec/binary_decoder/lynx_binary_lazy_reader_delegate.h"
+#include "core/template_bundle/template_codec/binary_decoder/parsed_style_image.h"
+
+namespace lynx {
+namespace tasm {
+
+// Persists the parsed attributes of the CSS parse tokens of templates across
+// launches, keyed by the digest of the template binary.
+//
+// The first load of a template parses its tokens in the background and writes
+// them as a ParsedStyleImage. Later loads map the image and the decoder takes
+// the parsed attributes from it, so the raw attributes are not parsed again on
+// the first style resolution.
+//
+// The directory is set by LynxEnv on Android and iOS, under the cache
+// directory of the app. Disabled until the enable_parsed_style_disk_cache
+// switch is on.
+class ParsedStyleDiskCache {
+ public:
+  static ParsedStyleDiskCache& Instance();
+
+  ParsedStyleDiskCache(const ParsedStyleDiskCache&) = delete;
+  ParsedStyleDiskCache& operator=(const ParsedStyleDiskCache&) = delete;
+
+  void SetDirectory(const std::string& directory);
+  bool IsEnabled();
+
+  // Returns nullptr if there is no valid image for |digest|.
+  std::shared_ptr<const ParsedStyleImage> Open(const std::string& digest);
+
+  // Completes the decoding of the bundle held by |recycler| on the concurrent
+  // loop and writes the image of its parsed styles. The completed bundle is
+  // also inserted into the TemplateBundleCache if |insert_into_bundle_cache|.
+  void StoreAsync(std::string digest,
+                  std::unique_ptr<LynxBinaryRecyclerDelegate> recycler,
+                  bool insert_into_bundle_cache);
+
+  // Writes |image| atomically, a partially written image is never visible.
+  bool Write(const std::string& digest, const std::vector<uint8_t>& image);
+
+  void Clear(const std::string& digest);
+
+  uint64_t hit_count() const { return hit_count_; }
+  uint64_t miss_count() const { return miss_count_; }
+
+ private:
+  friend class base::NoDestructor<ParsedStyleDiskCache>;
+  ParsedStyleDiskCache() = default;
+
+  std::string PathFor(const std::string& digest);
+  // Whether a valid image of |digest| is on disk, without counting a hit.
+  bool HasImage(const std::string& digest);
+  // Creates the directory on the first write.
+  bool EnsureDirectory();
+
+  std::mutex mutex_;
+  std::string directory_;
+  bool directory_created_{false};
+  // Digests with an image being stored.
+  std::unordered_set<std::string> pending_;
+
+  std::atomic<uint64_t> hit_count_{0};
+  std::atomic<uint64_t> miss_count_{0};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_PARSED_STYLE_DISK_CACHE_H_
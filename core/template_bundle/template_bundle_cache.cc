@@ -0,0 +1,155 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_bundle_cache.h"
+
+#include "base/include/content_hash.h"
+#include "base/include/no_destructor.h"
+#include "base/trace/native/trace_event.h"
+#include "core/base/threading/task_runner_manufactor.h"
+
+namespace lynx {
+namespace tasm {
+
+TemplateBundleCache& TemplateBundleCache::Instance() {
+  static base::NoDestructor<TemplateBundleCache> instance;
+  return *instance;
+}
+
+std::string TemplateBundleCache::ComputeDigest(
+    const std::vector<uint8_t>& source) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY, "TemplateBundleCache::ComputeDigest");
+  return base::ContentHasher::HashToHexString(source.data(), source.size());
+}
+
+PendingTemplateDigest::PendingTemplateDigest(
+    std::shared_ptr<const std::vector<uint8_t>> source)
+    : state_(std::make_shared<State>()) {
+  state_->source = std::move(source);
+  digest_ = state_->promise.get_future();
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [state = state_]() {
+        if (state->claimed.exchange(true)) {
+          return;
+        }
+        auto digest = TemplateBundleCache::ComputeDigest(*state->source);
+        state->source.reset();
+        state->promise.set_value(std::move(digest));
+      },
+      base::ConcurrentTaskType::HIGH_PRIORITY);
+}
+
+std::string PendingTemplateDigest::Get() {
+  if (digest_.wait_for(kWaitTimeout) != std::future_status::ready &&
+      !state_->claimed.exchange(true)) {
+    // The concurrent loop is busy, the task will find the binary claimed.
+    auto digest = TemplateBundleCache::ComputeDigest(*state_->source);
+    state_->source.reset();
+    return digest;
+  }
+  // Ready, or being hashed by the task right now.
+  return digest_.get();
+}
+
+std::optional<LynxTemplateBundle> TemplateBundleCache::Find(
+    const std::string& digest) {
+  std::shared_ptr<const LynxTemplateBundle> bundle;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(digest);
+    if (it == index_.end()) {
+      ++miss_count_;
+      return std::nullopt;
+    }
+    entries_.splice(entries_.begin(), entries_, it->second);
+    bundle = it->second->bundle;
+  }
+  ++hit_count_;
+  // Copy outside of the lock, the copy only adds references to the shared
+  // decoded state.
+  return *bundle;
+}
+
+void TemplateBundleCache::Insert(const std::string& digest,
+                                 LynxTemplateBundle bundle) {
+  size_t cost = bundle.EstimateDecodedFootprint();
+  auto shared_bundle =
+      std::make_shared<const LynxTemplateBundle>(std::move(bundle));
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (cost > memory_budget_) {
+    return;
+  }
+  auto it = index_.find(digest);
+  if (it != index_.end()) {
+    memory_usage_ -= it->second->cost;
+    entries_.erase(it->second);
+    index_.erase(it);
+  }
+  entries_.push_front({digest, std::move(shared_bundle), cost});
+  index_.emplace(digest, entries_.begin());
+  memory_usage_ += cost;
+  TrimToBudgetLocked();
+}
+
+void TemplateBundleCache::InsertAsync(
+    std::string digest, std::unique_ptr<LynxBinaryRecyclerDelegate> recycler) {
+  if (!recycler || digest.empty()) {
+    return;
+  }
+  base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+      [digest = std::move(digest), recycler = std::move(recycler)]() mutable {
+        TRACE_EVENT(LYNX_TRACE_CATEGORY, "TemplateBundleCache::InsertAsync");
+        auto& cache = TemplateBundleCache::Instance();
+        if (cache.Contains(digest) || !recycler->CompleteDecode()) {
+          return;
+        }
+        cache.Insert(digest, recycler->GetCompleteTemplateBundle());
+      },
+      base::ConcurrentTaskType::NORMAL_PRIORITY);
+}
+
+bool TemplateBundleCache::Contains(const std::string& digest) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return index_.find(digest) != index_.end();
+}
+
+void TemplateBundleCache::SetMemoryBudget(size_t budget) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  memory_budget_ = budget;
+  TrimToBudgetLocked();
+}
+
+size_t TemplateBundleCache::memory_budget() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memory_budget_;
+}
+
+size_t TemplateBundleCache::memory_usage() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return memory_usage_;
+}
+
+size_t TemplateBundleCache::size() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+void TemplateBundleCache::Clear() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+  memory_usage_ = 0;
+}
+
+void TemplateBundleCache::TrimToBudgetLocked() {
+  while (memory_usage_ > memory_budget_ && !entries_.empty()) {
+    auto& last = entries_.back();
+    memory_usage_ -= last.cost;
+    index_.erase(last.digest);
+    entries_.pop_back();
+  }
+}
+
+}  // namespace tasm
+}  // namespace lynx
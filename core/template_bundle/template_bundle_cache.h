@@ -0,0 +1,145 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_BUNDLE_CACHE_H_
+#define CORE_TEMPLATE_BUNDLE_TEMPLATE_BUNDLE_CACHE_H_
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/include/no_destructor.h"
+#include "core/template_bundle/lynx_template_bundle.h"
+#include "core/template_bundle/template_codec/binary_decoder/lynx_binary_lazy_reader_delegate.h"
+
+namespace lynx {
+namespace tasm {
+
+// Recycler of a bundle found in the TemplateBundleCache, which is completely
+// decoded already.
+class CachedTemplateBundleRecycler : public LynxBinaryRecyclerDelegate {
+ public:
+  explicit CachedTemplateBundleRecycler(LynxTemplateBundle bundle)
+      : bundle_(std::move(bundle)) {}
+  ~CachedTemplateBundleRecycler() override = default;
+
+  std::unique_ptr<LynxBinaryRecyclerDelegate> CreateRecycler() override {
+    return std::make_unique<CachedTemplateBundleRecycler>(bundle_);
+  }
+  bool CompleteDecode() override { return true; }
+  LynxTemplateBundle GetCompleteTemplateBundle() override { return bundle_; }
+
+ private:
+  LynxTemplateBundle bundle_;
+};
+
+// Digest of a template binary hashed on the concurrent loop while the binary
+// is posted to the TASM thread. The binary is shared with the hashing task
+// rather than copied.
+class PendingTemplateDigest {
+ public:
+  // Longest wait for the concurrent loop before hashing on the calling thread.
+  static constexpr std::chrono::milliseconds kWaitTimeout{4};
+
+  explicit PendingTemplateDigest(
+      std::shared_ptr<const std::vector<uint8_t>> source);
+
+  PendingTemplateDigest(const PendingTemplateDigest&) = delete;
+  PendingTemplateDigest& operator=(const PendingTemplateDigest&) = delete;
+
+  // Returns the digest, hashing on the calling thread if the task has not
+  // started within kWaitTimeout. The task never reads the binary once Get()
+  // returns, so the caller may take the binary back. Called once.
+  std::string Get();
+
+ private:
+  struct State {
+    // Set by whichever of the task and Get() hashes the binary.
+    std::atomic<bool> claimed{false};
+    std::shared_ptr<const std::vector<uint8_t>> source;
+    std::promise<std::string> promise;
+  };
+
+  std::shared_ptr<State> state_;
+  std::future<std::string> digest_;
+};
+
+// Process-wide cache of decoded template bundles keyed by the digest of the
+// template binary.
+//
+// A cached bundle is completely decoded and never mutated afterwards. Every
+// LynxTemplateBundle returned by Find() is a shallow copy sharing the decoded
+// CSS, parsed styles, element templates, lepus chunks and string table with
+// the cached one, so dozens of shells loading the same template decode it
+// only once and share its memory.
+//
+// The cache is bounded by a memory budget accounted with the estimated decoded
+// footprint of the bundles and evicts the least recently used bundles first.
+class TemplateBundleCache {
+ public:
+  static constexpr size_t kDefaultMemoryBudget = 16 * 1024 * 1024;
+
+  static TemplateBundleCache& Instance();
+
+  static std::string ComputeDigest(const std::vector<uint8_t>& source);
+
+  TemplateBundleCache(const TemplateBundleCache&) = delete;
+  TemplateBundleCache& operator=(const TemplateBundleCache&) = delete;
+
+  std::optional<LynxTemplateBundle> Find(const std::string& digest);
+
+  // Insert a completely decoded bundle.
+  void Insert(const std::string& digest, LynxTemplateBundle bundle);
+
+  // Completes the decoding of the bundle held by |recycler| on the concurrent
+  // loop and inserts the result.
+  void InsertAsync(std::string digest,
+                   std::unique_ptr<LynxBinaryRecyclerDelegate> recycler);
+
+  bool Contains(const std::string& digest);
+
+  void SetMemoryBudget(size_t budget);
+  size_t memory_budget();
+  size_t memory_usage();
+  size_t size();
+  void Clear();
+
+  uint64_t hit_count() const { return hit_count_; }
+  uint64_t miss_count() const { return miss_count_; }
+
+ private:
+  struct Entry {
+    std::string digest;
+    std::shared_ptr<const LynxTemplateBundle> bundle;
+    size_t cost;
+  };
+  using EntryList = std::list<Entry>;
+
+  friend class base::NoDestructor<TemplateBundleCache>;
+  TemplateBundleCache() = default;
+
+  void TrimToBudgetLocked();
+
+  std::mutex mutex_;
+  EntryList entries_;
+  std::unordered_map<std::string, EntryList::iterator> index_;
+  size_t memory_budget_{kDefaultMemoryBudget};
+  size_t memory_usage_{0};
+
+  std::atomic<uint64_t> hit_count_{0};
+  std::atomic<uint64_t> miss_count_{0};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_TEMPLATE_BUNDLE_CACHE_H_
@@ -0,0 +1,117 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_bundle_cache.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+namespace {
+
+LynxTemplateBundle MakeBundle(size_t string_count) {
+  LynxTemplateBundle bundle;
+  for (size_t i = 0; i < string_count; ++i) {
+    bundle.string_list().emplace_back(std::string(64, 'a' + i % 26));
+  }
+  return bundle;
+}
+
+}  // namespace
+
+class TemplateBundleCacheTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    cache().Clear();
+    cache().SetMemoryBudget(TemplateBundleCache::kDefaultMemoryBudget);
+  }
+
+  void TearDown() override { SetUp(); }
+
+  TemplateBundleCache& cache() { return TemplateBundleCache::Instance(); }
+};
+
+TEST_F(TemplateBundleCacheTest, Miss) {
+  auto misses = cache().miss_count();
+  EXPECT_FALSE(cache().Find("digest").has_value());
+  EXPECT_EQ(cache().miss_count(), misses + 1);
+  EXPECT_EQ(cache().size(), 0u);
+}
+
+TEST_F(TemplateBundleCacheTest, HitSharesDecodedState) {
+  auto bundle = MakeBundle(4);
+  auto css_style_manager = bundle.GetCSSStyleManager();
+  auto footprint = bundle.EstimateDecodedFootprint();
+  cache().Insert("digest", std::move(bundle));
+  EXPECT_EQ(cache().memory_usage(), footprint);
+
+  auto hits = cache().hit_count();
+  auto found = cache().Find("digest");
+  ASSERT_TRUE(found.has_value());
+  EXPECT_EQ(cache().hit_count(), hits + 1);
+  EXPECT_EQ(found->GetCSSStyleManager(), css_style_manager);
+  EXPECT_EQ(found->string_list().size(), 4u);
+}
+
+TEST_F(TemplateBundleCacheTest, BudgetCountsDecodedFootprint) {
+  auto small = MakeBundle(0).EstimateDecodedFootprint();
+  auto large = MakeBundle(64).EstimateDecodedFootprint();
+  EXPECT_GT(large, small + 64 * 64);
+
+  cache().SetMemoryBudget(large - 1);
+  cache().Insert("large", MakeBundle(64));
+  EXPECT_FALSE(cache().Contains("large"));
+  EXPECT_EQ(cache().memory_usage(), 0u);
+}
+
+TEST_F(TemplateBundleCacheTest, EvictsLeastRecentlyUsed) {
+  auto footprint = MakeBundle(8).EstimateDecodedFootprint();
+  cache().SetMemoryBudget(footprint * 2 + footprint / 2);
+  cache().Insert("a", MakeBundle(8));
+  cache().Insert("b", MakeBundle(8));
+  EXPECT_TRUE(cache().Find("a").has_value());
+
+  cache().Insert("c", MakeBundle(8));
+  EXPECT_EQ(cache().size(), 2u);
+  EXPECT_TRUE(cache().Contains("a"));
+  EXPECT_FALSE(cache().Contains("b"));
+  EXPECT_TRUE(cache().Contains("c"));
+  EXPECT_EQ(cache().memory_usage(), footprint * 2);
+
+  cache().SetMemoryBudget(footprint);
+  EXPECT_EQ(cache().size(), 1u);
+  EXPECT_TRUE(cache().Contains("c"));
+}
+
+TEST_F(TemplateBundleCacheTest, RecyclerOfCachedBundle) {
+  auto bundle = MakeBundle(2);
+  auto css_style_manager = bundle.GetCSSStyleManager();
+  CachedTemplateBundleRecycler recycler(std::move(bundle));
+  EXPECT_TRUE(recycler.CompleteDecode());
+  EXPECT_EQ(recycler.GetCompleteTemplateBundle().GetCSSStyleManager(),
+            css_style_manager);
+  auto copy = recycler.CreateRecycler();
+  ASSERT_NE(copy, nullptr);
+  EXPECT_EQ(copy->GetCompleteTemplateBundle().GetCSSStyleManager(),
+            css_style_manager);
+}
+
+TEST_F(TemplateBundleCacheTest, PendingDigestSharesBinary) {
+  auto source = std::make_shared<std::vector<uint8_t>>(4096, 7);
+  auto expected = TemplateBundleCache::ComputeDigest(*source);
+  PendingTemplateDigest pending(source);
+  EXPECT_EQ(pending.Get(), expected);
+  // Either the task or Get() has released the binary.
+  EXPECT_EQ(source.use_count(), 1);
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
@@ -67,6 +67,8 @@ inline constexpr const char* const
     BINARY_BASE_TEMPLATE_READER_FIND_SPECIFIC_SECTION = "FindSpecificSection";
 inline constexpr const char* const
     BINARY_BASE_TEMPLATE_READER_DECODE_SECTION_ROUTE = "DecodeSectionRoute";
+inline constexpr const char* const
+    BINARY_BASE_TEMPLATE_READER_DECOMPRESS_SECTIONS = "DecompressSections";
 inline constexpr const char* const
     BINARY_BASE_TEMPLATE_READER_DESERIALIZE_SECTION = "DeserializeSection";
 inline constexpr const char* const
@@ -12,10 +12,20 @@
 #include <vector>
 
 #include "base/trace/native/trace_event.h"
+#include "core/renderer/utils/lynx_env.h"
 #include "core/template_bundle/template_codec/binary_decoder/binary_decoder_trace_event_def.h"
 
 namespace lynx {
 namespace tasm {
+
+LynxBinaryBaseCSSReader::LynxBinaryBaseCSSReader(
+    std::unique_ptr<lepus::InputStream> stream)
+    : lepus::BaseBinaryReader(std::move(stream)) {
+  // Selectors, sheet names and values repeat a lot across the fragments.
+  SetEnableStringInterning(
+      LynxEnv::GetInstance().EnableDecoderStringInterning());
+}
+
 // static
 bool LynxBinaryBaseCSSReader::EnableCssVariable(const CompileOptions& options) {
   return Config::IsHigherOrEqual(options.target_sdk_version_,
@@ -84,6 +94,10 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
   auto parser_config =
       CSSParserConfigs::GetCSSParserConfigsByComplierOptions(compile_options_);
 
+  // Index of the parse tokens in decoding order, it addresses the tokens in
+  // the parsed style image.
+  uint32_t token_index = 0;
+
   // Decode the selector and parse token when enable the css selector
   if (compile_options_.enable_css_selector_) {
     // If enable the CSS invalidation
@@ -110,6 +124,7 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
       }
       auto parser_token = fml::MakeRefCounted<CSSParseToken>(parser_config);
       ERROR_UNLESS(DecodeCSSParseToken(parser_token.get()));
+      OnCSSParseTokenDecoded(fragment->id_, token_index++, parser_token.get());
       fragment->AddStyleRule(std::move(selector_array),
                              std::move(parser_token));
     }
@@ -127,6 +142,7 @@ bool LynxBinaryBaseCSSReader::DecodeCSSFragment(SharedCSSFragment* fragment,
     DECODE_STDSTR(key);
     auto parser_token = fml::MakeRefCounted<CSSParseToken>(parser_config);
     ERROR_UNLESS(DecodeCSSParseToken(parser_token.get()));
+    OnCSSParseTokenDecoded(fragment->id_, token_index++, parser_token.get());
     if (parser_token->IsTouchPseudoToken()) {
       fragment->MarkHasTouchPseudoToken();
     }
@@ -211,6 +227,30 @@ bool LynxBinaryBaseCSSReader::DecodeCSSParseToken(CSSParseToken* token) {
   return true;
 }
 
+void LynxBinaryBaseCSSReader::OnCSSParseTokenDecoded(int32_t fragment_id,
+                                                     uint32_t token_index,
+                                                     CSSParseToken* token) {
+  // Nothing to save when the binary already holds the parsed values.
+  if (enable_css_parser_) {
+    return;
+  }
+  if (enable_pre_process_attributes_) {
+    if (parsed_style_recorder_) {
+      parsed_style_recorder_->Record(fragment_id, token_index,
+                                     token->GetAttributes());
+    }
+    return;
+  }
+  if (parsed_style_image_) {
+    StyleMap attributes;
+    if (parsed_style_image_->GetStyles(fragment_id, token_index,
+                                       &attributes)) {
+      token->raw_attributes().clear();
+      token->SetAttributes(std::move(attributes));
+    }
+  }
+}
+
 bool LynxBinaryBaseCSSReader::DecodeCSSFontFaceToken(CSSFontFaceRule* token) {
   DECODE_COMPACT_U32(size);
   for (size_t i = 0; i < size; ++i) {
@@ -13,6 +13,7 @@
 #include "core/renderer/css/shared_css_fragment.h"
 #include "core/renderer/simple_styling/style_object_decoder.h"
 #include "core/runtime/vm/lepus/base_binary_reader.h"
+#include "core/template_bundle/template_codec/binary_decoder/parsed_style_image.h"
 #include "core/template_bundle/template_codec/template_binary.h"
 
 namespace lynx {
@@ -32,8 +33,7 @@ struct StyleObjectRoute;
 class LynxBinaryBaseCSSReader : public lepus::BaseBinaryReader,
                                 public style::StyleObjectDecoder {
  public:
-  LynxBinaryBaseCSSReader(std::unique_ptr<lepus::InputStream> stream)
-      : lepus::BaseBinaryReader(std::move(stream)){};
+  LynxBinaryBaseCSSReader(std::unique_ptr<lepus::InputStream> stream);
 
   ~LynxBinaryBaseCSSReader() override = default;
 
@@ -49,11 +49,25 @@ class LynxBinaryBaseCSSReader : public lepus::BaseBinaryReader,
 
   bool DecodeStyleObject(StyleMap& attr, const CSSRange& range) override;
 
+  // Tokens found in the image take their parsed attributes from it instead of
+  // parsing the raw attributes again.
+  void SetParsedStyleImage(std::shared_ptr<const ParsedStyleImage> image) {
+    parsed_style_image_ = std::move(image);
+  }
+
+  // Tokens parsed while decoding are recorded to |recorder|.
+  void SetParsedStyleRecorder(
+      std::shared_ptr<ParsedStyleImageBuilder> recorder) {
+    parsed_style_recorder_ = std::move(recorder);
+  }
+
  protected:
   // Utils for decode css.
   bool DecodeCSSRoute(CSSRoute& css_router);
   bool DecodeCSSFragment(SharedCSSFragment* fragment, size_t descriptor_end);
   bool DecodeCSSParseToken(CSSParseToken*);
+  void OnCSSParseTokenDecoded(int32_t fragment_id, uint32_t token_index,
+                              CSSParseToken* token);
   bool DecodeCSSKeyframesToken(CSSKeyframesToken*);
   bool DecodeCSSSheet(CSSSheet* parent, CSSSheet* sheet);
   bool DecodeCSSAttributes(CSSParseToken* token);
@@ -84,6 +98,9 @@ class LynxBinaryBaseCSSReader : public lepus::BaseBinaryReader,
   bool enable_css_variable_multi_default_value_{false};
   std::string absetting_disable_css_lazy_decode_;
   bool enable_pre_process_attributes_{false};
+
+  std::shared_ptr<const ParsedStyleImage> parsed_style_image_;
+  std::shared_ptr<ParsedStyleImageBuilder> parsed_style_recorder_;
 };
 
 }  // namespace tasm
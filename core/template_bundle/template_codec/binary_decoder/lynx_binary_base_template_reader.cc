@@ -5,15 +5,19 @@
 #include "core/template_bundle/template_codec/binary_decoder/lynx_binary_base_template_reader.h"
 
 #include <algorithm>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "base/include/content_hash.h"
 #include "base/include/timer/time_utils.h"
 #include "base/trace/native/trace_event.h"
+#include "core/runtime/vm/lepus/binary_input_stream.h"
 #include "core/template_bundle/template_codec/binary_decoder/binary_decoder_trace_event_def.h"
+#include "core/template_bundle/template_codec/section_compression.h"
 
 #if ENABLE_AIR
 #include "core/renderer/dom/air/lynx_air_parsed_style_store.h"
@@ -437,15 +441,26 @@ bool LynxBinaryBaseTemplateReader::DecodeSectionRoute() {
   DECODE_U8(section_route_type);
   DECODE_COMPACT_U32(section_count);
 
+  std::vector<StoredSection> stored_sections;
   for (uint32_t i = 0; i < section_count; ++i) {
     DECODE_U8(section);
     DECODE_COMPACT_U32(start);
     DECODE_COMPACT_U32(end);
+    if (compile_options_.enable_section_compression_) {
+      DECODE_U8(storage);
+      DECODE_COMPACT_U32(stored_size);
+      ERROR_UNLESS(SectionCompression::IsKnownStorage(storage));
+      stored_sections.push_back(
+          {start, end, static_cast<SectionStorage>(storage), stored_size});
+    }
     section_route_.insert({static_cast<BinarySection>(section),
                            {static_cast<BinarySection>(section), start, end}});
   }
 
   uint32_t start = static_cast<uint32_t>(stream_->offset());
+  if (!stored_sections.empty()) {
+    ERROR_UNLESS(DecompressSections(stored_sections, start));
+  }
   for (auto &pair : section_route_) {
     pair.second.start_offset_ += start;
     pair.second.end_offset_ += start;
@@ -453,6 +468,30 @@ bool LynxBinaryBaseTemplateReader::DecodeSectionRoute() {
   return true;
 }
 
+bool LynxBinaryBaseTemplateReader::DecompressSections(
+    const std::vector<StoredSection> &sections, uint32_t route_end) {
+  TRACE_EVENT(LYNX_TRACE_CATEGORY,
+              BINARY_BASE_TEMPLATE_READER_DECOMPRESS_SECTIONS);
+
+  // Restore the binary the sections were encoded in, with the sections right
+  // after the route. Offsets recorded while decoding and the lazy decoding
+  // of the sections then work the same as for an uncompressed template.
+  // Check the route before any task writes to the buffer.
+  uint32_t body_size = 0;
+  ERROR_UNLESS(SectionCompression::CheckRoute(
+      sections, stream_->size() - route_end, body_size));
+
+  std::vector<uint8_t> data(static_cast<size_t>(route_end) + body_size);
+  const uint8_t *stored = stream_->begin();
+  memcpy(data.data(), stored, route_end);
+  ERROR_UNLESS(SectionCompression::Restore(sections, stored + route_end,
+                                           data.data() + route_end));
+
+  stream_ = std::make_unique<lepus::ByteArrayInputStream>(std::move(data));
+  stream_->Seek(route_end);
+  return true;
+}
+
 bool LynxBinaryBaseTemplateReader::DeserializeSection() {
   TRACE_EVENT(LYNX_TRACE_CATEGORY,
               BINARY_BASE_TEMPLATE_READER_DESERIALIZE_SECTION);
@@ -598,8 +637,14 @@ bool LynxBinaryBaseTemplateReader::DeserializeJSSourceSection() {
   for (size_t i = 0; i < count; i++) {
     DECODE_STDSTR(path);
     DECODE_STDSTR(content);
+    // Hash the source once here, the js cache of every runtime using this
+    // bundle is keyed by it.
+    auto digest =
+        base::ContentHasher::HashToHexString(content.data(), content.size());
     js_bundle_.AddJsContent(
-        path, {std::move(content), piper::JsContent::Type::SOURCE});
+        path, {std::make_shared<piper::StringBuffer>(std::move(content),
+                                                     std::move(digest)),
+               piper::JsContent::Type::SOURCE});
   }
   return true;
 }
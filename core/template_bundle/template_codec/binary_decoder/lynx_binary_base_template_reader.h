@@ -9,6 +9,7 @@
 #include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "core/renderer/css/css_style_sheet_manager.h"
 #include "core/renderer/css/css_value.h"
@@ -88,6 +89,9 @@ class LynxBinaryBaseTemplateReader : public ElementBinaryReader {
   bool DecodeTemplateBody();
   // For Section Route
   bool DecodeSectionRoute();
+  // For templates with enable_section_compression_
+  bool DecompressSections(const std::vector<StoredSection>& sections,
+                          uint32_t route_end);
   // For Specific Section
   bool DecodeSpecificSection(const BinarySection& section);
   // For FlexibleTemplate
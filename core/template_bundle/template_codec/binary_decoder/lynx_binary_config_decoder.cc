@@ -68,6 +68,12 @@ static constexpr const char* const kEnableListNewContainer =
 static constexpr const char* const kEnableListPlug = "enableListPlug";
 static constexpr const char* const kEnableListMoveOperation =
     "enableListMoveOperation";
+static constexpr const char* const kListReusePoolCapacity =
+    "listReusePoolCapacity";
+static constexpr const char* const kEnableComponentMemo =
+    "enableComponentMemo";
+static constexpr const char* const kEnablePreloadLazyBundleDependencies =
+    "enablePreloadLazyBundleDependencies";
 static constexpr const char* const kEnableCSSStrictMode = "enableCSSStrictMode";
 static constexpr const char* const kTapSlop = "tapSlop";
 static constexpr const char* const kDefaultTapSlop = "50px";
@@ -562,6 +568,56 @@ bool LynxBinaryConfigDecoder::DecodePageConfig(
         doc[kEnableListMoveOperation].GetBool());
   }
 
+  /**
+   * @name: listReusePoolCapacity
+   * @description: max number of recycled list item components of a type kept
+   * on the page, either a number for all types or an object from component
+   * name to number. 0 or absent for no limit.
+   * @note: None
+   * @platform: Both
+   **/
+  if (doc.HasMember(kListReusePoolCapacity)) {
+    const auto& capacity = doc[kListReusePoolCapacity];
+    if (capacity.IsInt()) {
+      page_config->SetListReusePoolCapacity(capacity.GetInt());
+    } else if (capacity.IsObject()) {
+      for (auto it = capacity.MemberBegin(); it != capacity.MemberEnd();
+           ++it) {
+        if (it->value.IsInt()) {
+          page_config->SetListReusePoolCapacity(it->name.GetString(),
+                                                it->value.GetInt());
+        }
+      }
+    }
+  }
+
+  /**
+   * @name: enableComponentMemo
+   * @description: when a radon component re-renders, the props of its child
+   * components are first matched by reference: the same values or the same
+   * unmodified objects as in the last render. A match replaces the deep props
+   * comparison, unchanged props skip the render and diff either way.
+   * @note: None
+   * @platform: Both
+   **/
+  if (doc.HasMember(kEnableComponentMemo) &&
+      doc[kEnableComponentMemo].IsBool()) {
+    page_config->SetEnableComponentMemo(doc[kEnableComponentMemo].GetBool());
+  }
+
+  /**
+   * @name: enablePreloadLazyBundleDependencies
+   * @description: also preload the lazy bundles declared by a preloaded lazy
+   * bundle, up to two levels below the preloaded ones.
+   * @note: None
+   * @platform: Both
+   **/
+  if (doc.HasMember(kEnablePreloadLazyBundleDependencies) &&
+      doc[kEnablePreloadLazyBundleDependencies].IsBool()) {
+    page_config->SetEnablePreloadLazyBundleDependencies(
+        doc[kEnablePreloadLazyBundleDependencies].GetBool());
+  }
+
   if (doc.HasMember(kEnableCSSStrictMode) &&
       doc[kEnableCSSStrictMode].IsBool()) {
     page_config->SetEnableCSSStrictMode(doc[kEnableCSSStrictMode].GetBool());
@@ -16,6 +16,8 @@
 namespace lynx {
 namespace tasm {
 
+class ParsedStyleImageBuilder;
+
 // A class used to assist in recycling template bundles. Its main function is to
 // complete the lazy-decoding part of template bundles.
 class LynxBinaryRecyclerDelegate {
@@ -39,6 +41,10 @@ class LynxBinaryRecyclerDelegate {
   virtual bool CompleteDecode() = 0;
 
   virtual LynxTemplateBundle GetCompleteTemplateBundle() = 0;
+
+  // Records the CSS parse tokens parsed by CompleteDecode() to |recorder|.
+  virtual void RecordParsedStyles(
+      std::shared_ptr<ParsedStyleImageBuilder> recorder) {}
 };
 
 // NOTICE:
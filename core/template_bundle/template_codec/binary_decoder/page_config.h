@@ -549,6 +549,22 @@ class PageConfig final : public EntryConfig {
   }
   bool GetListRemoveComponent() { return list_remove_component_; }
 
+  // Max number of recycled list item components of a type kept on the page,
+  // 0 for no limit. Types without their own capacity use the default one.
+  void SetListReusePoolCapacity(int32_t capacity) {
+    list_reuse_pool_capacity_ = capacity > 0 ? capacity : 0;
+  }
+  void SetListReusePoolCapacity(const std::string& reuse_identifier,
+                                int32_t capacity) {
+    list_reuse_pool_capacities_[reuse_identifier] =
+        capacity > 0 ? capacity : 0;
+  }
+  size_t GetListReusePoolCapacity(const std::string& reuse_identifier) const {
+    auto it = list_reuse_pool_capacities_.find(reuse_identifier);
+    return it != list_reuse_pool_capacities_.end() ? it->second
+                                                   : list_reuse_pool_capacity_;
+  }
+
   void SetEnableListMoveOperation(bool list_enable_move) {
     list_enable_move_operation_ = list_enable_move;
   }
@@ -1065,6 +1081,18 @@ class PageConfig final : public EntryConfig {
 
   bool GetEnableReloadLifecycle() { return enable_reload_lifecycle_; }
 
+  void SetEnableComponentMemo(bool enable) { enable_component_memo_ = enable; }
+
+  bool GetEnableComponentMemo() const { return enable_component_memo_; }
+
+  void SetEnablePreloadLazyBundleDependencies(bool enable) {
+    enable_preload_lazy_bundle_dependencies_ = enable;
+  }
+
+  bool GetEnablePreloadLazyBundleDependencies() const {
+    return enable_preload_lazy_bundle_dependencies_;
+  }
+
   void SetEnableOptPushStyleToBundle(TernaryBool enable) {
     enable_opt_push_style_to_bundle_ = enable;
   }
@@ -1259,6 +1287,8 @@ class PageConfig final : public EntryConfig {
   bool enable_save_page_data_{false};
   bool list_new_architecture_{false};
   bool list_remove_component_{false};
+  size_t list_reuse_pool_capacity_{0};
+  std::unordered_map<std::string, size_t> list_reuse_pool_capacities_;
   bool enable_new_list_container_{false};
   bool list_enable_move_operation_{false};
   bool list_enable_plug_{false};
@@ -1429,6 +1459,12 @@ class PageConfig final : public EntryConfig {
   // enable LynxUI onNodeReload lifecycle;
   bool enable_reload_lifecycle_{false};
 
+  // compare the props of radon components by reference before deeply
+  bool enable_component_memo_{false};
+
+  // also preload the lazy bundles declared by preloaded lazy bundles
+  bool enable_preload_lazy_bundle_dependencies_{false};
+
   // enable bind primjs-icu
   bool enable_bind_icu_{false};
 
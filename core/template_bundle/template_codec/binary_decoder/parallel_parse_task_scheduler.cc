@@ -6,8 +6,8 @@
 
 #include "base/include/fml/concurrent_message_loop.h"
 #include "base/trace/native/trace_event.h"
+#include "core/renderer/dom/fiber/element_template_prototype_cache.h"
 #include "core/renderer/dom/fiber/fiber_element.h"
-#include "core/renderer/dom/fiber/tree_resolver.h"
 #include "core/renderer/simple_styling/style_object.h"
 #include "core/renderer/utils/base/element_template_info.h"
 #include "core/template_bundle/template_codec/binary_decoder/binary_decoder_trace_event_def.h"
@@ -16,7 +16,8 @@
 namespace lynx {
 namespace tasm {
 
-ParallelParseTaskScheduler::ParallelParseTaskScheduler() {}
+ParallelParseTaskScheduler::ParallelParseTaskScheduler()
+    : prototype_cache_(std::make_shared<ElementTemplatePrototypeCache>()) {}
 
 ParallelParseTaskScheduler::~ParallelParseTaskScheduler() {
   if (generate_element_template_parse_task_.get() != nullptr) {
@@ -62,6 +63,7 @@ bool ParallelParseTaskScheduler::ParallelParseElementTemplate(
           auto task_info_ptr =
               fml::MakeRefCounted<base::OnceTask<ElementTemplateResult>>(
                   [sub_reader = std::move(sub_reader), start, key = pair.first,
+                   prototype_cache = prototype_cache_,
                    promise = std::move(promise)]() mutable {
                     TRACE_EVENT(
                         LYNX_TRACE_CATEGORY, PARALLEL_READER_RUN_PARSE_TASK,
@@ -72,7 +74,7 @@ bool ParallelParseTaskScheduler::ParallelParseElementTemplate(
                         });
                     sub_reader->Seek(start);
                     auto info = sub_reader->DecodeTemplatesInfoWithKey(key);
-                    auto result = TreeResolver::FromTemplateInfo(*info);
+                    auto result = prototype_cache->Instantiate(key, *info);
                     promise.set_value({std::move(info), result});
                     return;
                   },
@@ -121,7 +123,8 @@ void ParallelParseTaskScheduler::ConstructElement(
   std::promise<Elements> promise;
   std::future<Elements> future = promise.get_future();
   auto task_info_ptr = fml::MakeRefCounted<base::OnceTask<Elements>>(
-      [key, info, promise = std::move(promise)]() mutable {
+      [key, info, prototype_cache = prototype_cache_,
+       promise = std::move(promise)]() mutable {
         TRACE_EVENT(LYNX_TRACE_CATEGORY,
                     PARALLEL_READER_RUN_CONSTRUCT_ELEMENT_TASK,
                     [key](lynx::perfetto::EventContext ctx) {
@@ -129,7 +132,7 @@ void ParallelParseTaskScheduler::ConstructElement(
                       tagInfo->set_name("key");
                       tagInfo->set_string_value(key.c_str());
                     });
-        promise.set_value(TreeResolver::FromTemplateInfo(*info));
+        promise.set_value(prototype_cache->Instantiate(key, *info));
         return;
       },
       std::move(future));
@@ -166,6 +169,15 @@ std::optional<Elements> ParallelParseTaskScheduler::TryGetElements(
   return std::nullopt;
 }
 
+Elements ParallelParseTaskScheduler::InstantiateElementTemplate(
+    const std::string& key, const ElementTemplateInfo& info) {
+  return prototype_cache_->Instantiate(key, info);
+}
+
+void ParallelParseTaskScheduler::ClearElementTemplatePrototypes() {
+  prototype_cache_->Clear();
+}
+
 void ParallelParseTaskScheduler::AsyncDecodeStyleObjects(
     const std::shared_ptr<style::StyleObject*>& style_object_list) {
   base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
@@ -24,6 +24,7 @@ namespace tasm {
 
 class FiberElement;
 class ElementBinaryReader;
+class ElementTemplatePrototypeCache;
 struct ElementTemplateInfo;
 using Elements = base::Vector<fml::RefPtr<FiberElement>>;
 using ElementTemplateResult =
@@ -46,10 +47,20 @@ class ParallelParseTaskScheduler {
   std::optional<Elements> TryGetElements(
       const std::string& key, const std::shared_ptr<ElementTemplateInfo>& info);
 
+  // Creates a detached instance of the element template synchronously.
+  Elements InstantiateElementTemplate(const std::string& key,
+                                      const ElementTemplateInfo& info);
+
+  void ClearElementTemplatePrototypes();
+
   void AsyncDecodeStyleObjects(
       const std::shared_ptr<style::StyleObject*>& style_object_list);
 
  private:
+  // Shared with the parse and construct tasks, which may outlive a pending
+  // call of this scheduler.
+  std::shared_ptr<ElementTemplatePrototypeCache> prototype_cache_;
+
   base::OnceTaskRefptr<int32_t> generate_element_template_parse_task_;
   std::unordered_map<std::string,
                      base::OnceTaskRefptr<std::pair<
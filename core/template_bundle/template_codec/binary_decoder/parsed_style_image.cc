@@ -0,0 +1,518 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/binary_decoder/parsed_style_image.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+#include "base/include/log/logging.h"
+#include "base/include/value/array.h"
+#include "base/include/value/table.h"
+#include "core/renderer/tasm/config.h"
+
+#if defined(OS_WIN)
+#include "base/include/file_utils.h"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+constexpr uint32_t kImageMagic = 0x5350584c;  // "LXPS"
+constexpr uint32_t kImageFormatVersion = 1;
+// Deeply nested values are not produced by the CSS parser, stop decoding
+// corrupted images early.
+constexpr int kMaxValueDepth = 16;
+
+struct ImageHeader {
+  uint32_t magic;
+  uint32_t format_version;
+  uint32_t total_size;
+  // The key follows the header.
+  uint32_t key_size;
+  uint32_t fragment_count;
+  uint32_t fragment_table_offset;
+};
+
+struct FragmentEntry {
+  int32_t id;
+  uint32_t token_count;
+  uint32_t token_table_offset;
+};
+
+enum class ValueTag : uint8_t {
+  kNil = 0,
+  kUndefined,
+  kBool,
+  kInt32,
+  kUInt32,
+  kInt64,
+  kUInt64,
+  kDouble,
+  kString,
+  kArray,
+  kTable,
+};
+
+class ImageWriter {
+ public:
+  explicit ImageWriter(std::vector<uint8_t>& out) : out_(out) {}
+
+  template <typename T>
+  void Write(T value) {
+    const auto* bytes = reinterpret_cast<const uint8_t*>(&value);
+    out_.insert(out_.end(), bytes, bytes + sizeof(T));
+  }
+
+  void WriteString(std::string_view str) {
+    Write<uint32_t>(static_cast<uint32_t>(str.size()));
+    out_.insert(out_.end(), str.begin(), str.end());
+  }
+
+  bool WriteValue(const lepus::Value& value, int depth = 0) {
+    if (depth > kMaxValueDepth) {
+      return false;
+    }
+    if (value.IsNil()) {
+      Write(ValueTag::kNil);
+    } else if (value.IsUndefined()) {
+      Write(ValueTag::kUndefined);
+    } else if (value.IsBool()) {
+      Write(ValueTag::kBool);
+      Write<uint8_t>(value.Bool() ? 1 : 0);
+    } else if (value.IsInt32()) {
+      Write(ValueTag::kInt32);
+      Write<int32_t>(value.Int32());
+    } else if (value.IsUInt32()) {
+      Write(ValueTag::kUInt32);
+      Write<uint32_t>(value.UInt32());
+    } else if (value.IsInt64()) {
+      Write(ValueTag::kInt64);
+      Write<int64_t>(value.Int64());
+    } else if (value.IsUInt64()) {
+      Write(ValueTag::kUInt64);
+      Write<uint64_t>(value.UInt64());
+    } else if (value.IsDouble()) {
+      Write(ValueTag::kDouble);
+      Write<double>(value.Number());
+    } else if (value.IsString()) {
+      Write(ValueTag::kString);
+      WriteString(value.StringView());
+    } else if (value.IsArray()) {
+      auto array = value.Array();
+      Write(ValueTag::kArray);
+      Write<uint32_t>(static_cast<uint32_t>(array->size()));
+      for (size_t i = 0; i < array->size(); ++i) {
+        if (!WriteValue(array->get(i), depth + 1)) {
+          return false;
+        }
+      }
+    } else if (value.IsTable()) {
+      auto table = value.Table();
+      const lepus::Dictionary& dict = *table;
+      Write(ValueTag::kTable);
+      Write<uint32_t>(static_cast<uint32_t>(dict.size()));
+      for (const auto& [key, item] : dict) {
+        WriteString(key.str());
+        if (!WriteValue(item, depth + 1)) {
+          return false;
+        }
+      }
+    } else {
+      // JS values, functions and other ref counted values.
+      return false;
+    }
+    return true;
+  }
+
+  bool WriteStyles(const StyleMap& styles) {
+    Write<uint32_t>(static_cast<uint32_t>(styles.size()));
+    bool succeeded = true;
+    styles.foreach ([this, &succeeded](const CSSPropertyID& id,
+                                       const CSSValue& css_value) {
+      if (!succeeded) {
+        return;
+      }
+      Write<uint32_t>(static_cast<uint32_t>(id));
+      Write<uint8_t>(static_cast<uint8_t>(css_value.GetPattern()));
+      Write<uint8_t>(static_cast<uint8_t>(css_value.GetValueType()));
+      WriteString(css_value.GetDefaultValue().str());
+      const auto& default_value_map = css_value.GetDefaultValueMapOpt();
+      Write<uint8_t>(default_value_map ? 1 : 0);
+      succeeded = WriteValue(css_value.GetValue()) &&
+                  (!default_value_map || WriteValue(*default_value_map));
+    });
+    return succeeded;
+  }
+
+ private:
+  std::vector<uint8_t>& out_;
+};
+
+class ImageReader {
+ public:
+  ImageReader(const uint8_t* data, size_t size, size_t offset)
+      : data_(data), size_(size), offset_(offset) {}
+
+  template <typename T>
+  bool Read(T* value) {
+    if (offset_ > size_ || size_ - offset_ < sizeof(T)) {
+      return false;
+    }
+    std::memcpy(value, data_ + offset_, sizeof(T));
+    offset_ += sizeof(T);
+    return true;
+  }
+
+  bool ReadString(std::string_view* str) {
+    uint32_t length = 0;
+    if (!Read(&length) || size_ - offset_ < length) {
+      return false;
+    }
+    *str = std::string_view(reinterpret_cast<const char*>(data_ + offset_),
+                            length);
+    offset_ += length;
+    return true;
+  }
+
+  bool ReadValue(lepus::Value* value, int depth = 0) {
+    ValueTag tag;
+    if (depth > kMaxValueDepth || !Read(&tag)) {
+      return false;
+    }
+    switch (tag) {
+      case ValueTag::kNil:
+        value->SetNil();
+        return true;
+      case ValueTag::kUndefined:
+        value->SetUndefined();
+        return true;
+      case ValueTag::kBool:
+        return ReadBool(value);
+      case ValueTag::kInt32:
+        return ReadNumber<int32_t>(value);
+      case ValueTag::kUInt32:
+        return ReadNumber<uint32_t>(value);
+      case ValueTag::kInt64:
+        return ReadNumber<int64_t>(value);
+      case ValueTag::kUInt64:
+        return ReadNumber<uint64_t>(value);
+      case ValueTag::kDouble:
+        return ReadNumber<double>(value);
+      case ValueTag::kString: {
+        std::string_view str;
+        if (!ReadString(&str)) {
+          return false;
+        }
+        value->SetString(base::String(str.data(), str.size()));
+        return true;
+      }
+      case ValueTag::kArray: {
+        uint32_t size = 0;
+        if (!Read(&size)) {
+          return false;
+        }
+        auto array = lepus::CArray::Create();
+        array->reserve(size);
+        for (uint32_t i = 0; i < size; ++i) {
+          if (!ReadValue(array->push_back_default(), depth + 1)) {
+            return false;
+          }
+        }
+        value->SetArray(std::move(array));
+        return true;
+      }
+      case ValueTag::kTable: {
+        uint32_t size = 0;
+        if (!Read(&size)) {
+          return false;
+        }
+        auto table = lepus::Dictionary::Create();
+        for (uint32_t i = 0; i < size; ++i) {
+          std::string_view key;
+          lepus::Value item;
+          if (!ReadString(&key) || !ReadValue(&item, depth + 1)) {
+            return false;
+          }
+          table->SetValue(base::String(key.data(), key.size()),
+                          std::move(item));
+        }
+        value->SetTable(std::move(table));
+        return true;
+      }
+    }
+    return false;
+  }
+
+  bool ReadStyles(StyleMap* styles) {
+    uint32_t size = 0;
+    if (!Read(&size)) {
+      return false;
+    }
+    styles->reserve(size);
+    for (uint32_t i = 0; i < size; ++i) {
+      uint32_t id = 0;
+      uint8_t pattern = 0;
+      uint8_t type = 0;
+      std::string_view default_value;
+      uint8_t has_default_value_map = 0;
+      if (!Read(&id) || !Read(&pattern) || !Read(&type) ||
+          !ReadString(&default_value) || !Read(&has_default_value_map)) {
+        return false;
+      }
+      CSSValue css_value;
+      if (!ReadValue(&css_value.GetValue())) {
+        return false;
+      }
+      css_value.SetPattern(static_cast<CSSValuePattern>(pattern));
+      css_value.SetType(static_cast<CSSValueType>(type));
+      if (!default_value.empty()) {
+        css_value.SetDefaultValue(
+            base::String(default_value.data(), default_value.size()));
+      }
+      if (has_default_value_map) {
+        lepus::Value default_value_map;
+        if (!ReadValue(&default_value_map)) {
+          return false;
+        }
+        css_value.SetDefaultValueMap(std::move(default_value_map));
+      }
+      styles->insert_or_assign(static_cast<CSSPropertyID>(id),
+                               std::move(css_value));
+    }
+    return true;
+  }
+
+ private:
+  bool ReadBool(lepus::Value* value) {
+    uint8_t raw = 0;
+    if (!Read(&raw)) {
+      return false;
+    }
+    value->SetBool(raw != 0);
+    return true;
+  }
+
+  template <typename T>
+  bool ReadNumber(lepus::Value* value) {
+    T raw;
+    if (!Read(&raw)) {
+      return false;
+    }
+    value->SetNumber(raw);
+    return true;
+  }
+
+  const uint8_t* data_;
+  size_t size_;
+  size_t offset_;
+};
+
+}  // namespace
+
+ParsedStyleImage::~ParsedStyleImage() {
+#if !defined(OS_WIN)
+  if (mapped_ != nullptr) {
+    munmap(mapped_, size_);
+  }
+#endif
+}
+
+// static
+std::shared_ptr<const ParsedStyleImage> ParsedStyleImage::Open(
+    const std::string& path, const std::string& digest) {
+#if defined(OS_WIN)
+  std::string content;
+  if (!base::FileUtils::ReadFileBinary(path, SIZE_MAX, content)) {
+    return nullptr;
+  }
+  return FromBuffer(std::vector<uint8_t>(content.begin(), content.end()),
+                    digest);
+#else
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return nullptr;
+  }
+  struct stat file_stat;
+  if (fstat(fd, &file_stat) != 0 ||
+      file_stat.st_size < static_cast<off_t>(sizeof(ImageHeader))) {
+    close(fd);
+    return nullptr;
+  }
+  size_t size = static_cast<size_t>(file_stat.st_size);
+  void* mapped = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (mapped == MAP_FAILED) {
+    return nullptr;
+  }
+  std::shared_ptr<ParsedStyleImage> image(new ParsedStyleImage());
+  image->mapped_ = mapped;
+  image->data_ = static_cast<const uint8_t*>(mapped);
+  image->size_ = size;
+  if (!image->Validate(digest)) {
+    LOGW("ParsedStyleImage rejected stale image: " << path);
+    return nullptr;
+  }
+  return image;
+#endif
+}
+
+// static
+std::shared_ptr<const ParsedStyleImage> ParsedStyleImage::FromBuffer(
+    std::vector<uint8_t> buffer, const std::string& digest) {
+  std::shared_ptr<ParsedStyleImage> image(new ParsedStyleImage());
+  image->buffer_ = std::move(buffer);
+  image->data_ = image->buffer_.data();
+  image->size_ = image->buffer_.size();
+  if (!image->Validate(digest)) {
+    return nullptr;
+  }
+  return image;
+}
+
+// static
+std::string ParsedStyleImage::MakeKey(const std::string& digest) {
+  return digest + "@" + LYNX_VERSION.ToString();
+}
+
+bool ParsedStyleImage::Validate(const std::string& digest) const {
+  ImageHeader header;
+  if (size_ < sizeof(header)) {
+    return false;
+  }
+  std::memcpy(&header, data_, sizeof(header));
+  if (header.magic != kImageMagic ||
+      header.format_version != kImageFormatVersion ||
+      header.total_size != size_ ||
+      header.key_size > size_ - sizeof(header)) {
+    return false;
+  }
+  const std::string key = MakeKey(digest);
+  if (header.key_size != key.size() ||
+      std::memcmp(data_ + sizeof(header), key.data(), key.size()) != 0) {
+    return false;
+  }
+  const size_t table_size =
+      static_cast<size_t>(header.fragment_count) * sizeof(FragmentEntry);
+  return header.fragment_table_offset <= size_ &&
+         table_size <= size_ - header.fragment_table_offset &&
+         header.fragment_table_offset % alignof(FragmentEntry) == 0;
+}
+
+uint32_t ParsedStyleImage::fragment_count() const {
+  return reinterpret_cast<const ImageHeader*>(data_)->fragment_count;
+}
+
+namespace {
+
+const FragmentEntry* FindFragment(const uint8_t* data, int32_t fragment_id) {
+  const auto* header = reinterpret_cast<const ImageHeader*>(data);
+  const auto* begin = reinterpret_cast<const FragmentEntry*>(
+      data + header->fragment_table_offset);
+  const auto* end = begin + header->fragment_count;
+  const auto* it = std::lower_bound(
+      begin, end, fragment_id,
+      [](const FragmentEntry& entry, int32_t id) { return entry.id < id; });
+  return it != end && it->id == fragment_id ? it : nullptr;
+}
+
+}  // namespace
+
+bool ParsedStyleImage::GetStyles(int32_t fragment_id, uint32_t token_index,
+                                 StyleMap* styles) const {
+  const auto* fragment = FindFragment(data_, fragment_id);
+  if (fragment == nullptr || token_index >= fragment->token_count) {
+    return false;
+  }
+  ImageReader table_reader(
+      data_, size_,
+      fragment->token_table_offset + token_index * sizeof(uint32_t));
+  uint32_t token_offset = 0;
+  if (!table_reader.Read(&token_offset) || token_offset == 0) {
+    return false;
+  }
+  StyleMap decoded;
+  if (!ImageReader(data_, size_, token_offset).ReadStyles(&decoded)) {
+    return false;
+  }
+  *styles = std::move(decoded);
+  return true;
+}
+
+bool ParsedStyleImageBuilder::Record(int32_t fragment_id,
+                                     uint32_t token_index,
+                                     const StyleMap& styles) {
+  std::vector<uint8_t> encoded;
+  if (!ImageWriter(encoded).WriteStyles(styles)) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  fragments_[fragment_id].insert_or_assign(token_index, std::move(encoded));
+  return true;
+}
+
+bool ParsedStyleImageBuilder::empty() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return fragments_.empty();
+}
+
+std::vector<uint8_t> ParsedStyleImageBuilder::Serialize(
+    const std::string& digest) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  const std::string key = ParsedStyleImage::MakeKey(digest);
+  std::vector<uint8_t> out;
+  ImageWriter writer(out);
+
+  ImageHeader header{kImageMagic, kImageFormatVersion, 0,
+                     static_cast<uint32_t>(key.size()),
+                     static_cast<uint32_t>(fragments_.size()), 0};
+  writer.Write(header);
+  out.insert(out.end(), key.begin(), key.end());
+  auto align = [&out]() {
+    out.resize((out.size() + alignof(uint32_t) - 1) & ~(alignof(uint32_t) - 1));
+  };
+  align();
+
+  // Reserve the fragment table, it is filled when the token tables are laid
+  // out.
+  header.fragment_table_offset = static_cast<uint32_t>(out.size());
+  out.resize(out.size() +
+             fragments_.size() * sizeof(FragmentEntry));
+
+  size_t fragment_index = 0;
+  for (const auto& [fragment_id, tokens] : fragments_) {
+    const uint32_t token_count =
+        tokens.empty() ? 0 : tokens.rbegin()->first + 1;
+    const uint32_t token_table_offset = static_cast<uint32_t>(out.size());
+    out.resize(out.size() + token_count * sizeof(uint32_t));
+    for (const auto& [token_index, encoded] : tokens) {
+      const uint32_t token_offset = static_cast<uint32_t>(out.size());
+      std::memcpy(out.data() + token_table_offset +
+                      token_index * sizeof(uint32_t),
+                  &token_offset, sizeof(token_offset));
+      out.insert(out.end(), encoded.begin(), encoded.end());
+    }
+    align();
+    FragmentEntry entry{fragment_id, token_count,
+                                          token_table_offset};
+    std::memcpy(out.data() + header.fragment_table_offset +
+                    fragment_index++ * sizeof(entry),
+                &entry, sizeof(entry));
+  }
+
+  header.total_size = static_cast<uint32_t>(out.size());
+  std::memcpy(out.data(), &header, sizeof(header));
+  return out;
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,93 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_DECODER_PARSED_STYLE_IMAGE_H_
+#define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_DECODER_PARSED_STYLE_IMAGE_H_
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "core/renderer/css/css_property.h"
+
+namespace lynx {
+namespace tasm {
+
+// A read-only image of the parsed attributes of the CSS parse tokens of a
+// template, addressed by the CSS fragment id and the index of the token in the
+// decoding order of the fragment.
+//
+// The image is position independent, so it can be mapped from disk and used
+// in place. It is bound to the digest of the template binary and the engine
+// version which produced it, an image that does not match both is rejected.
+// Values are stored in the host byte order, all supported platforms are little
+// endian.
+class ParsedStyleImage {
+ public:
+  ~ParsedStyleImage();
+
+  ParsedStyleImage(const ParsedStyleImage&) = delete;
+  ParsedStyleImage& operator=(const ParsedStyleImage&) = delete;
+
+  // Maps the image at |path|, returns nullptr if the file does not exist or
+  // was not produced for |digest| by this engine.
+  static std::shared_ptr<const ParsedStyleImage> Open(
+      const std::string& path, const std::string& digest);
+
+  static std::shared_ptr<const ParsedStyleImage> FromBuffer(
+      std::vector<uint8_t> buffer, const std::string& digest);
+
+  // The key an image is bound to, it includes the engine version.
+  static std::string MakeKey(const std::string& digest);
+
+  // Returns false if the token is not in the image.
+  bool GetStyles(int32_t fragment_id, uint32_t token_index,
+                 StyleMap* styles) const;
+
+  uint32_t fragment_count() const;
+
+ private:
+  ParsedStyleImage() = default;
+
+  bool Validate(const std::string& digest) const;
+
+  const uint8_t* data_{nullptr};
+  size_t size_{0};
+  // Either the image is mapped or it owns the buffer.
+  void* mapped_{nullptr};
+  std::vector<uint8_t> buffer_;
+};
+
+// Collects the parsed attributes of the tokens while decoding and serializes
+// them as a ParsedStyleImage. Thread safe, fragments may be decoded on
+// different threads.
+class ParsedStyleImageBuilder {
+ public:
+  ParsedStyleImageBuilder() = default;
+
+  ParsedStyleImageBuilder(const ParsedStyleImageBuilder&) = delete;
+  ParsedStyleImageBuilder& operator=(const ParsedStyleImageBuilder&) = delete;
+
+  // Returns false if the styles hold a value the image can not represent,
+  // the token is left out of the image then.
+  bool Record(int32_t fragment_id, uint32_t token_index,
+              const StyleMap& styles);
+
+  bool empty();
+  std::vector<uint8_t> Serialize(const std::string& digest);
+
+ private:
+  std::mutex mutex_;
+  // Encoded styles by fragment id and token index, ordered so that the
+  // fragment table is sorted.
+  std::map<int32_t, std::map<uint32_t, std::vector<uint8_t>>> fragments_;
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_DECODER_PARSED_STYLE_IMAGE_H_
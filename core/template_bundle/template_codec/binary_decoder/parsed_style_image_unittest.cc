@@ -0,0 +1,139 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/binary_decoder/parsed_style_image.h"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/include/file_utils.h"
+#include "base/include/value/array.h"
+#include "base/include/value/table.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+namespace {
+
+constexpr char kDigest[] = "0123456789abcdef0123456789abcdef";
+
+StyleMap MakeStyles() {
+  StyleMap styles;
+  styles.insert_or_assign(kPropertyIDWidth,
+                          CSSValue(lepus::Value(10.5), CSSValuePattern::PX));
+  styles.insert_or_assign(kPropertyIDDisplay, CSSValue::MakeEnum(2));
+
+  auto transform = lepus::CArray::Create();
+  auto item = lepus::CArray::Create();
+  item->emplace_back(static_cast<int32_t>(1));
+  item->emplace_back(static_cast<int64_t>(1) << 40);
+  item->emplace_back("rotate");
+  transform->emplace_back(std::move(item));
+  CSSValue transform_value;
+  transform_value.SetArray(std::move(transform));
+  styles.insert_or_assign(kPropertyIDTransform, std::move(transform_value));
+
+  auto table = lepus::Dictionary::Create();
+  table->SetValue("visible", true);
+  table->SetValue("count", static_cast<uint32_t>(3));
+  auto default_value_map = lepus::Dictionary::Create();
+  default_value_map->SetValue("--main-color", "blue");
+  CSSValue variable_value(lepus::Value(std::move(table)), CSSValuePattern::MAP,
+                          CSSValueType::VARIABLE, "red",
+                          lepus::Value(std::move(default_value_map)));
+  styles.insert_or_assign(kPropertyIDColor, std::move(variable_value));
+  return styles;
+}
+
+void ExpectSameStyles(const StyleMap& expected, const StyleMap& actual) {
+  ASSERT_EQ(expected.size(), actual.size());
+  expected.foreach ([&actual](const CSSPropertyID& id, const CSSValue& value) {
+    auto it = actual.find(id);
+    ASSERT_TRUE(it != actual.end());
+    EXPECT_EQ(it->second, value);
+    EXPECT_EQ(it->second.GetValueType(), value.GetValueType());
+    EXPECT_EQ(it->second.GetDefaultValue().str(),
+              value.GetDefaultValue().str());
+    const auto& map = value.GetDefaultValueMapOpt();
+    const auto& actual_map = it->second.GetDefaultValueMapOpt();
+    ASSERT_EQ(map == nullptr, actual_map == nullptr);
+    if (map) {
+      EXPECT_EQ(*map, *actual_map);
+    }
+  });
+}
+
+}  // namespace
+
+TEST(ParsedStyleImageTest, RoundTrip) {
+  auto styles = MakeStyles();
+  ParsedStyleImageBuilder builder;
+  EXPECT_TRUE(builder.empty());
+  EXPECT_TRUE(builder.Record(3, 0, styles));
+  EXPECT_TRUE(builder.Record(3, 2, StyleMap()));
+  EXPECT_TRUE(builder.Record(-1, 1, styles));
+
+  auto image =
+      ParsedStyleImage::FromBuffer(builder.Serialize(kDigest), kDigest);
+  ASSERT_NE(image, nullptr);
+  EXPECT_EQ(image->fragment_count(), 2u);
+
+  StyleMap decoded;
+  ASSERT_TRUE(image->GetStyles(3, 0, &decoded));
+  ExpectSameStyles(styles, decoded);
+  ASSERT_TRUE(image->GetStyles(-1, 1, &decoded));
+  ExpectSameStyles(styles, decoded);
+  ASSERT_TRUE(image->GetStyles(3, 2, &decoded));
+  EXPECT_TRUE(decoded.empty());
+
+  // Tokens and fragments which were not recorded.
+  EXPECT_FALSE(image->GetStyles(3, 1, &decoded));
+  EXPECT_FALSE(image->GetStyles(3, 3, &decoded));
+  EXPECT_FALSE(image->GetStyles(-1, 0, &decoded));
+  EXPECT_FALSE(image->GetStyles(4, 0, &decoded));
+}
+
+TEST(ParsedStyleImageTest, RejectsMismatchedOrCorruptedImage) {
+  ParsedStyleImageBuilder builder;
+  EXPECT_TRUE(builder.Record(1, 0, MakeStyles()));
+  auto buffer = builder.Serialize(kDigest);
+
+  EXPECT_EQ(ParsedStyleImage::FromBuffer(buffer, "another digest"), nullptr);
+
+  auto truncated = buffer;
+  truncated.resize(truncated.size() / 2);
+  EXPECT_EQ(ParsedStyleImage::FromBuffer(truncated, kDigest), nullptr);
+
+  auto bad_magic = buffer;
+  bad_magic[0] ^= 0xff;
+  EXPECT_EQ(ParsedStyleImage::FromBuffer(bad_magic, kDigest), nullptr);
+}
+
+TEST(ParsedStyleImageTest, OpenMapsFile) {
+  ParsedStyleImageBuilder builder;
+  auto styles = MakeStyles();
+  EXPECT_TRUE(builder.Record(0, 0, styles));
+  auto buffer = builder.Serialize(kDigest);
+
+  std::string path = ::testing::TempDir() + "parsed_style_image_test.lxps";
+  ASSERT_TRUE(
+      base::FileUtils::WriteFileBinary(path, buffer.data(), buffer.size()));
+
+  auto image = ParsedStyleImage::Open(path, kDigest);
+  ASSERT_NE(image, nullptr);
+  StyleMap decoded;
+  ASSERT_TRUE(image->GetStyles(0, 0, &decoded));
+  ExpectSameStyles(styles, decoded);
+
+  EXPECT_EQ(ParsedStyleImage::Open(path + ".missing", kDigest), nullptr);
+  remove(path.c_str());
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
@@ -158,6 +158,7 @@ void TemplateBinaryReader::CopyForCSSAsyncDecode(
       other.enable_css_variable_multi_default_value_;
   css_section_range_ = other.css_section_range_;
   lepus_chunk_route_ = other.lepus_chunk_route_;
+  parsed_style_image_ = other.parsed_style_image_;
 }
 
 void TemplateBinaryReader::EnsureParallelParseTaskScheduler() {
@@ -418,5 +419,10 @@ LynxTemplateBundle TemplateBinaryReader::GetCompleteTemplateBundle() {
   return std::move(template_bundle());
 }
 
+void TemplateBinaryReader::RecordParsedStyles(
+    std::shared_ptr<ParsedStyleImageBuilder> recorder) {
+  SetParsedStyleRecorder(std::move(recorder));
+}
+
 }  // namespace tasm
 }  // namespace lynx
@@ -73,6 +73,9 @@ class TemplateBinaryReader : public LynxBinaryReader,
 
   LynxTemplateBundle GetCompleteTemplateBundle() override;
 
+  void RecordParsedStyles(
+      std::shared_ptr<ParsedStyleImageBuilder> recorder) override;
+
   // Decode result
   const CompileOptions& GetCompileOptions() { return compile_options_; }
   bool EnableCSSParser() { return enable_css_parser_; }
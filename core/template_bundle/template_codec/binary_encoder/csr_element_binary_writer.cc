@@ -75,6 +75,14 @@ void CSRElementBinaryWriter::EncodeTemplatesToBinary(
   EncodeTemplatesBody(templates);
 }
 
+void CSRElementBinaryWriter::EncodeSingleTemplateBody(
+    const rapidjson::Value& element_array) {
+  WriteCompactU32(element_array.GetArray().Size());
+  for (const auto& e : element_array.GetArray()) {
+    EncodeElementRecursively(&e);
+  }
+}
+
 void CSRElementBinaryWriter::EncodeParsedStylesToBinary(
     const rapidjson::Value* parsed_styles) {
   // 1. Get parsed styles router start postion
@@ -99,10 +107,7 @@ void CSRElementBinaryWriter::EncodeTemplatesBody(
                                             start_offset);
 
     // Encode Template array
-    WriteCompactU32(pair.value.GetArray().Size());
-    for (const auto& e : pair.value.GetArray()) {
-      EncodeElementRecursively(&e);
-    }
+    EncodeSingleTemplateBody(pair.value);
 
     // update start offset
     start_offset = stream()->size() - descriptor_offset;
@@ -30,12 +30,21 @@ class CSRElementBinaryWriter : public lepus::ContextBinaryWriter {
   // parameter is defined as `Record<string, Array<RootElement>>`.
   void EncodeTemplatesToBinary(const rapidjson::Document* templates);
 
+  // This API is used to encode the element trees of one template, i.e. one
+  // value of the `Record<string, Array<RootElement>>` above, without the
+  // router. The result does not depend on what is encoded before it, so the
+  // templates can be encoded separately and concatenated.
+  void EncodeSingleTemplateBody(const rapidjson::Value& element_array);
+
   // This API is used to encode the parsed styles. The
   // shared parsed styles among the elements can be extracted into a separate
   // map and passed as the parameter, which is formatted as
   // `Record<string, Array<ParsedStyle>>`.
   void EncodeParsedStylesToBinary(const rapidjson::Value* parsed_styles);
 
+ protected:
+  void EncodeOrderedStringKeyRouter(tasm::OrderedStringKeyRouter& router);
+
  private:
   void EncodeParsedStyles(const rapidjson::Value* parsed_styles,
                           uint32_t router_start_pos);
@@ -44,8 +53,6 @@ class CSRElementBinaryWriter : public lepus::ContextBinaryWriter {
 
   void EncodeStringKeyRouter(tasm::StringKeyRouter& router);
 
-  void EncodeOrderedStringKeyRouter(tasm::OrderedStringKeyRouter& router);
-
   void EncodeElementRecursively(const rapidjson::Value* element);
 
   void EncodeElementParsedStylesInternal(const rapidjson::Value* parsed_styles,
@@ -0,0 +1,151 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/binary_encoder/encode_section_cache.h"
+
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstring>
+
+#include "base/include/content_hash.h"
+#include "base/include/file_utils.h"
+#include "base/include/path_utils.h"
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+// Bump it whenever the encoding of a cached part changes.
+constexpr char kCacheVersion[] = "2";
+constexpr char kEntrySuffix[] = ".lxec";
+constexpr char kTempSuffix[] = ".tmp";
+constexpr uint32_t kEntryMagic = 0x4345584c;  // "LXEC"
+constexpr size_t kEntryHeaderSize = 2 * sizeof(uint32_t);
+constexpr size_t kMaxEntrySize = 256 * 1024 * 1024;
+
+void UpdateDigest(base::ContentHasher& hasher, const std::string& text) {
+  // A separator keeps e.g. ("ab", "c") and ("a", "bc") apart.
+  hasher.Update(text.c_str(), text.size() + 1);
+}
+
+}  // namespace
+
+EncodeSectionCache::EncodeSectionCache(const std::string& cache_dir,
+                                       const std::string& fingerprint)
+    : cache_dir_(cache_dir), fingerprint_(fingerprint) {}
+
+std::string EncodeSectionCache::MakeFingerprint(
+    const CompileOptions& compile_options, const std::string& lepus_version) {
+  std::string fingerprint = kCacheVersion;
+  fingerprint += ';';
+  fingerprint += lepus_version;
+  fingerprint += ';';
+  fingerprint += compile_options.target_sdk_version_;
+  fingerprint += ';';
+  // The template debug url only goes to the header and does not affect any
+  // cached part.
+#define APPEND_FIXED_LENGTH_FIELD(type, field, id)                        \
+  fingerprint +=                                                          \
+      std::to_string(id) + '=' +                                          \
+      std::to_string(static_cast<int64_t>(compile_options.field)) + ','
+  FOREACH_FIXED_LENGTH_FIELD(APPEND_FIXED_LENGTH_FIELD)
+#undef APPEND_FIXED_LENGTH_FIELD
+  return fingerprint;
+}
+
+std::string EncodeSectionCache::MakeKey(const std::string& kind,
+                                        const std::string& name,
+                                        const std::string& content) const {
+  base::ContentHasher hasher;
+  UpdateDigest(hasher, fingerprint_);
+  UpdateDigest(hasher, kind);
+  UpdateDigest(hasher, name);
+  hasher.Update(content);
+  return hasher.Finalize().ToHexString();
+}
+
+bool EncodeSectionCache::Get(const std::string& key,
+                             std::vector<uint8_t>& data) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      data = it->second;
+      ++hit_count_;
+      return true;
+    }
+  }
+
+  std::string file_content;
+  auto path = PathFor(key);
+  if (path.empty() ||
+      !base::FileUtils::ReadFileBinary(path, kMaxEntrySize, file_content) ||
+      file_content.size() < kEntryHeaderSize) {
+    ++miss_count_;
+    return false;
+  }
+  uint32_t header[2];
+  memcpy(header, file_content.data(), kEntryHeaderSize);
+  if (header[0] != kEntryMagic ||
+      header[1] != file_content.size() - kEntryHeaderSize) {
+    ++miss_count_;
+    return false;
+  }
+  data.assign(file_content.begin() + kEntryHeaderSize, file_content.end());
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    entries_.emplace(key, data);
+  }
+  ++hit_count_;
+  return true;
+}
+
+void EncodeSectionCache::Put(const std::string& key,
+                             const std::vector<uint8_t>& data) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!entries_.emplace(key, data).second) {
+      return;
+    }
+  }
+  Write(key, data);
+}
+
+std::string EncodeSectionCache::PathFor(const std::string& key) const {
+  if (cache_dir_.empty()) {
+    return std::string();
+  }
+  return base::PathUtils::JoinPaths({cache_dir_, key + kEntrySuffix});
+}
+
+bool EncodeSectionCache::Write(const std::string& key,
+                               const std::vector<uint8_t>& data) {
+  auto path = PathFor(key);
+  if (path.empty() || data.size() > kMaxEntrySize - kEntryHeaderSize) {
+    return false;
+  }
+  std::vector<uint8_t> file_content(kEntryHeaderSize);
+  const uint32_t header[2] = {kEntryMagic, static_cast<uint32_t>(data.size())};
+  memcpy(file_content.data(), header, kEntryHeaderSize);
+  file_content.insert(file_content.end(), data.begin(), data.end());
+
+  // Several encoder processes may share the directory, so the temp file is
+  // unique per process, and the rename makes the entry appear atomically.
+  auto temp_path = path + "." + std::to_string(getpid()) + kTempSuffix;
+  if (!base::FileUtils::WriteFileBinary(temp_path, file_content.data(),
+                                        file_content.size())) {
+    remove(temp_path.c_str());
+    return false;
+  }
+  if (rename(temp_path.c_str(), path.c_str())) {
+    remove(temp_path.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace tasm
+}  // namespace lynx
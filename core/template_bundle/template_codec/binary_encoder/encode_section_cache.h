@@ -0,0 +1,72 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_ENCODER_ENCODE_SECTION_CACHE_H_
+#define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_ENCODER_ENCODE_SECTION_CACHE_H_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/template_bundle/template_codec/compile_options.h"
+
+namespace lynx {
+namespace tasm {
+
+/**
+ * @class EncodeSectionCache
+ *
+ * Caches the encoded binary of the independent parts of a template, e.g. an
+ * element template of a component or the bytecode of a JS file, so that
+ * rebuilding a template after a one-file change only encodes the changed
+ * parts again and relinks the section routes.
+ *
+ * An entry is keyed by the digest of its content together with a fingerprint
+ * of everything else that affects its encoding: the compile options, the
+ * lepus version and the version of the cache itself. Entries are kept in
+ * memory and, if a directory is given, in one file per entry so that they
+ * survive across builds. The cache is thread-safe.
+ */
+class EncodeSectionCache {
+ public:
+  // |cache_dir| may be empty, then the entries are kept in memory only.
+  EncodeSectionCache(const std::string& cache_dir,
+                     const std::string& fingerprint);
+
+  static std::string MakeFingerprint(const CompileOptions& compile_options,
+                                     const std::string& lepus_version);
+
+  // |kind| separates the entries of different encoders, |name| is the name of
+  // the part, e.g. the key of an element template.
+  std::string MakeKey(const std::string& kind, const std::string& name,
+                      const std::string& content) const;
+
+  bool Get(const std::string& key, std::vector<uint8_t>& data);
+  void Put(const std::string& key, const std::vector<uint8_t>& data);
+
+  size_t hit_count() const { return hit_count_; }
+  size_t miss_count() const { return miss_count_; }
+
+ private:
+  std::string PathFor(const std::string& key) const;
+  bool Write(const std::string& key, const std::vector<uint8_t>& data);
+
+  const std::string cache_dir_;
+  const std::string fingerprint_;
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, std::vector<uint8_t>> entries_;
+
+  std::atomic<size_t> hit_count_{0};
+  std::atomic<size_t> miss_count_{0};
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_ENCODER_ENCODE_SECTION_CACHE_H_
@@ -0,0 +1,77 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/binary_encoder/encode_section_cache.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+#include "base/include/file_utils.h"
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+TEST(EncodeSectionCacheTest, KeyCoversFingerprintAndContent) {
+  CompileOptions options;
+  options.target_sdk_version_ = "3.0";
+  auto fingerprint = EncodeSectionCache::MakeFingerprint(options, "1.0");
+  EncodeSectionCache cache("", fingerprint);
+  auto key = cache.MakeKey("element_template", "a", "[]");
+  EXPECT_EQ(key, cache.MakeKey("element_template", "a", "[]"));
+  EXPECT_NE(key, cache.MakeKey("js_bytecode", "a", "[]"));
+  EXPECT_NE(key, cache.MakeKey("element_template", "b", "[]"));
+  EXPECT_NE(key, cache.MakeKey("element_template", "a", "[{}]"));
+  EXPECT_NE(cache.MakeKey("element_template", "ab", "c"),
+            cache.MakeKey("element_template", "a", "bc"));
+
+  options.enable_css_selector_ = true;
+  EncodeSectionCache other_options(
+      "", EncodeSectionCache::MakeFingerprint(options, "1.0"));
+  EXPECT_NE(key, other_options.MakeKey("element_template", "a", "[]"));
+  // The debug url does not affect any cached part.
+  options.enable_css_selector_ = false;
+  options.template_debug_url_ = "http://debug";
+  EXPECT_EQ(fingerprint, EncodeSectionCache::MakeFingerprint(options, "1.0"));
+  EXPECT_NE(fingerprint, EncodeSectionCache::MakeFingerprint(options, "2.0"));
+}
+
+TEST(EncodeSectionCacheTest, InMemory) {
+  EncodeSectionCache cache("", "fingerprint");
+  std::vector<uint8_t> data;
+  EXPECT_FALSE(cache.Get("key", data));
+  cache.Put("key", {1, 2, 3});
+  EXPECT_TRUE(cache.Get("key", data));
+  EXPECT_EQ(data, std::vector<uint8_t>({1, 2, 3}));
+  EXPECT_EQ(cache.hit_count(), 1u);
+  EXPECT_EQ(cache.miss_count(), 1u);
+}
+
+TEST(EncodeSectionCacheTest, SurvivesAcrossInstancesInDirectory) {
+  const std::string dir = ::testing::TempDir();
+  std::string key;
+  {
+    EncodeSectionCache cache(dir, "fingerprint");
+    key = cache.MakeKey("element_template", "a", "[]");
+    cache.Put(key, {4, 5, 6, 7});
+  }
+  EncodeSectionCache cache(dir, "fingerprint");
+  std::vector<uint8_t> data;
+  ASSERT_TRUE(cache.Get(key, data));
+  EXPECT_EQ(data, std::vector<uint8_t>({4, 5, 6, 7}));
+
+  // A damaged entry is a miss.
+  const std::string path = dir + "/" + key + ".lxec";
+  const unsigned char garbage[] = {1, 2, 3};
+  ASSERT_TRUE(base::FileUtils::WriteFileBinary(path, garbage, sizeof(garbage)));
+  EncodeSectionCache damaged(dir, "fingerprint");
+  EXPECT_FALSE(damaged.Get(key, data));
+  remove(path.c_str());
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
@@ -4,6 +4,10 @@
 
 #include "core/template_bundle/template_codec/binary_encoder/encode_util.h"
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
 #include <utility>
 
 #include "core/runtime/jscache/quickjs/bytecode/quickjs_bytecode_provider_src.h"
@@ -382,5 +386,48 @@ bool writefile(const std::string& filename, const std::string& src) {
   return true;
 }
 
+void ForEachInParallel(size_t count, const std::function<void(size_t)>& func,
+                       bool parallel) {
+  size_t worker_count = 1;
+#ifndef __EMSCRIPTEN__
+  if (parallel) {
+    worker_count = std::min<size_t>(
+        count, std::max<unsigned>(std::thread::hardware_concurrency(), 1));
+  }
+#endif
+  if (worker_count <= 1) {
+    for (size_t i = 0; i < count; ++i) {
+      func(i);
+    }
+    return;
+  }
+
+  std::atomic<size_t> next_index{0};
+  std::vector<std::exception_ptr> exceptions(count);
+  auto work = [&]() {
+    for (size_t i = next_index++; i < count; i = next_index++) {
+      try {
+        func(i);
+      } catch (...) {
+        exceptions[i] = std::current_exception();
+      }
+    }
+  };
+  std::vector<std::thread> workers;
+  workers.reserve(worker_count - 1);
+  for (size_t i = 1; i < worker_count; ++i) {
+    workers.emplace_back(work);
+  }
+  work();
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  for (const auto& exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+}
+
 }  // namespace tasm
 }  // namespace lynx
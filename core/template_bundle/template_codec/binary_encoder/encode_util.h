@@ -5,6 +5,8 @@
 #ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_ENCODER_ENCODE_UTIL_H_
 #define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_BINARY_ENCODER_ENCODE_UTIL_H_
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
 #include <vector>
@@ -97,6 +99,12 @@ std::string BinarySectionTypeToString(BinarySection section);
 
 bool writefile(const std::string& filename, const std::string& src);
 
+// Calls |func| for every index in [0, count), on worker threads if |parallel|.
+// It returns after all the calls are done and rethrows the exception of the
+// smallest index if any call throws, as a sequential loop would.
+void ForEachInParallel(size_t count, const std::function<void(size_t)>& func,
+                       bool parallel);
+
 }  // namespace tasm
 }  // namespace lynx
 
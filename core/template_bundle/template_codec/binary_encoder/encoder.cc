@@ -19,6 +19,7 @@
 #include "core/runtime/vm/lepus/quick_context.h"
 #include "core/runtime/vm/lepus/vm_context.h"
 #include "core/template_bundle/template_codec/binary_encoder/css_encoder/css_parser.h"
+#include "core/template_bundle/template_codec/binary_encoder/encode_section_cache.h"
 #include "core/template_bundle/template_codec/binary_encoder/encode_util.h"
 #include "core/template_bundle/template_codec/binary_encoder/repack_binary_reader.h"
 #include "core/template_bundle/template_codec/binary_encoder/repack_binary_writer.h"
@@ -277,8 +278,32 @@ std::unique_ptr<TemplateBinaryWriter> EncodeTemplate(
       encoder_options.generator_options_.js_code_,
       &encoder_options.generator_options_.custom_sections_,
       encoder_options.generator_options_.enable_debug_info_);
+  encoder->set_enable_parallel_encode(
+      encoder_options.generator_options_.enable_parallel_encode_);
+  std::shared_ptr<EncodeSectionCache> section_cache;
+  if (!encoder_options.generator_options_.encode_cache_dir_.empty()) {
+    section_cache = std::make_shared<EncodeSectionCache>(
+        encoder_options.generator_options_.encode_cache_dir_,
+        EncodeSectionCache::MakeFingerprint(
+            encoder_options.compile_options_,
+            encoder_options.generator_options_.lepus_version_));
+    encoder->set_section_cache(section_cache);
+  }
   try {
     size_t binary_size = encoder->Encode();
+    if (section_cache && !encoder_options.generator_options_.silence_) {
+      printf("encode cache: %zu hits, %zu misses\n",
+             section_cache->hit_count(), section_cache->miss_count());
+    }
+    if (encoder_options.generator_options_.dump_lepus_instruction_count_ &&
+        vm_context->IsVMContext()) {
+      const auto& stats = lepus::VMContext::Cast(vm_context)->compile_stats();
+      printf(
+          "lepus instructions: %zu before optimization, %zu after, "
+          "%zu folded into constants, %zu moves elided\n",
+          stats.UnoptimizedInstructionCount(), stats.instruction_count,
+          stats.folded_instruction_count, stats.elided_move_count);
+    }
     if (binary_size == 0) {
       std::stringstream ss;
       ss << "error: encode failed:";
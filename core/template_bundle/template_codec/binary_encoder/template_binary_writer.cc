@@ -14,8 +14,10 @@
 #include <list>
 #include <memory>
 #include <set>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include "base/include/sorted_for_each.h"
 #include "core/renderer/simple_styling/style_object.h"
@@ -28,7 +30,10 @@
 #include "core/runtime/vm/lepus/quick_context.h"
 #include "core/template_bundle/template_codec/binary_encoder/style_object_encoder/style_object_parser.h"
 #include "core/template_bundle/template_codec/generator/source_generator.h"
+#include "core/template_bundle/template_codec/section_compression.h"
 #include "core/template_bundle/template_codec/template_binary.h"
+#include "third_party/rapidjson/stringbuffer.h"
+#include "third_party/rapidjson/writer.h"
 
 namespace lynx {
 namespace tasm {
@@ -171,9 +176,13 @@ size_t TemplateBinaryWriter::EncodeFlexibleTemplateBody(
 
   encode_func();
 
-  EncodeSectionRoute();
+  if (compile_options_.enable_section_compression_) {
+    EncodeCompressedSections();
+  } else {
+    EncodeSectionRoute();
 
-  MoveLastSectionToFirst(BinarySection::SECTION_ROUTE);
+    MoveLastSectionToFirst(BinarySection::SECTION_ROUTE);
+  }
 
   binary_info_.total_size_ = stream_->size();
   return stream_->size();
@@ -212,6 +221,56 @@ void TemplateBinaryWriter::MoveLastSectionToFirst(
       Range(insert_pos + 1, insert_pos + cur_size - info.start_offset_);
 }
 
+void TemplateBinaryWriter::EncodeCompressedSections() {
+  DCHECK(binary_info_.section_ary_.size() > 0);
+  // The sections are encoded in a row after the header. Take them out of the
+  // stream and write them again after the route, compressed if it is smaller.
+  const std::vector<uint8_t> encoded = stream_->byte_array();
+  const TemplateBinary::SectionList sections = binary_info_.section_ary_;
+  const uint32_t start_pos = sections[0].start_offset_;
+
+  std::vector<std::vector<uint8_t>> blocks(sections.size());
+  std::vector<SectionStorage> storages(sections.size(), SectionStorage::kRaw);
+  for (size_t i = 0; i < sections.size(); ++i) {
+    const auto& info = sections[i];
+    storages[i] = SectionCompression::Store(
+        encoded.data() + info.start_offset_,
+        info.end_offset_ - info.start_offset_, blocks[i]);
+  }
+
+  stream_.reset(new lepus::ByteArrayOutputStream());
+  WriteData(encoded.data(), start_pos, "header");
+  {
+    TemplateSectionRecorder recorder(
+        BinarySection::SECTION_ROUTE, BinaryOffsetType::TYPE_SECTION_ROUTE,
+        this, stream_.get(), binary_info_, offset_map_, section_size_info_);
+    // Same as EncodeSectionRoute, with the storage and the stored size of
+    // every section. The offsets are those of the decompressed sections.
+    WriteCompactU32(sections.size());
+    for (size_t i = 0; i < sections.size(); ++i) {
+      WriteU8(sections[i].type_);
+      WriteCompactU32(sections[i].start_offset_ - start_pos);
+      WriteCompactU32(sections[i].end_offset_ - start_pos);
+      WriteU8(static_cast<uint8_t>(storages[i]));
+      WriteCompactU32(static_cast<uint32_t>(blocks[i].size()));
+    }
+  }
+
+  // Like MoveLastSectionToFirst, the offset map refers to the binary with the
+  // route in front of the sections, after the decoder decompressed them.
+  const uint32_t route_size = stream_->size() - start_pos;
+  for (auto& kv : offset_map_) {
+    if (kv.first != BinaryOffsetType::TYPE_SECTION_ROUTE) {
+      kv.second.start += route_size;
+      kv.second.end += route_size;
+    }
+  }
+
+  for (const auto& block : blocks) {
+    WriteData(block.data(), block.size(), "section");
+  }
+}
+
 bool TemplateBinaryWriter::EncodeHeaderInfo(
     const CompileOptions& compile_options) {
   // register fields
@@ -279,15 +338,25 @@ void TemplateBinaryWriter::EncodeCSSDescriptor() {
   uint32_t descriptor_offset = stream()->size();
   uint32_t start = 0;
   uint32_t end = 0;
-  base::sorted_for_each(
-      fragments.begin(), fragments.end(),
-      [descriptor_offset, &route, &start, &end, this](const auto& it) {
-        auto& fragment = it.second;
-        EncodeCSSFragment(fragment);
-        end = stream()->size() - descriptor_offset;
-        route.fragment_ranges.insert({fragment->id(), CSSRange(start, end)});
-        start = end;
-      });
+  if (enable_parallel_encode_ && fragments.size() > 1) {
+    std::vector<encoder::SharedCSSFragment*> sorted_fragments;
+    sorted_fragments.reserve(fragments.size());
+    base::sorted_for_each(fragments.begin(), fragments.end(),
+                          [&sorted_fragments](const auto& it) {
+                            sorted_fragments.push_back(it.second);
+                          });
+    EncodeCSSFragmentsInParallel(sorted_fragments, route, descriptor_offset);
+  } else {
+    base::sorted_for_each(
+        fragments.begin(), fragments.end(),
+        [descriptor_offset, &route, &start, &end, this](const auto& it) {
+          auto& fragment = it.second;
+          EncodeCSSFragment(fragment);
+          end = stream()->size() - descriptor_offset;
+          route.fragment_ranges.insert({fragment->id(), CSSRange(start, end)});
+          start = end;
+        });
+  }
 
   start = stream()->size();
   EncodeCSSRoute(route);
@@ -299,6 +368,31 @@ void TemplateBinaryWriter::EncodeCSSDescriptor() {
   }
 }
 
+void TemplateBinaryWriter::EncodeCSSFragmentsInParallel(
+    const std::vector<encoder::SharedCSSFragment*>& fragments,
+    CSSRoute& route, uint32_t descriptor_offset) {
+  // A fragment is encoded without any reference to the other fragments, so
+  // each one is encoded by its own writer and the results are appended in
+  // order.
+  std::vector<std::vector<uint8_t>> parts(fragments.size());
+  ForEachInParallel(
+      fragments.size(),
+      [this, &fragments, &parts](size_t i) {
+        auto writer = CreatePartWriter();
+        writer->EncodeCSSFragment(fragments[i]);
+        parts[i] = writer->byte_array();
+      },
+      true);
+
+  uint32_t start = 0;
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    WriteData(parts[i].data(), parts[i].size(), "css fragment");
+    uint32_t end = stream()->size() - descriptor_offset;
+    route.fragment_ranges.insert({fragments[i]->id(), CSSRange(start, end)});
+    start = end;
+  }
+}
+
 void TemplateBinaryWriter::EncodeCSSRoute(const CSSRoute& css_route) {
   WriteCompactU32(css_route.fragment_ranges.size());
   base::sorted_for_each(css_route.fragment_ranges.begin(),
@@ -842,7 +936,70 @@ void TemplateBinaryWriter::EncodeElementTemplateSection() {
                                    this, stream_.get(), binary_info_,
                                    offset_map_, section_size_info_);
 
-  EncodeTemplatesToBinary(element_template_);
+  if (enable_parallel_encode_ || section_cache_) {
+    EncodeElementTemplatesInParts();
+  } else {
+    EncodeTemplatesToBinary(element_template_);
+  }
+}
+
+void TemplateBinaryWriter::EncodeElementTemplatesInParts() {
+  static constexpr char kCacheKind[] = "element_template";
+
+  // The templates are encoded separately, possibly restored from the cache,
+  // and concatenated in the same order as EncodeTemplatesToBinary, so the
+  // output is identical.
+  std::vector<const rapidjson::Value::Member*> templates;
+  for (const auto& member : element_template_->GetObject()) {
+    templates.push_back(&member);
+  }
+  std::vector<std::vector<uint8_t>> parts(templates.size());
+  ForEachInParallel(
+      templates.size(),
+      [this, &templates, &parts](size_t i) {
+        const auto& member = *templates[i];
+        std::string cache_key;
+        if (section_cache_) {
+          rapidjson::StringBuffer buffer;
+          rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+          member.value.Accept(writer);
+          cache_key = section_cache_->MakeKey(
+              kCacheKind, member.name.GetString(),
+              std::string(buffer.GetString(), buffer.GetSize()));
+          if (section_cache_->Get(cache_key, parts[i])) {
+            return;
+          }
+        }
+        CSRElementBinaryWriter writer(context_, compile_options_,
+                                      trial_options_);
+        writer.EncodeSingleTemplateBody(member.value);
+        parts[i] = writer.byte_array();
+        if (section_cache_) {
+          section_cache_->Put(cache_key, parts[i]);
+        }
+      },
+      enable_parallel_encode_);
+
+  OrderedStringKeyRouter router;
+  router.descriptor_offset_ = stream()->size();
+  uint32_t start_offset = 0;
+  for (size_t i = 0; i < templates.size(); ++i) {
+    router.start_offsets_.emplace_or_assign(templates[i]->name.GetString(),
+                                            start_offset);
+    WriteData(parts[i].data(), parts[i].size(), "element template");
+    start_offset += parts[i].size();
+  }
+  EncodeOrderedStringKeyRouter(router);
+}
+
+std::unique_ptr<TemplateBinaryWriter> TemplateBinaryWriter::CreatePartWriter()
+    const {
+  return std::make_unique<TemplateBinaryWriter>(
+      context_, use_lepusng_, true, nullptr, css_parser_, nullptr, nullptr,
+      nullptr, nullptr, "", "", "", "", "",
+      std::unordered_map<std::string, std::string>{}, compile_options_,
+      trial_options_, template_info_,
+      std::unordered_map<std::string, std::string>{}, nullptr);
 }
 
 int TemplateBinaryWriter::FindJSFileInDirectory(
@@ -1142,55 +1299,90 @@ void TemplateBinaryWriter::EncodeJsBytecode() {
   }
 
   // write js file contents
-  base::SortedForEach(
-      js_code_,
-      [this](const std::pair<std::string, std::string>& it) {
-        const std::string& file_name = it.first;
-        const std::string& file_content = it.second;
-        EncodeUtf8Str(file_name.c_str());
-        if (!silence_) {
-          printf("         %s\n", m.name.GetString());
-        }
+  // Every file is compiled in its own runtime, so they are compiled in
+  // parallel and written in the order of their names.
+  std::vector<const std::pair<const std::string, std::string>*> files;
+  files.reserve(js_code_.size());
+  for (const auto& it : js_code_) {
+    files.push_back(&it);
+  }
+  std::sort(files.begin(), files.end(),
+            [](const auto* a, const auto* b) { return a->first < b->first; });
+  bool is_debug_info_out = tasm::Config::IsHigherOrEqual(
+      compile_options_.target_sdk_version_.c_str(), LYNX_VERSION_2_14);
+  std::vector<std::vector<uint8_t>> bytecodes(files.size());
+  std::vector<std::unique_ptr<piper::quickjs::QuickjsDebugInfoProvider>>
+      debug_infos(files.size());
+  ForEachInParallel(
+      files.size(),
+      [this, &files, is_debug_info_out, &bytecodes, &debug_infos](size_t i) {
+        CompileJsBytecode(files[i]->first, files[i]->second, is_debug_info_out,
+                          bytecodes[i], debug_infos[i]);
+      },
+      enable_parallel_encode_);
 
-        auto src_buffer = std::make_shared<piper::StringBuffer>(file_content);
-        auto provider_src = piper::quickjs::QuickjsBytecodeProvider::FromSource(
-            file_name, src_buffer);
-        // provider_src.Compile() will print error detail if compile fails.
-        bool is_debug_info_out = tasm::Config::IsHigherOrEqual(
-            compile_options_.target_sdk_version_.c_str(), LYNX_VERSION_2_14);
-        if (is_debug_info_out) {
-          if (auto& info = provider_src.GenerateDebugInfo(); info.context_) {
-            SetLynxTargetSdkVersion(
-                info.context_, compile_options_.target_sdk_version_.c_str());
-            SetDebugInfoOutside(info.context_, true);
-            info.source_ = file_content;
-          }
-        }
+  for (size_t i = 0; i < files.size(); ++i) {
+    const std::string& file_name = files[i]->first;
+    EncodeUtf8Str(file_name.c_str());
+    if (!silence_) {
+      printf("         %s\n", file_name.c_str());
+    }
+    WriteCompactU32(static_cast<uint64_t>(bytecodes[i].size()));
+    WriteData(bytecodes[i].data(), bytecodes[i].size(), "quick bytecode");
+    if (is_debug_info_out) {
+      js_debug_info_.insert({file_name, std::move(debug_infos[i])});
+    }
+  }
+  if (!silence_) {
+    printf("end encode JS Bytecode......\n");
+  }
+}
 
-        auto provider = provider_src.Compile(
-            base::Version(compile_options_.target_sdk_version_),
-            {.strip_debug_info = !is_debug_info_out});
+void TemplateBinaryWriter::CompileJsBytecode(
+    const std::string& file_name, const std::string& file_content,
+    bool is_debug_info_out, std::vector<uint8_t>& bytecode,
+    std::unique_ptr<piper::quickjs::QuickjsDebugInfoProvider>& debug_info) {
+  static constexpr char kCacheKind[] = "js_bytecode";
+
+  // The debug info lives in a runtime and can not be cached, so only the
+  // bytecode without debug info is.
+  std::string cache_key;
+  if (section_cache_ && !is_debug_info_out) {
+    cache_key = section_cache_->MakeKey(kCacheKind, file_name, file_content);
+    if (section_cache_->Get(cache_key, bytecode)) {
+      return;
+    }
+  }
 
-        if (!provider) {
-          throw lepus::CompileException(
-              (file_name + " compilation error!").c_str());
-        }
-        auto bin_buffer = provider->GetPackedBytecodeBuffer();
-        if (!bin_buffer) {
-          throw lepus::CompileException(
-              (file_name + " compilation error!").c_str());
-        }
+  auto src_buffer = std::make_shared<piper::StringBuffer>(file_content);
+  auto provider_src = piper::quickjs::QuickjsBytecodeProvider::FromSource(
+      file_name, src_buffer);
+  // provider_src.Compile() will print error detail if compile fails.
+  if (is_debug_info_out) {
+    if (auto& info = provider_src.GenerateDebugInfo(); info.context_) {
+      SetLynxTargetSdkVersion(info.context_,
+                              compile_options_.target_sdk_version_.c_str());
+      SetDebugInfoOutside(info.context_, true);
+      info.source_ = file_content;
+    }
+  }
 
-        WriteCompactU32(static_cast<uint64_t>(bin_buffer->size()));
-        WriteData(bin_buffer->data(), bin_buffer->size(), "quick bytecode");
-        if (is_debug_info_out) {
-          js_debug_info_.insert(
-              {file_name, provider_src.GetDebugInfoProvider()});
-        }
-      },
-      [](const auto& a, const auto& b) { return a.first < b.first; });
-  if (!silence_) {
-    printf("end encode JS Bytecode......\n");
+  auto provider =
+      provider_src.Compile(base::Version(compile_options_.target_sdk_version_),
+                           {.strip_debug_info = !is_debug_info_out});
+
+  if (!provider) {
+    throw lepus::CompileException((file_name + " compilation error!").c_str());
+  }
+  auto bin_buffer = provider->GetPackedBytecodeBuffer();
+  if (!bin_buffer) {
+    throw lepus::CompileException((file_name + " compilation error!").c_str());
+  }
+  bytecode.assign(bin_buffer->data(), bin_buffer->data() + bin_buffer->size());
+  if (is_debug_info_out) {
+    debug_info = provider_src.GetDebugInfoProvider();
+  } else if (section_cache_) {
+    section_cache_->Put(cache_key, bytecode);
   }
 }
 
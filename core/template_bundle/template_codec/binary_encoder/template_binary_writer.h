@@ -18,6 +18,7 @@
 #include "core/template_bundle/template_codec/binary_encoder/csr_element_binary_writer.h"
 #include "core/template_bundle/template_codec/binary_encoder/css_encoder/css_keyframes_token.h"
 #include "core/template_bundle/template_codec/binary_encoder/css_encoder/css_parser.h"
+#include "core/template_bundle/template_codec/binary_encoder/encode_section_cache.h"
 #include "core/template_bundle/template_codec/binary_encoder/encode_util.h"
 #include "core/template_bundle/template_codec/header_ext_info.h"
 #include "core/template_bundle/template_codec/moulds.h"
@@ -98,6 +99,16 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
     return lepus_debug_info_.TakeDebugInfo();
   }
 
+  // Encodes the independent element templates, CSS fragments and JS files on
+  // worker threads. The output is the same as the sequential one.
+  void set_enable_parallel_encode(bool enable) {
+    enable_parallel_encode_ = enable;
+  }
+  // Reuses the encoded element templates and JS bytecode in |cache|.
+  void set_section_cache(std::shared_ptr<EncodeSectionCache> cache) {
+    section_cache_ = std::move(cache);
+  }
+
  protected:
   size_t EncodeNonFlexibleTemplateBody(std::function<void()> encode_func);
   size_t EncodeFlexibleTemplateBody(std::function<void()> encode_func);
@@ -105,6 +116,9 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   // For flexible template
   void EncodeSectionRoute();
   void MoveLastSectionToFirst(const BinarySection& section);
+  // Instead of the two above, writes the route followed by the sections
+  // compressed with LZBlockCodec.
+  void EncodeCompressedSections();
 
   // Header Info
   bool EncodeHeaderInfo(const CompileOptions& compile_options);
@@ -115,6 +129,9 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   void EncodeCSSDescriptor();
   void EncodeCSSRoute(const CSSRoute& css_route);
   void EncodeCSSFragment(encoder::SharedCSSFragment* fragment);
+  void EncodeCSSFragmentsInParallel(
+      const std::vector<encoder::SharedCSSFragment*>& fragments,
+      CSSRoute& route, uint32_t descriptor_offset);
   bool EncodeCSSParseToken(CSSParseToken* token);
   bool EncodeCSSKeyframesToken(encoder::CSSKeyframesToken* token);
   bool EncodeCSSSheet(CSSSheet* sheet);
@@ -131,6 +148,10 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   // JS section
   void SerializeJSSource();
   void EncodeJsBytecode();
+  void CompileJsBytecode(
+      const std::string& file_name, const std::string& file_content,
+      bool is_debug_info_out, std::vector<uint8_t>& bytecode,
+      std::unique_ptr<piper::quickjs::QuickjsDebugInfoProvider>& debug_info);
 
   // Encode Header
   void EncodeHeader();
@@ -147,6 +168,7 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
 
   // Encode Element Template
   void EncodeElementTemplateSection();
+  void EncodeElementTemplatesInParts();
   // Encode ParsedStyle
   void EncodeParsedStylesSection();
 
@@ -164,6 +186,10 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   void EncodeSimpleStyleObjectsRoute(const StyleObjectRoute& route);
 
  private:
+  // A writer sharing the context and compile options, which encodes a part
+  // of a section on its own.
+  std::unique_ptr<TemplateBinaryWriter> CreatePartWriter() const;
+
   static int FindJSFileInDirectory(
       const char* path, const char* relationPath,
       std::unordered_map<std::string, std::string>& js_map);
@@ -206,6 +232,9 @@ class TemplateBinaryWriter : public CSRElementBinaryWriter {
   rapidjson::Value* custom_sections_{nullptr};
 
   StyleObjectParser* style_object_parser_;
+
+  bool enable_parallel_encode_{false};
+  std::shared_ptr<EncodeSectionCache> section_cache_;
 };
 
 }  // namespace tasm
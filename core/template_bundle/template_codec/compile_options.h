@@ -106,6 +106,8 @@ struct CompileOptions {
   bool enable_async_lepus_chunk_decode_ = false;
   // using simple styling mode
   bool enable_simple_styling_{false};
+  // compress the sections of a flexible template, see LZBlockCodec.
+  bool enable_section_compression_{false};
 };
 
 #define FOREACH_FIXED_LENGTH_FIELD(V)             \
@@ -140,7 +142,8 @@ struct CompileOptions {
   V(UINT8, enable_reuse_context, 30);             \
   V(UINT8, enable_css_invalidation_, 31);         \
   V(UINT8, enable_async_lepus_chunk_decode_, 32); \
-  V(UINT8, enable_simple_styling_, 33);
+  V(UINT8, enable_simple_styling_, 33);           \
+  V(UINT8, enable_section_compression_, 34);
 
 #define FOREACH_STRING_FIELD(V) \
   V(target_sdk_version_, 0);    \
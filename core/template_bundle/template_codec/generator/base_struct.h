@@ -58,6 +58,12 @@ struct GeneratorOptions {
   bool skip_encode_{false};
   bool enable_ssr_{false};
   bool enable_cursor_{false};
+  // encode independent components, CSS fragments and JS files in parallel.
+  bool enable_parallel_encode_{false};
+  // directory of the encoded sections cached across builds, empty to disable.
+  std::string encode_cache_dir_{};
+  // print the lepus instruction counts before and after optimization.
+  bool dump_lepus_instruction_count_{false};
   PackageInstanceType instance_type_{PackageInstanceType::CARD};
   PackageInstanceDSL instance_dsl_{PackageInstanceDSL::TT};
   PackageInstanceBundleModuleMode bundle_module_mode_{
@@ -82,6 +82,10 @@ constexpr const char* kEnableConcurrentElement = "enableConcurrentElement";
 constexpr const char* kCustomSections = "customSections";
 constexpr const char* kEnableLepusChunkAsyncDecode =
     "enableLepusChunkAsyncDecode";
+constexpr const char* kEnableSectionCompression = "enableSectionCompression";
+constexpr const char* kEnableParallelEncode = "enableParallelEncode";
+constexpr const char* kEncodeCacheDir = "encodeCacheDir";
+constexpr const char* kDumpLepusInstructionCount = "dumpLepusInstructionCount";
 
 #define GET_VALUE_FROM_JSON(Doc, Key, Type, Var)   \
   if (Doc.HasMember(Key) && Doc[Key].Is##Type()) { \
@@ -505,6 +509,17 @@ EncoderOptions MetaFactory::GetEncoderOptions(rapidjson::Document& document) {
   // Get enableCursor
   GET_VALUE_FROM_JSON(options, kEnableCursor, Bool,
                       encoder_options.generator_options_.enable_cursor_)
+  // Get enableParallelEncode
+  GET_VALUE_FROM_JSON(
+      options, kEnableParallelEncode, Bool,
+      encoder_options.generator_options_.enable_parallel_encode_)
+  // Get encodeCacheDir
+  GET_VALUE_FROM_JSON(options, kEncodeCacheDir, String,
+                      encoder_options.generator_options_.encode_cache_dir_)
+  // Get dumpLepusInstructionCount
+  GET_VALUE_FROM_JSON(
+      options, kDumpLepusInstructionCount, Bool,
+      encoder_options.generator_options_.dump_lepus_instruction_count_)
 
   const char* template_debug_url = "";
   GET_VALUE_FROM_JSON(options, kTemplateDebugUrl, String, template_debug_url);
@@ -752,6 +767,30 @@ EncoderOptions MetaFactory::GetEncoderOptions(rapidjson::Document& document) {
     enable_css_parser = true;
   }
 
+  // Engines older than FEATURE_SECTION_COMPRESSION can not read the route of
+  // compressed sections.
+  bool enable_section_compression = false;
+  GET_VALUE_FROM_JSON(options, kEnableSectionCompression, Bool,
+                      enable_section_compression);
+  if (enable_section_compression &&
+      !Config::IsHigherOrEqual(
+          encoder_options.compile_options_.target_sdk_version_,
+          FEATURE_SECTION_COMPRESSION)) {
+    std::stringstream ss;
+    ss << "error: can't set " << kEnableSectionCompression
+       << " when engineVersion < " << FEATURE_SECTION_COMPRESSION;
+    encoder_options.err_msg_ = ss.str();
+    encoder_options.parser_result_ = false;
+    return encoder_options;
+  }
+  // Sections are only compressed in a flexible template. The offset map of
+  // SSR and cursor refers to the uncompressed sections, so they can not be
+  // compressed either.
+  enable_section_compression =
+      enable_section_compression && enable_flexible_template &&
+      !encoder_options.generator_options_.enable_ssr_ &&
+      !encoder_options.generator_options_.enable_cursor_;
+
   CompileOptions compile_options{
       encoder_options.compile_options_.target_sdk_version_,
       std::string(template_debug_url),
@@ -794,7 +833,8 @@ EncoderOptions MetaFactory::GetEncoderOptions(rapidjson::Document& document) {
       enable_air_raw_css,
       encode_quickjs_bytecode,
       enable_async_lepus_chunk,
-      enable_simple_styling};
+      enable_simple_styling,
+      enable_section_compression};
 
   // Set compile_options_
   encoder_options.compile_options_ = compile_options;
@@ -33,6 +33,9 @@ auto CreateJsonDocumentForCompile(
   options.AddMember("snapshot", package_configs.snapshot_, options_allocator);
   options.AddMember("targetSdkVersion", package_configs.target_sdk_version_,
                     options_allocator);
+  options.AddMember("dumpLepusInstructionCount",
+                    package_configs.dump_lepus_instruction_count_,
+                    options_allocator);
   // others
   options.AddMember("outputFile", "", options_allocator);
   return options;
@@ -59,7 +62,10 @@ auto ReadPackageConfigsFromFile(const std::string& package_config_buf,
       .silence_ = options.HasMember("silence") && options["silence"].GetBool(),
       .target_sdk_version_ = options.HasMember("targetSdkVersion")
                                  ? options["targetSdkVersion"].GetString()
-                                 : ""};
+                                 : "",
+      .dump_lepus_instruction_count_ =
+          options.HasMember("dumpLepusInstructionCount") &&
+          options["dumpLepusInstructionCount"].GetBool()};
 
   return package_config;
 }
@@ -190,6 +196,8 @@ std::string MakeEncodeOptions(const std::string& folder_path,
  * --snapshot if applied, enable snapshot
  * --targetSdkVersion [sdk version]
  * --silence if applied no debug message outputs
+ * --dumpLepusInstructionCount if applied, print the lepus instruction counts
+ * before and after optimization
  *
  */
 std::string MakeEncodeOptionsFromArgs(int args, char** argv) {
@@ -229,7 +237,9 @@ std::string MakeEncodeOptionsFromArgs(int args, char** argv) {
         .silence_ = has_option("--silence"),
         .target_sdk_version_ = has_option("--targetSdkVersion")
                                    ? parse_option("--targetSdkVersion")
-                                   : std::string{}};
+                                   : std::string{},
+        .dump_lepus_instruction_count_ =
+            has_option("--dumpLepusInstructionCount")};
   }();
 
   auto option_path = parse_option("--path");
@@ -26,6 +26,7 @@ struct PackageConfigs {
   bool snapshot_;
   bool silence_;
   std::string target_sdk_version_;
+  bool dump_lepus_instruction_count_{false};
 };
 std::string MakeEncodeOptions(const std::string& abs_folder_path,
                               const std::string& ttml_file_path,
@@ -0,0 +1,176 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/lz_block_codec.h"
+
+#include <cstring>
+
+namespace lynx {
+namespace tasm {
+
+namespace {
+
+constexpr size_t kMinMatch = 4;
+// As the LZ4 block format requires, the last match starts at least 12 bytes
+// before the end of the input, and the last 5 bytes are literals.
+constexpr size_t kMatchStartLimit = 12;
+constexpr size_t kLastLiterals = 5;
+constexpr size_t kMaxOffset = 65535;
+constexpr uint32_t kHashLog = 12;
+constexpr size_t kLengthMask = 15;
+
+uint32_t Read32(const uint8_t* ptr) {
+  uint32_t value;
+  memcpy(&value, ptr, sizeof(value));
+  return value;
+}
+
+uint32_t Hash(uint32_t sequence) {
+  return (sequence * 2654435761u) >> (32 - kHashLog);
+}
+
+// Writes the part of |length| which does not fit in the token.
+void WriteLength(size_t length, std::vector<uint8_t>& out) {
+  length -= kLengthMask;
+  while (length >= 255) {
+    out.push_back(255);
+    length -= 255;
+  }
+  out.push_back(static_cast<uint8_t>(length));
+}
+
+bool ReadLength(const uint8_t*& ptr, const uint8_t* end, size_t& length) {
+  uint8_t byte = 0;
+  do {
+    if (ptr >= end) {
+      return false;
+    }
+    byte = *ptr++;
+    length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+// A |match_length| of 0 writes the last sequence, which has literals only.
+void WriteSequence(const uint8_t* literals, size_t literal_length,
+                   size_t offset, size_t match_length,
+                   std::vector<uint8_t>& out) {
+  const size_t token_index = out.size();
+  out.push_back(0);
+  uint8_t token = static_cast<uint8_t>(
+      (literal_length >= kLengthMask ? kLengthMask : literal_length) << 4);
+  if (literal_length >= kLengthMask) {
+    WriteLength(literal_length, out);
+  }
+  out.insert(out.end(), literals, literals + literal_length);
+
+  if (match_length != 0) {
+    out.push_back(static_cast<uint8_t>(offset & 0xff));
+    out.push_back(static_cast<uint8_t>(offset >> 8));
+    const size_t length = match_length - kMinMatch;
+    token |= static_cast<uint8_t>(length >= kLengthMask ? kLengthMask : length);
+    if (length >= kLengthMask) {
+      WriteLength(length, out);
+    }
+  }
+  out[token_index] = token;
+}
+
+}  // namespace
+
+size_t LZBlockCodec::CompressBound(size_t size) {
+  return size + size / 255 + 16;
+}
+
+void LZBlockCodec::Compress(const uint8_t* src, size_t size,
+                            std::vector<uint8_t>& out) {
+  out.reserve(out.size() + CompressBound(size));
+  size_t anchor = 0;
+  if (size > kMatchStartLimit) {
+    // Positions of the last sequence of 4 bytes with the same hash.
+    std::vector<int32_t> table(1u << kHashLog, -1);
+    const size_t match_start_limit = size - kMatchStartLimit;
+    const size_t match_end_limit = size - kLastLiterals;
+    size_t pos = 0;
+    while (pos < match_start_limit) {
+      const uint32_t sequence = Read32(src + pos);
+      auto& slot = table[Hash(sequence)];
+      const int32_t candidate = slot;
+      slot = static_cast<int32_t>(pos);
+      if (candidate < 0 || pos - candidate > kMaxOffset ||
+          Read32(src + candidate) != sequence) {
+        ++pos;
+        continue;
+      }
+      size_t length = kMinMatch;
+      while (pos + length < match_end_limit &&
+             src[candidate + length] == src[pos + length]) {
+        ++length;
+      }
+      WriteSequence(src + anchor, pos - anchor, pos - candidate, length, out);
+      pos += length;
+      anchor = pos;
+    }
+  }
+  WriteSequence(src + anchor, size - anchor, 0, 0, out);
+}
+
+bool LZBlockCodec::Decompress(const uint8_t* src, size_t src_size,
+                              uint8_t* dst, size_t dst_size) {
+  const uint8_t* ptr = src;
+  const uint8_t* const end = src + src_size;
+  uint8_t* out = dst;
+  uint8_t* const out_end = dst + dst_size;
+
+  while (ptr < end) {
+    const uint8_t token = *ptr++;
+
+    size_t literal_length = token >> 4;
+    if (literal_length == kLengthMask && !ReadLength(ptr, end, literal_length)) {
+      return false;
+    }
+    if (literal_length > static_cast<size_t>(end - ptr) ||
+        literal_length > static_cast<size_t>(out_end - out)) {
+      return false;
+    }
+    memcpy(out, ptr, literal_length);
+    out += literal_length;
+    ptr += literal_length;
+    if (ptr == end) {
+      // The last sequence has no match.
+      break;
+    }
+
+    if (end - ptr < 2) {
+      return false;
+    }
+    const size_t offset = ptr[0] | (static_cast<size_t>(ptr[1]) << 8);
+    ptr += 2;
+    if (offset == 0 || offset > static_cast<size_t>(out - dst)) {
+      return false;
+    }
+    size_t match_length = token & kLengthMask;
+    if (match_length == kLengthMask && !ReadLength(ptr, end, match_length)) {
+      return false;
+    }
+    match_length += kMinMatch;
+    if (match_length > static_cast<size_t>(out_end - out)) {
+      return false;
+    }
+    const uint8_t* match = out - offset;
+    if (offset >= match_length) {
+      memcpy(out, match, match_length);
+    } else {
+      // The match overlaps the output, e.g. a run of a repeated byte.
+      for (size_t i = 0; i < match_length; ++i) {
+        out[i] = match[i];
+      }
+    }
+    out += match_length;
+  }
+  return out == out_end;
+}
+
+}  // namespace tasm
+}  // namespace lynx
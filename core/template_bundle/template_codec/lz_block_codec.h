@@ -0,0 +1,44 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_LZ_BLOCK_CODEC_H_
+#define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_LZ_BLOCK_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lynx {
+namespace tasm {
+
+/**
+ * @class LZBlockCodec
+ *
+ * A small LZ77 codec producing the LZ4 block format, used to compress the
+ * sections of a flexible template. It favors decompression speed over ratio:
+ * decompression is a loop of literal and match copies without any entropy
+ * decoding, so that a section costs little more than a memcpy to inflate.
+ *
+ * A block does not record its decompressed size, the caller stores it next to
+ * the block.
+ */
+class LZBlockCodec {
+ public:
+  // The largest size of the block of |size| bytes of input.
+  static size_t CompressBound(size_t size);
+
+  // Appends the block of [src, src + size) to |out|.
+  static void Compress(const uint8_t* src, size_t size,
+                       std::vector<uint8_t>& out);
+
+  // Decompresses the block [src, src + src_size) to exactly |dst_size| bytes
+  // at |dst|. Returns false if the block is malformed.
+  static bool Decompress(const uint8_t* src, size_t src_size, uint8_t* dst,
+                         size_t dst_size);
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_LZ_BLOCK_CODEC_H_
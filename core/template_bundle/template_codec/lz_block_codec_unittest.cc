@@ -0,0 +1,99 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/lz_block_codec.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+namespace {
+
+std::vector<uint8_t> RoundTrip(const std::vector<uint8_t>& input,
+                               size_t* compressed_size = nullptr) {
+  std::vector<uint8_t> block;
+  LZBlockCodec::Compress(input.data(), input.size(), block);
+  EXPECT_LE(block.size(), LZBlockCodec::CompressBound(input.size()));
+  if (compressed_size) {
+    *compressed_size = block.size();
+  }
+  std::vector<uint8_t> output(input.size());
+  EXPECT_TRUE(LZBlockCodec::Decompress(block.data(), block.size(),
+                                       output.data(), output.size()));
+  return output;
+}
+
+std::vector<uint8_t> MakeRepetitiveInput() {
+  std::vector<uint8_t> input;
+  for (int i = 0; i < 400; ++i) {
+    std::string line = "{\"tag\":\"view\",\"class\":\"item-" +
+                       std::to_string(i % 7) + "\",\"style\":\"flex:1\"}";
+    input.insert(input.end(), line.begin(), line.end());
+  }
+  return input;
+}
+
+}  // namespace
+
+TEST(LZBlockCodecTest, RoundTripRepetitiveInput) {
+  auto input = MakeRepetitiveInput();
+  size_t compressed_size = 0;
+  EXPECT_EQ(RoundTrip(input, &compressed_size), input);
+  EXPECT_LT(compressed_size, input.size() / 4);
+}
+
+TEST(LZBlockCodecTest, RoundTripOverlappingMatchesAndLongLengths) {
+  // A run longer than 255 bytes needs extended lengths and overlapping
+  // copies.
+  std::vector<uint8_t> input(1000, 'a');
+  input.insert(input.end(), 300, 'b');
+  for (int i = 0; i < 300; ++i) {
+    input.push_back(static_cast<uint8_t>(i * 31));
+  }
+  EXPECT_EQ(RoundTrip(input), input);
+}
+
+TEST(LZBlockCodecTest, RoundTripShortAndIncompressibleInput) {
+  EXPECT_EQ(RoundTrip({}), std::vector<uint8_t>());
+  std::vector<uint8_t> tiny{1, 2, 3, 1, 2, 3, 1, 2, 3};
+  EXPECT_EQ(RoundTrip(tiny), tiny);
+
+  std::vector<uint8_t> noise;
+  uint32_t seed = 12345;
+  for (int i = 0; i < 5000; ++i) {
+    seed = seed * 1103515245 + 12345;
+    noise.push_back(static_cast<uint8_t>(seed >> 16));
+  }
+  EXPECT_EQ(RoundTrip(noise), noise);
+}
+
+TEST(LZBlockCodecTest, RejectMalformedBlock) {
+  auto input = MakeRepetitiveInput();
+  std::vector<uint8_t> block;
+  LZBlockCodec::Compress(input.data(), input.size(), block);
+  std::vector<uint8_t> output(input.size());
+
+  // Wrong decompressed size.
+  EXPECT_FALSE(LZBlockCodec::Decompress(block.data(), block.size(),
+                                        output.data(), output.size() - 1));
+  // Truncated block.
+  EXPECT_FALSE(LZBlockCodec::Decompress(block.data(), block.size() / 2,
+                                        output.data(), output.size()));
+  // A match referring to data before the output.
+  std::vector<uint8_t> bad_offset{0x10, 'a', 0x10, 0x00, 0x50, 'b', 'c',
+                                  'd',  'e', 'f'};
+  std::vector<uint8_t> bad_output(10);
+  EXPECT_FALSE(LZBlockCodec::Decompress(bad_offset.data(), bad_offset.size(),
+                                        bad_output.data(), bad_output.size()));
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
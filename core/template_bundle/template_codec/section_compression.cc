@@ -0,0 +1,104 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/section_compression.h"
+
+#include <algorithm>
+#include <cstring>
+#include <future>
+#include <utility>
+
+#include "base/include/fml/memory/ref_counted.h"
+#include "core/base/thread/once_task.h"
+#include "core/base/threading/task_runner_manufactor.h"
+#include "core/template_bundle/template_codec/lz_block_codec.h"
+
+namespace lynx {
+namespace tasm {
+
+SectionStorage SectionCompression::Store(const uint8_t* src, size_t size,
+                                         std::vector<uint8_t>& out) {
+  const size_t begin = out.size();
+  LZBlockCodec::Compress(src, size, out);
+  if (out.size() - begin < size) {
+    return SectionStorage::kLZBlock;
+  }
+  out.resize(begin);
+  out.insert(out.end(), src, src + size);
+  return SectionStorage::kRaw;
+}
+
+bool SectionCompression::CheckRoute(const std::vector<StoredSection>& sections,
+                                    size_t stored_size, uint32_t& body_size) {
+  uint64_t stored_end = 0;
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+  ranges.reserve(sections.size());
+  for (const auto& section : sections) {
+    if (!IsKnownStorage(static_cast<uint8_t>(section.storage)) ||
+        section.start > section.end) {
+      return false;
+    }
+    if (section.storage == SectionStorage::kRaw &&
+        section.stored_size != section.end - section.start) {
+      return false;
+    }
+    stored_end += section.stored_size;
+    ranges.emplace_back(section.start, section.end);
+  }
+  if (stored_end > stored_size) {
+    return false;
+  }
+
+  // Sections are decompressed in parallel, each to its own range of the
+  // body, so the ranges must not overlap.
+  std::sort(ranges.begin(), ranges.end());
+  body_size = 0;
+  for (const auto& range : ranges) {
+    if (range.first < body_size) {
+      return false;
+    }
+    body_size = range.second;
+  }
+  return true;
+}
+
+bool SectionCompression::Restore(const std::vector<StoredSection>& sections,
+                                 const uint8_t* stored, uint8_t* body) {
+  std::vector<base::OnceTaskRefptr<bool>> tasks;
+  for (const auto& section : sections) {
+    const size_t size = section.end - section.start;
+    const uint8_t* src = stored;
+    uint8_t* dst = body + section.start;
+    stored += section.stored_size;
+
+    if (section.storage == SectionStorage::kRaw) {
+      memcpy(dst, src, size);
+      continue;
+    }
+    std::promise<bool> promise;
+    std::future<bool> future = promise.get_future();
+    auto task = fml::MakeRefCounted<base::OnceTask<bool>>(
+        [src, stored_size = section.stored_size, dst, size,
+         promise = std::move(promise)]() mutable {
+          promise.set_value(
+              LZBlockCodec::Decompress(src, stored_size, dst, size));
+        },
+        std::move(future));
+    base::TaskRunnerManufactor::PostTaskToConcurrentLoop(
+        [task]() { task->Run(); }, base::ConcurrentTaskType::HIGH_PRIORITY);
+    tasks.emplace_back(std::move(task));
+  }
+
+  // Run the tasks not yet taken by the concurrent loop on this thread, and
+  // wait for the others.
+  bool result = true;
+  for (auto& task : tasks) {
+    task->Run();
+    result = task->GetFuture().get() && result;
+  }
+  return result;
+}
+
+}  // namespace tasm
+}  // namespace lynx
@@ -0,0 +1,65 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#ifndef CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_SECTION_COMPRESSION_H_
+#define CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_SECTION_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lynx {
+namespace tasm {
+
+// How a section is stored in a template with enable_section_compression_.
+// The section route records it with the stored size of every section.
+enum class SectionStorage : uint8_t {
+  kRaw = 0,
+  kLZBlock,
+};
+
+// A section in the route of a template with enable_section_compression_.
+// [start, end) is the range of the decompressed section relative to the end
+// of the route. The stored sections follow the route in route order.
+struct StoredSection {
+  uint32_t start;
+  uint32_t end;
+  SectionStorage storage;
+  uint32_t stored_size;
+};
+
+/**
+ * @class SectionCompression
+ *
+ * The storage of the sections of a template with enable_section_compression_,
+ * shared by TemplateBinaryWriter and LynxBinaryBaseTemplateReader.
+ */
+class SectionCompression {
+ public:
+  static bool IsKnownStorage(uint8_t storage) {
+    return storage <= static_cast<uint8_t>(SectionStorage::kLZBlock);
+  }
+
+  // Appends [src, src + size) to |out|, compressed if it is smaller, and
+  // returns how it was stored.
+  static SectionStorage Store(const uint8_t* src, size_t size,
+                              std::vector<uint8_t>& out);
+
+  // Checks the route before anything is decompressed: every storage is
+  // known, the stored sections fit in |stored_size| bytes and the
+  // decompressed sections do not overlap. Sets |body_size| to the size of
+  // the decompressed sections.
+  static bool CheckRoute(const std::vector<StoredSection>& sections,
+                         size_t stored_size, uint32_t& body_size);
+
+  // Restores the sections checked by CheckRoute from |stored| to |body|.
+  // Compressed sections are decompressed in parallel on the concurrent loop.
+  static bool Restore(const std::vector<StoredSection>& sections,
+                      const uint8_t* stored, uint8_t* body);
+};
+
+}  // namespace tasm
+}  // namespace lynx
+
+#endif  // CORE_TEMPLATE_BUNDLE_TEMPLATE_CODEC_SECTION_COMPRESSION_H_
@@ -0,0 +1,141 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include "core/template_bundle/template_codec/section_compression.h"
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "third_party/googletest/googletest/include/gtest/gtest.h"
+
+namespace lynx {
+namespace tasm {
+namespace test {
+
+namespace {
+
+// The sections of a template body, as the writer lays them out.
+struct EncodedBody {
+  std::vector<uint8_t> body;
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+};
+
+EncodedBody MakeBody() {
+  EncodedBody encoded;
+  auto add_section = [&encoded](const std::vector<uint8_t>& section) {
+    const uint32_t start = static_cast<uint32_t>(encoded.body.size());
+    encoded.body.insert(encoded.body.end(), section.begin(), section.end());
+    encoded.ranges.emplace_back(start,
+                                static_cast<uint32_t>(encoded.body.size()));
+  };
+
+  std::vector<uint8_t> repetitive;
+  for (int i = 0; i < 400; ++i) {
+    std::string line = ".item-" + std::to_string(i % 7) + "{flex:1}";
+    repetitive.insert(repetitive.end(), line.begin(), line.end());
+  }
+  std::vector<uint8_t> noise(1000);
+  uint32_t seed = 1;
+  for (auto& byte : noise) {
+    seed = seed * 1103515245 + 12345;
+    byte = static_cast<uint8_t>(seed >> 16);
+  }
+
+  add_section(repetitive);
+  add_section(noise);
+  add_section({});
+  add_section(repetitive);
+  return encoded;
+}
+
+// Stores the sections the way TemplateBinaryWriter::EncodeCompressedSections
+// does: the route, then the stored sections in route order.
+std::vector<StoredSection> Encode(const EncodedBody& encoded,
+                                  std::vector<uint8_t>& stored) {
+  std::vector<StoredSection> route;
+  for (const auto& range : encoded.ranges) {
+    const size_t begin = stored.size();
+    SectionStorage storage =
+        SectionCompression::Store(encoded.body.data() + range.first,
+                                  range.second - range.first, stored);
+    route.push_back({range.first, range.second, storage,
+                     static_cast<uint32_t>(stored.size() - begin)});
+  }
+  return route;
+}
+
+}  // namespace
+
+TEST(SectionCompressionTest, EncodeDecodeRoundTrip) {
+  EncodedBody encoded = MakeBody();
+  std::vector<uint8_t> stored;
+  std::vector<StoredSection> route = Encode(encoded, stored);
+
+  EXPECT_EQ(route[0].storage, SectionStorage::kLZBlock);
+  EXPECT_LT(route[0].stored_size, route[0].end - route[0].start);
+  EXPECT_EQ(route[1].storage, SectionStorage::kRaw);
+  EXPECT_EQ(route[2].storage, SectionStorage::kRaw);
+  EXPECT_LT(stored.size(), encoded.body.size());
+
+  uint32_t body_size = 0;
+  ASSERT_TRUE(SectionCompression::CheckRoute(route, stored.size(), body_size));
+  EXPECT_EQ(body_size, encoded.body.size());
+
+  std::vector<uint8_t> body(body_size);
+  ASSERT_TRUE(SectionCompression::Restore(route, stored.data(), body.data()));
+  EXPECT_EQ(body, encoded.body);
+}
+
+TEST(SectionCompressionTest, RejectUnknownStorage) {
+  EXPECT_TRUE(SectionCompression::IsKnownStorage(0));
+  EXPECT_TRUE(SectionCompression::IsKnownStorage(1));
+  EXPECT_FALSE(SectionCompression::IsKnownStorage(2));
+
+  EncodedBody encoded = MakeBody();
+  std::vector<uint8_t> stored;
+  std::vector<StoredSection> route = Encode(encoded, stored);
+  route[1].storage = static_cast<SectionStorage>(7);
+  uint32_t body_size = 0;
+  EXPECT_FALSE(
+      SectionCompression::CheckRoute(route, stored.size(), body_size));
+}
+
+TEST(SectionCompressionTest, RejectStoredSectionsOutOfBounds) {
+  EncodedBody encoded = MakeBody();
+  std::vector<uint8_t> stored;
+  std::vector<StoredSection> route = Encode(encoded, stored);
+  uint32_t body_size = 0;
+  EXPECT_FALSE(
+      SectionCompression::CheckRoute(route, stored.size() - 1, body_size));
+
+  route[0].stored_size = UINT32_MAX;
+  EXPECT_FALSE(
+      SectionCompression::CheckRoute(route, stored.size(), body_size));
+}
+
+TEST(SectionCompressionTest, RejectOverlappingSections) {
+  EncodedBody encoded = MakeBody();
+  std::vector<uint8_t> stored;
+  std::vector<StoredSection> route = Encode(encoded, stored);
+  uint32_t body_size = 0;
+
+  // The last section decompresses into the first one.
+  std::vector<StoredSection> overlapping = route;
+  overlapping[3].start = route[0].start + 1;
+  overlapping[3].end = route[0].end + 1;
+  EXPECT_FALSE(
+      SectionCompression::CheckRoute(overlapping, stored.size(), body_size));
+
+  std::vector<StoredSection> reversed = route;
+  reversed[0].start = route[0].end;
+  reversed[0].end = route[0].start;
+  EXPECT_FALSE(
+      SectionCompression::CheckRoute(reversed, stored.size(), body_size));
+}
+
+}  // namespace test
+}  // namespace tasm
+}  // namespace lynx
@@ -13,6 +13,7 @@
 #include "base/include/value/base_value.h"
 #include "base/include/vector.h"
 #include "core/template_bundle/template_codec/magic_number.h"
+#include "core/template_bundle/template_codec/section_compression.h"
 
 namespace lynx {
 namespace tasm {
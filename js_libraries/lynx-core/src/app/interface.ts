@@ -8,7 +8,10 @@ import { LynxSetTimeout } from '@lynx-js/types';
 import { BaseApp } from '.';
 import { LynxFeature } from '../common';
 import { IdentifierType } from '../modules/selectorQuery';
-import { PipelineOptions } from '../modules/performance/performance';
+import {
+  FrameTimelineEntry,
+  PipelineOptions,
+} from '../modules/performance/performance';
 import { NativeModule } from '../modules/nativeModules';
 import {
   BaseError,
@@ -313,6 +316,10 @@ export interface NativeApp {
   unsubscribeSessionStorage: (key: string, listenerId: number) => void;
 
   // Timing related
+  getFrameTimeline: (
+    sinceSequence: number,
+    callback: (frames?: FrameTimelineEntry[]) => void
+  ) => void;
   generatePipelineOptions: () => PipelineOptions;
   onPipelineStart: (
     pipeline_id: string,
@@ -25,6 +25,7 @@ import nativeGlobal from '../common/nativeGlobal';
 import Element from '../modules/element';
 import { LynxErrorLevel } from '../modules/report';
 import Performance from '../modules/performance';
+import { FrameTimelineEntry } from '../modules/performance/performance';
 import SelectorQuery from '../modules/selectorQuery/SelectorQuery';
 import { KeyframeEffectV2 } from '../modules/animation/effect';
 import { AnimationV2 } from '../modules/animation/animationV2';
@@ -251,6 +252,15 @@ export class Lynx {
     return listenerId;
   };
 
+  // Frames completed after `sinceSequence`, oldest first. The callback gets
+  // undefined if the enable_frame_timeline switch is off.
+  getFrameTimeline = (
+    sinceSequence: number,
+    callback: (frames?: FrameTimelineEntry[]) => void
+  ): void => {
+    this.getNativeApp().getFrameTimeline(sinceSequence, callback);
+  };
+
   unsubscribeSessionStorage = (key: string, listenerId: number) => {
     this.dispatchSessionStorageEvent({
       type: MessageEventType.EVENT_UNSUBSCRIBE_SESSION_STORAGE,
@@ -25,6 +25,28 @@ export interface PipelineOptions {
   stage: string;
 }
 
+// The per phase breakdown of a pipeline recorded by the native FrameTimeline.
+// Timestamps and durations are in milliseconds.
+export interface FrameTimelineEntry {
+  entryType: 'frame';
+  name: string; // The origin of the pipeline
+  sequence: number;
+  pipelineId: string;
+  start: number;
+  end: number;
+  duration: number;
+  mtsRenderDuration: number;
+  resolveDuration: number;
+  layoutDuration: number;
+  uiOperationFlushDuration: number;
+  platformCommitDuration: number;
+  allocationCount: number;
+  elementCreatedCount: number;
+  elementUpdatedCount: number;
+  elementRestyledCount: number;
+  layoutNodeMeasuredCount: number;
+}
+
 export default class Performance implements IPerformance {
   _emitter: EventEmitter;
   _generatePipelineOptions: () => PipelineOptions;
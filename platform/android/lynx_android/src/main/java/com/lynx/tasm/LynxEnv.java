@@ -63,6 +63,7 @@ import com.lynx.tasm.service.ILynxSystemInvokeService;
 import com.lynx.tasm.service.ILynxTrailService;
 import com.lynx.tasm.service.LynxServiceCenter;
 import com.lynx.tasm.utils.UIThreadUtils;
+import java.io.File;
 import java.lang.reflect.InvocationTargetException;
 import java.lang.reflect.Method;
 import java.util.ArrayList;
@@ -80,6 +81,7 @@ import java.util.concurrent.atomic.AtomicBoolean;
 public class LynxEnv {
   protected static final String TAG = "LynxEnv";
   public static final String SP_NAME = "lynx_env_config";
+  private static final String PARSED_STYLE_CACHE_DIR_NAME = "lynx_parsed_style";
 
   protected static volatile LynxEnv sInstance;
 
@@ -293,6 +295,8 @@ public class LynxEnv {
 
     syncDevtoolComponentAttachSwitch();
 
+    initParsedStyleCacheDirectory(context);
+
     // init Trace
     initTrace(mContext);
 
@@ -1410,6 +1414,15 @@ public class LynxEnv {
     task.run();
   }
 
+  private void initParsedStyleCacheDirectory(Context context) {
+    File cacheDir = context.getCacheDir();
+    if (cacheDir == null) {
+      return;
+    }
+    nativeSetParsedStyleCacheDirectory(
+        new File(cacheDir, PARSED_STYLE_CACHE_DIR_NAME).getAbsolutePath());
+  }
+
   protected void initNativeGlobalPool() {
     if (mIsNativeLibraryLoaded) {
       nativePrepareLynxGlobalPool();
@@ -1466,5 +1479,6 @@ public class LynxEnv {
   }
 
   protected static native void nativePrepareLynxGlobalPool();
+  private static native void nativeSetParsedStyleCacheDirectory(String directory);
   private static native void nativeClearBytecode(String bytecodeSourceUrl, boolean useV8);
 }
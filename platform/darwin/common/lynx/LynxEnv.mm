@@ -41,6 +41,7 @@
 #include "core/services/performance/memory_monitor/memory_monitor.h"
 #include "core/services/ssr/ssr_type_info.h"
 #include "core/services/timing_handler/timing.h"
+#include "core/template_bundle/parsed_style_disk_cache.h"
 
 #if OS_IOS
 #import <Lynx/LynxUICollection.h>
@@ -97,12 +98,23 @@
 #if OS_IOS
     lynx::tasm::Config::InitializeVersion([[UIDevice currentDevice].systemVersion UTF8String]);
 #endif
+    [self initParsedStyleCacheDirectory];
     [LynxService(LynxServiceExtensionProtocol) onLynxEnvSetup];
   }
   _LogI(@"LynxEnv: init success");
   return self;
 }
 
+- (void)initParsedStyleCacheDirectory {
+  NSString *cacheDir =
+      [NSSearchPathForDirectoriesInDomains(NSCachesDirectory, NSUserDomainMask, YES) firstObject];
+  if (cacheDir == nil) {
+    return;
+  }
+  NSString *directory = [cacheDir stringByAppendingPathComponent:@"lynx_parsed_style"];
+  lynx::tasm::ParsedStyleDiskCache::Instance().SetDirectory([directory UTF8String]);
+}
+
 - (void)initLynxTrace {
 #if ENABLE_TRACE_PERFETTO
   [[LynxTraceController sharedInstance] startStartupTracingIfNeeded];
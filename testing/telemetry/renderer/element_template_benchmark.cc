@@ -0,0 +1,73 @@
+// Copyright 2024 The Lynx Authors. All rights reserved.
+// Licensed under the Apache License Version 2.0 that can be found in the
+// LICENSE file in the root directory of this source tree.
+
+#include <string>
+#include <utility>
+
+#include "core/renderer/dom/fiber/fiber_element.h"
+#include "core/renderer/dom/fiber/tree_resolver.h"
+#include "core/renderer/utils/base/element_template_info.h"
+#include "third_party/benchmark/include/benchmark/benchmark.h"
+
+namespace lynx {
+namespace tasm {
+
+// Compares building the elements of a template from its ElementTemplateInfo
+// with cloning them from the template prototype, which is what
+// ElementTemplatePrototypeCache does for all but the first instance.
+
+static ElementInfo MakeElementInfo(ElementBuiltInTagEnum tag, int index) {
+  ElementInfo info;
+  info.tag_enum_ = tag;
+  info.id_selector_ = "id-" + std::to_string(index);
+  info.class_selector_.emplace_back("item");
+  info.class_selector_.emplace_back("item-" + std::to_string(index));
+  info.inline_styles_[kPropertyIDWidth] = "100px";
+  info.inline_styles_[kPropertyIDHeight] = "20px";
+  info.attrs_[base::String("index")] = lepus::Value(index);
+  info.attrs_[base::String("name")] = lepus::Value("item");
+  info.builtin_attrs_[ElementBuiltInAttributeEnum::DIRTY_ID] =
+      lepus::Value(std::to_string(index));
+  return info;
+}
+
+// A list item like template: a view with |count| view children, each with a
+// text child.
+static ElementTemplateInfo MakeTemplateInfo(int count) {
+  ElementTemplateInfo template_info;
+  template_info.exist_ = true;
+  template_info.key_ = "item";
+  auto root = MakeElementInfo(ElementBuiltInTagEnum::ELEMENT_VIEW, 0);
+  for (int i = 1; i <= count; ++i) {
+    auto child = MakeElementInfo(ElementBuiltInTagEnum::ELEMENT_VIEW, i);
+    child.children_.emplace_back(
+        MakeElementInfo(ElementBuiltInTagEnum::ELEMENT_TEXT, count + i));
+    root.children_.emplace_back(std::move(child));
+  }
+  template_info.elements_.emplace_back(std::move(root));
+  return template_info;
+}
+
+static void BM_ElementTemplateFromTemplateInfo(benchmark::State& state) {
+  const auto template_info = MakeTemplateInfo(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(TreeResolver::FromTemplateInfo(template_info));
+  }
+}
+
+static void BM_ElementTemplateCloneElementRecursively(
+    benchmark::State& state) {
+  const auto template_info = MakeTemplateInfo(state.range(0));
+  const auto prototype = TreeResolver::FromTemplateInfo(template_info);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        TreeResolver::CloneElementRecursively(prototype[0].get(), false));
+  }
+}
+
+BENCHMARK(BM_ElementTemplateFromTemplateInfo)->Arg(4)->Arg(16)->Arg(64);
+BENCHMARK(BM_ElementTemplateCloneElementRecursively)->Arg(4)->Arg(16)->Arg(64);
+
+}  // namespace tasm
+}  // namespace lynx